@@ -0,0 +1,469 @@
+/* Benchmark of the replication pipeline
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "OpenLogReplicator.h"
+#include "bench/MetricsBench.h"
+#include "bench/RedoGenerator.h"
+#include "common/Ctx.h"
+#include "common/exception/ConfigurationException.h"
+#include "common/exception/DataException.h"
+#include "common/exception/RuntimeException.h"
+#include "common/types/Data.h"
+
+// Allocation counters, all global operator new variants are replaced
+namespace {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+
+    void* allocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        return malloc(size == 0 ? 1 : size);
+    }
+
+    void* allocateAligned(std::size_t size, std::align_val_t align) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        const auto alignment = static_cast<std::size_t>(align);
+        return aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment);
+    }
+}
+
+void* operator new(std::size_t size) {
+    void* ptr = allocate(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    void* ptr = allocate(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& tag __attribute__((unused))) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag __attribute__((unused))) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    void* ptr = allocateAligned(size, align);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    void* ptr = allocateAligned(size, align);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size __attribute__((unused))) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t size __attribute__((unused))) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t align __attribute__((unused))) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t align __attribute__((unused))) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size __attribute__((unused)), std::align_val_t align __attribute__((unused))) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t size __attribute__((unused)), std::align_val_t align __attribute__((unused))) noexcept {
+    free(ptr);
+}
+
+namespace {
+    OpenLogReplicator::Ctx* mainCtx = nullptr;
+
+    void signalHandler(int s) {
+        mainCtx->signalHandler(s);
+    }
+
+    void signalCrash(int sig __attribute__((unused))) {
+        mainCtx->printStacktrace();
+        exit(1);
+    }
+
+    uint64_t argNumber(const std::string& arg, const char* value) {
+        const std::string str(value);
+        if (str.empty() || str.find_first_not_of("0123456789") != std::string::npos)
+            throw OpenLogReplicator::ConfigurationException(30002, "invalid value of argument " + arg + ": " + str + ", expected: number");
+        return strtoull(str.c_str(), nullptr, 10);
+    }
+
+    // Returns false for an unknown option
+    bool parseOption(const std::string& arg, const char* value, std::string& fileName, std::string& generatePath, std::string& outputName,
+                     std::string& format, OpenLogReplicator::RedoGenerator& generator) {
+        if (arg == "-f" || arg == "--file")
+            fileName = value;
+        else if (arg == "-g" || arg == "--generate")
+            generatePath = value;
+        else if (arg == "-o" || arg == "--output")
+            outputName = value;
+        else if (arg == "--format") {
+            format = value;
+            if (format != "json" && format != "protobuf")
+                throw OpenLogReplicator::ConfigurationException(30002, "invalid format: " + format + ", expected: one of {json, protobuf}");
+        } else if (arg == "--files")
+            generator.files = argNumber(arg, value);
+        else if (arg == "--transactions")
+            generator.transactions = argNumber(arg, value);
+        else if (arg == "--operations")
+            generator.operations = argNumber(arg, value);
+        else if (arg == "--lwn")
+            generator.transactionsPerLwn = argNumber(arg, value);
+        else if (arg == "--tables")
+            generator.tables = argNumber(arg, value);
+        else if (arg == "--columns")
+            generator.columns = argNumber(arg, value);
+        else if (arg == "--rows-per-multi")
+            generator.rowsPerMulti = argNumber(arg, value);
+        else if (arg == "--lob-size")
+            generator.lobSize = argNumber(arg, value);
+        else if (arg == "--seed")
+            generator.seed = argNumber(arg, value);
+        else if (arg == "--mix")
+            generator.setMix(value);
+        else
+            return false;
+        return true;
+    }
+
+    std::string escapeJson(const std::string& str) {
+        std::string result;
+        for (const char c: str) {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    uint64_t timevalUs(const timeval& tv) {
+        return (static_cast<uint64_t>(tv.tv_sec) * 1000000) + static_cast<uint64_t>(tv.tv_usec);
+    }
+
+    void makeDirectory(const std::string& path) {
+        if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST)
+            throw OpenLogReplicator::RuntimeException(10006, "file: " + path + " - open for writing returned: " + strerror(errno));
+    }
+
+    // Checkpoints of a previous run would skip the generated redo logs
+    void removeCheckpoints(const std::string& path) {
+        DIR* dir = opendir(path.c_str());
+        if (dir == nullptr)
+            throw OpenLogReplicator::RuntimeException(10012, "directory: " + path + " - can't read");
+
+        const std::string prefix("BENCH-chkpt");
+        dirent* ent;
+        while ((ent = readdir(dir)) != nullptr) {
+            const std::string fileName(ent->d_name);
+            if (fileName.compare(0, prefix.length(), prefix) != 0)
+                continue;
+            const std::string fullName(path + "/" + fileName);
+            if (unlink(fullName.c_str()) != 0)
+                mainCtx->warning(10010, "file: " + fullName + " - delete returned: " + strerror(errno));
+        }
+        closedir(dir);
+    }
+
+    // Configuration for the generated redo logs: batch reader, schemaless mode, output discarded
+    std::string writeConfig(const std::string& path, const std::string& format) {
+        const std::string fileName = path + "/OpenLogReplicator.json";
+        std::ofstream config(fileName, std::ios::out | std::ios::trunc);
+        if (!config.is_open())
+            throw OpenLogReplicator::RuntimeException(10006, "file: " + fileName + " - open for writing returned: " + strerror(errno));
+
+        std::ostringstream ss;
+        ss << "{\n"
+                  "  \"version\": \"1.9.0\",\n"
+                  "  \"memory\": {\"min-mb\": 64, \"max-mb\": 2048},\n"
+                  "  \"state\": {\"type\": \"disk\", \"path\": \"" << escapeJson(path) << "/checkpoint\"},\n"
+                  "  \"source\": [\n"
+                  "    {\n"
+                  "      \"alias\": \"S1\",\n"
+                  "      \"name\": \"BENCH\",\n"
+                  "      \"flags\": 2,\n"
+                  "      \"reader\": {\n"
+                  "        \"type\": \"batch\",\n"
+                  "        \"redo-log\": [\"" << escapeJson(path) << "/redo\"],\n"
+                  "        \"log-archive-format\": \"%t_%s_%r.arc\"\n"
+                  "      },\n"
+                  "      \"format\": {\"type\": \"" << format << "\"}\n"
+                  "    }\n"
+                  "  ],\n"
+                  "  \"target\": [\n"
+                  "    {\n"
+                  "      \"alias\": \"T1\",\n"
+                  "      \"source\": \"S1\",\n"
+                  "      \"writer\": {\"type\": \"discard\"}\n"
+                  "    }\n"
+                  "  ]\n"
+                  "}\n";
+        config << ss.str();
+        if (config.bad() || config.fail())
+            throw OpenLogReplicator::RuntimeException(10007, "file: " + fileName + " - 0 bytes written instead of " +
+                                                      std::to_string(ss.str().length()) + ", code returned: " + strerror(errno));
+        return fileName;
+    }
+
+    int mainFunction(int argc, char** argv) {
+        std::string fileName;
+        std::string generatePath;
+        std::string outputName;
+        std::string format = "json";
+        bool run = true;
+        OpenLogReplicator::RedoGenerator generator;
+
+        try {
+            for (int i = 1; i < argc; ++i) {
+                const std::string arg = argv[i];
+
+                if (arg == "")
+                    continue;
+
+                if (arg == "-n" || arg == "--no-run") {
+                    // Only generate the redo logs
+                    run = false;
+                    continue;
+                }
+
+                if (i + 1 < argc && parseOption(arg, argv[i + 1], fileName, generatePath, outputName, format, generator)) {
+                    ++i;
+                    continue;
+                }
+
+                throw OpenLogReplicator::ConfigurationException(30002, "invalid arguments, run: " + std::string(argv[0]) +
+                                                                " [-f|--file CONFIG] [-g|--generate DIR] [-n|--no-run] [-o|--output FILE] "
+                                                                "[--format json|protobuf] [--files N] [--transactions N] [--operations N] "
+                                                                "[--lwn N] [--tables N] [--columns N] [--rows-per-multi N] [--lob-size N] "
+                                                                "[--seed N] [--mix INSERT,UPDATE,DELETE,LOB,MULTI]");
+            }
+
+            if (fileName.empty() == generatePath.empty())
+                throw OpenLogReplicator::ConfigurationException(30002, "invalid arguments, exactly one of -f|--file CONFIG or "
+                                                                "-g|--generate DIR is required");
+
+            if (!generatePath.empty()) {
+                makeDirectory(generatePath);
+                makeDirectory(generatePath + "/redo");
+                makeDirectory(generatePath + "/checkpoint");
+                removeCheckpoints(generatePath + "/checkpoint");
+                generator.generate(generatePath + "/redo");
+                fileName = writeConfig(generatePath, format);
+                mainCtx->info(0, "generated " + std::to_string(generator.files) + " redo log files, " +
+                              std::to_string(generator.bytesWritten) + " bytes, config: " + fileName);
+            }
+        } catch (OpenLogReplicator::ConfigurationException& ex) {
+            mainCtx->error(ex.code, ex.msg);
+            return 1;
+        } catch (OpenLogReplicator::RuntimeException& ex) {
+            mainCtx->error(ex.code, ex.msg);
+            return 1;
+        }
+
+        if (!run)
+            return 0;
+
+        // Counters of the pipeline, the configuration may not define own metrics
+        auto* metrics = new OpenLogReplicator::MetricsBench();
+        mainCtx->metrics = metrics;
+
+        rusage usageStart{};
+        getrusage(RUSAGE_SELF, &usageStart);
+        const uint64_t allocationsStart = allocations.load(std::memory_order_relaxed);
+        const uint64_t allocatedBytesStart = allocatedBytes.load(std::memory_order_relaxed);
+        const auto timeStart = std::chrono::steady_clock::now();
+
+        int ret = 1;
+        {
+            // All threads are finished in the destructor
+            OpenLogReplicator::OpenLogReplicator openLogReplicator(fileName, mainCtx);
+            try {
+                ret = openLogReplicator.run();
+            } catch (OpenLogReplicator::ConfigurationException& ex) {
+                mainCtx->error(ex.code, ex.msg);
+                mainCtx->stopHard();
+            } catch (OpenLogReplicator::DataException& ex) {
+                mainCtx->error(ex.code, ex.msg);
+                mainCtx->stopHard();
+            } catch (OpenLogReplicator::RuntimeException& ex) {
+                mainCtx->error(ex.code, ex.msg);
+                mainCtx->stopHard();
+            } catch (std::bad_alloc& ex) {
+                mainCtx->error(10018, "memory allocation failed: " + std::string(ex.what()));
+                mainCtx->stopHard();
+            }
+        }
+
+        const auto timeEnd = std::chrono::steady_clock::now();
+        const uint64_t allocationsRun = allocations.load(std::memory_order_relaxed) - allocationsStart;
+        const uint64_t allocatedBytesRun = allocatedBytes.load(std::memory_order_relaxed) - allocatedBytesStart;
+        rusage usageEnd{};
+        getrusage(RUSAGE_SELF, &usageEnd);
+
+        if (mainCtx->metrics != metrics) {
+            mainCtx->error(30002, "benchmark requires configuration without \"metrics\" element");
+            delete metrics;
+            return 1;
+        }
+
+        const uint64_t elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(timeEnd - timeStart).count();
+        const uint64_t cpuUserUs = timevalUs(usageEnd.ru_utime) - timevalUs(usageStart.ru_utime);
+        const uint64_t cpuSystemUs = timevalUs(usageEnd.ru_stime) - timevalUs(usageStart.ru_stime);
+        const uint64_t rows = metrics->dmlOpsInsert + metrics->dmlOpsUpdate + metrics->dmlOpsDelete;
+        const double elapsedS = (elapsedUs > 0) ? static_cast<double>(elapsedUs) / 1000000.0 : 1.0;
+
+        // CPU time per thread type, the rest is used by the main thread
+        const std::map<std::string, uint64_t> threadCpuUs = mainCtx->getThreadCpuUs();
+        uint64_t threadsCpuUs = 0;
+        for (const auto& [name, cpuUs]: threadCpuUs)
+            threadsCpuUs += cpuUs;
+
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(3);
+        report << "{\"config\":\"" << escapeJson(fileName) << "\"" <<
+                ",\"status\":" << ret <<
+                ",\"elapsed-us\":" << elapsedUs <<
+                ",\"bytes-read\":" << metrics->bytesRead <<
+                ",\"bytes-parsed\":" << metrics->bytesParsed <<
+                ",\"mb-per-s\":" << (static_cast<double>(metrics->bytesParsed) / 1048576.0 / elapsedS) <<
+                ",\"rows\":" << rows <<
+                ",\"rows-insert\":" << metrics->dmlOpsInsert <<
+                ",\"rows-update\":" << metrics->dmlOpsUpdate <<
+                ",\"rows-delete\":" << metrics->dmlOpsDelete <<
+                ",\"rows-per-s\":" << (static_cast<double>(rows) / elapsedS) <<
+                ",\"transactions\":" << metrics->transactionsCommit <<
+                ",\"messages\":" << metrics->messagesSent <<
+                ",\"bytes-sent\":" << metrics->bytesSent <<
+                ",\"allocations\":" << allocationsRun <<
+                ",\"allocated-bytes\":" << allocatedBytesRun <<
+                ",\"cpu-user-us\":" << cpuUserUs <<
+                ",\"cpu-system-us\":" << cpuSystemUs <<
+                ",\"cpu-us\":{";
+        for (const auto& [name, cpuUs]: threadCpuUs)
+            report << "\"" << escapeJson(name) << "\":" << cpuUs << ",";
+        report << "\"Main\":" << ((cpuUserUs + cpuSystemUs > threadsCpuUs) ? cpuUserUs + cpuSystemUs - threadsCpuUs : 0) << "}" <<
+                ",\"max-rss-kb\":" << usageEnd.ru_maxrss <<
+                ",\"memory-hwm-mb\":" << mainCtx->getMemoryHWM();
+        if (!generatePath.empty()) {
+            using OP = OpenLogReplicator::RedoGenerator::OP;
+            report << ",\"generated\":{\"files\":" << generator.files <<
+                    ",\"bytes\":" << generator.bytesWritten <<
+                    ",\"transactions\":" << generator.transactionsGenerated <<
+                    ",\"rows-insert\":" << generator.rowsGenerated[static_cast<uint>(OP::INSERT)] <<
+                    ",\"rows-update\":" << generator.rowsGenerated[static_cast<uint>(OP::UPDATE)] <<
+                    ",\"rows-delete\":" << generator.rowsGenerated[static_cast<uint>(OP::DELETE)] <<
+                    ",\"rows-lob\":" << generator.rowsGenerated[static_cast<uint>(OP::LOB)] <<
+                    ",\"rows-multi\":" << generator.rowsGenerated[static_cast<uint>(OP::MULTI)] <<
+                    ",\"seed\":" << generator.seed << "}";
+        }
+        report << "}\n";
+
+        if (outputName.empty())
+            std::cout << report.str();
+        else {
+            std::ofstream output(outputName, std::ios::out | std::ios::trunc);
+            if (!output.is_open()) {
+                mainCtx->error(10006, "file: " + outputName + " - open for writing returned: " + strerror(errno));
+                return 1;
+            }
+            output << report.str();
+            if (output.bad() || output.fail()) {
+                mainCtx->error(10007, "file: " + outputName + " - 0 bytes written instead of " + std::to_string(report.str().length()) +
+                               ", code returned: " + strerror(errno));
+                return 1;
+            }
+        }
+
+        return ret;
+    }
+}
+
+int main(int argc, char** argv) {
+    OpenLogReplicator::Ctx ctx;
+    mainCtx = &ctx;
+    signal(SIGINT, signalHandler);
+    signal(SIGPIPE, signalHandler);
+    signal(SIGSEGV, signalCrash);
+
+    const char* logTimezone = std::getenv("OLR_LOG_TIMEZONE");
+    if (logTimezone != nullptr)
+        if (!OpenLogReplicator::Data::parseTimezone(logTimezone, ctx.logTimezone))
+            ctx.warning(10070, "invalid environment variable OLR_LOG_TIMEZONE value: " + std::string(logTimezone));
+
+    std::string olrLocales;
+    const char* olrLocalesStr = getenv("OLR_LOCALES");
+    if (olrLocalesStr != nullptr)
+        olrLocales = olrLocalesStr;
+    if (olrLocales == "MOCK")
+        OLR_LOCALES = OpenLogReplicator::Ctx::LOCALES::MOCK;
+
+    const int ret = mainFunction(argc, argv);
+
+    signal(SIGINT, nullptr);
+    signal(SIGPIPE, nullptr);
+    signal(SIGSEGV, nullptr);
+    mainCtx = nullptr;
+
+    return ret;
+}
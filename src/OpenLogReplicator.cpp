@@ -39,12 +39,15 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <cerrno>
 #include <fcntl.h>
 #include <regex>
+#include <set>
 #include <sys/file.h>
 #include <sys/stat.h>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <unistd.h>
 
+#include "builder/BuilderArrow.h"
 #include "builder/BuilderJson.h"
 #include "common/Ctx.h"
 #include "common/MemoryManager.h"
@@ -58,11 +61,13 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "metadata/Checkpoint.h"
 #include "metadata/Metadata.h"
 #include "metadata/SchemaElement.h"
+#include "metadata/SerializerBinary.h"
 #include "metadata/SerializerJson.h"
 #include "parser/TransactionBuffer.h"
 #include "replicator/Replicator.h"
 #include "replicator/ReplicatorBatch.h"
 #include "state/StateDisk.h"
+#include "state/StateLog.h"
 #include "writer/WriterDiscard.h"
 #include "writer/WriterFile.h"
 #include "OpenLogReplicator.h"
@@ -239,6 +244,7 @@ namespace OpenLogReplicator {
         uint64_t memoryMaxMb = 2048;
         uint64_t memoryReadBufferMaxMb = 128;
         uint64_t memoryReadBufferMinMb = 4;
+        uint64_t memoryReadAheadMb = 0;
         uint64_t memorySwapMb = memoryMaxMb * 3 / 4;
         std::string memorySwapPath{"."};
         uint64_t memoryUnswapBufferMinMb = 4;
@@ -252,6 +258,7 @@ namespace OpenLogReplicator {
                 static const std::vector<std::string> memoryNames{
                     "max-mb",
                     "min-mb",
+                    "read-ahead-mb",
                     "read-buffer-max-mb",
                     "read-buffer-min-mb",
                     "swap-mb",
@@ -321,6 +328,15 @@ namespace OpenLogReplicator {
                                                  std::to_string(memoryReadBufferMinMb) + ")");
             }
 
+            if (memoryJson.HasMember("read-ahead-mb")) {
+                memoryReadAheadMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "read-ahead-mb");
+                memoryReadAheadMb = (memoryReadAheadMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                if (memoryReadAheadMb > memoryReadBufferMaxMb / 2)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"read-ahead-mb\" value: " + std::to_string(memoryReadAheadMb) +
+                                                 ", expected: not greater than half of \"read-buffer-max-mb\" value (" +
+                                                 std::to_string(memoryReadBufferMaxMb / 2) + ")");
+            }
+
             if (memoryJson.HasMember("write-buffer-min-mb")) {
                 memoryWriteBufferMinMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "write-buffer-min-mb");
                 memoryWriteBufferMinMb = (memoryWriteBufferMinMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
@@ -359,6 +375,7 @@ namespace OpenLogReplicator {
         // MEMORY MANAGER
         ctx->initialize(memoryMinMb, memoryMaxMb, memoryReadBufferMaxMb, memoryReadBufferMinMb, memorySwapMb, memoryUnswapBufferMinMb,
                         memoryWriteBufferMaxMb, memoryWriteBufferMinMb);
+        ctx->bufferSizeReadAhead = memoryReadAheadMb * 1024 * 1024;
 
         // METRICS
         if (document.HasMember("metrics")) {
@@ -368,6 +385,7 @@ namespace OpenLogReplicator {
                 static const std::vector<std::string> metricsNames{
                     "bind",
                     "tag-names",
+                    "thread-stats-interval-s",
                     "type"
                 };
                 Ctx::checkJsonFields(configFileName, metricsJson, metricsNames);
@@ -409,23 +427,39 @@ namespace OpenLogReplicator {
                 } else {
                     throw ConfigurationException(30001, R"(bad JSON, invalid "type" value: ")" + metricsType + R"(", expected: one of {"prometheus"})");
                 }
+
+                if (metricsJson.HasMember("thread-stats-interval-s")) {
+                    const uint64_t threadStatsIntervalS = Ctx::getJsonFieldU64(configFileName, metricsJson, "thread-stats-interval-s");
+                    if (threadStatsIntervalS > 3600)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"thread-stats-interval-s\" value: " +
+                                                     std::to_string(threadStatsIntervalS) + ", expected: one of {0 .. 3600}");
+                    if (threadStatsIntervalS > 0)
+                        ctx->enableThreadStats(threadStatsIntervalS * 1000000);
+                }
             }
         }
 
         // STATE
         uint64_t stateType = State::TYPE_DISK;
         std::string statePath = "checkpoint";
+        uint64_t stateSegmentMb = 64;
+        uint64_t stateSyncMs = 5;
+        Serializer::FORMAT stateFormat = Serializer::FORMAT::JSON;
 
         if (document.HasMember("state")) {
             const rapidjson::Value& stateJson = Ctx::getJsonFieldO(configFileName, document, "state");
 
             if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> stateNames{
+                    "format",
                     "interval-mb",
                     "interval-s",
                     "keep-checkpoints",
                     "path",
+                    "schema-delta-max",
                     "schema-force-interval",
+                    "segment-mb",
+                    "sync-ms",
                     "type"
                 };
                 Ctx::checkJsonFields(configFileName, stateJson, stateNames);
@@ -437,8 +471,38 @@ namespace OpenLogReplicator {
                     stateType = State::TYPE_DISK;
                     if (stateJson.HasMember("path"))
                         statePath = Ctx::getJsonFieldS(configFileName, Ctx::MAX_PATH_LENGTH, stateJson, "path");
+                } else if (stateTypeStr == "log") {
+                    stateType = State::TYPE_LOG;
+                    if (stateJson.HasMember("path"))
+                        statePath = Ctx::getJsonFieldS(configFileName, Ctx::MAX_PATH_LENGTH, stateJson, "path");
+
+                    if (stateJson.HasMember("segment-mb")) {
+                        stateSegmentMb = Ctx::getJsonFieldU64(configFileName, stateJson, "segment-mb");
+                        if (stateSegmentMb < 1 || stateSegmentMb > 4096)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"segment-mb\" value: " + std::to_string(stateSegmentMb) +
+                                                         ", expected: one of {1 .. 4096}");
+                    }
+
+                    if (stateJson.HasMember("sync-ms")) {
+                        stateSyncMs = Ctx::getJsonFieldU64(configFileName, stateJson, "sync-ms");
+                        if (stateSyncMs > 1000)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"sync-ms\" value: " + std::to_string(stateSyncMs) +
+                                                         ", expected: one of {0 .. 1000}");
+                    }
                 } else
-                    throw ConfigurationException(30001, std::string("bad JSON, invalid \"type\" value: ") + stateTypeStr + ", expected: one of {\"disk\"}");
+                    throw ConfigurationException(30001, std::string("bad JSON, invalid \"type\" value: ") + stateTypeStr +
+                                                 ", expected: one of {\"disk\", \"log\"}");
+            }
+
+            if (stateJson.HasMember("format")) {
+                const std::string stateFormatStr = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, stateJson, "format");
+                if (stateFormatStr == "json")
+                    stateFormat = Serializer::FORMAT::JSON;
+                else if (stateFormatStr == "binary")
+                    stateFormat = Serializer::FORMAT::BINARY;
+                else
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + stateFormatStr +
+                                                 ", expected: one of {\"json\", \"binary\"}");
             }
 
             if (stateJson.HasMember("interval-s"))
@@ -452,14 +516,19 @@ namespace OpenLogReplicator {
 
             if (stateJson.HasMember("schema-force-interval"))
                 ctx->schemaForceInterval = Ctx::getJsonFieldU64(configFileName, stateJson, "schema-force-interval");
+
+            if (stateJson.HasMember("schema-delta-max"))
+                ctx->schemaDeltaMax = Ctx::getJsonFieldU64(configFileName, stateJson, "schema-delta-max");
         }
 
         // Iterate through sources
         const rapidjson::Value& sourceArrayJson = Ctx::getJsonFieldA(configFileName, document, "source");
-        if (sourceArrayJson.Size() != 1) {
+        if (sourceArrayJson.Size() < 1) {
             throw ConfigurationException(30001, "bad JSON, invalid \"source\" value: " + std::to_string(sourceArrayJson.Size()) +
-                                         " elements, expected: 1 element");
+                                         " elements, expected: at least 1 element");
         }
+        std::set<std::string> sourceAliases;
+        uint64_t sourcesBufferMinMb = 0;
 
         for (rapidjson::SizeType j = 0; j < sourceArrayJson.Size(); ++j) {
             const rapidjson::Value& sourceJson = Ctx::getJsonFieldO(configFileName, sourceArrayJson, "source", j);
@@ -477,6 +546,7 @@ namespace OpenLogReplicator {
                     "memory",
                     "name",
                     "reader",
+                    "redo-read-sleep-min-us",
                     "redo-read-sleep-us",
                     "redo-verify-delay-us",
                     "refresh-interval-us",
@@ -487,13 +557,130 @@ namespace OpenLogReplicator {
             }
 
             const std::string alias = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, sourceJson, "alias");
+            if (!sourceAliases.insert(alias).second)
+                throw ConfigurationException(30001, "bad JSON, invalid \"alias\" value: " + alias + ", expected: unique value");
             ctx->info(0, "adding source: " + alias);
 
+            // Many sources share the memory pool, each of them replicates with own context, memory quota and buffers
+            Ctx* sourceCtx = ctx;
+            std::string sourceSwapPath = memorySwapPath;
+            if (sourceArrayJson.Size() > 1) {
+                uint64_t sourceMaxMb = memoryMaxMb;
+                uint64_t sourceReadBufferMaxMb = memoryReadBufferMaxMb;
+                uint64_t sourceReadBufferMinMb = memoryReadBufferMinMb;
+                uint64_t sourceSwapMb = memorySwapMb;
+                uint64_t sourceUnswapBufferMinMb = memoryUnswapBufferMinMb;
+                uint64_t sourceWriteBufferMaxMb = memoryWriteBufferMaxMb;
+                uint64_t sourceWriteBufferMinMb = memoryWriteBufferMinMb;
+
+                if (sourceJson.HasMember("memory")) {
+                    const rapidjson::Value& memoryJson = Ctx::getJsonFieldO(configFileName, sourceJson, "memory");
+
+                    if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                        static const std::vector<std::string> sourceMemoryNames{
+                            "max-mb",
+                            "read-buffer-max-mb",
+                            "read-buffer-min-mb",
+                            "swap-mb",
+                            "unswap-buffer-min-mb",
+                            "write-buffer-max-mb",
+                            "write-buffer-min-mb"
+                        };
+                        Ctx::checkJsonFields(configFileName, memoryJson, sourceMemoryNames);
+                    }
+
+                    if (memoryJson.HasMember("max-mb")) {
+                        sourceMaxMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "max-mb");
+                        sourceMaxMb = (sourceMaxMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                        if (sourceMaxMb > memoryMaxMb || sourceMaxMb < 4)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"max-mb\" value: " + std::to_string(sourceMaxMb) +
+                                                         ", expected: one of {4 .. " + std::to_string(memoryMaxMb) + "}");
+
+                        sourceReadBufferMaxMb = std::min<uint64_t>(sourceMaxMb / 8, memoryReadBufferMaxMb);
+                        sourceReadBufferMinMb = std::min<uint64_t>(sourceReadBufferMinMb, sourceReadBufferMaxMb);
+                        sourceWriteBufferMaxMb = std::min<uint64_t>(sourceMaxMb, memoryWriteBufferMaxMb);
+                        sourceWriteBufferMinMb = std::min<uint64_t>(sourceWriteBufferMinMb, sourceWriteBufferMaxMb);
+                        sourceSwapMb = memorySwapMb == 0 ? 0 : sourceMaxMb * 3 / 4;
+                    }
+
+                    if (memoryJson.HasMember("unswap-buffer-min-mb")) {
+                        sourceUnswapBufferMinMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "unswap-buffer-min-mb");
+                        sourceUnswapBufferMinMb = (sourceUnswapBufferMinMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                    }
+
+                    if (memoryJson.HasMember("swap-mb")) {
+                        sourceSwapMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "swap-mb");
+                        sourceSwapMb = (sourceSwapMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                        if (sourceSwapMb > sourceMaxMb)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"swap-mb\" value: " + std::to_string(sourceSwapMb) +
+                                                         ", expected: not greater than \"max-mb\" value (" + std::to_string(sourceMaxMb) + ")");
+                    }
+
+                    // Minimal buffers of a source can be lower than 4MB, they are reserved in the pool for every source
+                    if (memoryJson.HasMember("read-buffer-min-mb")) {
+                        sourceReadBufferMinMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "read-buffer-min-mb");
+                        sourceReadBufferMinMb = (sourceReadBufferMinMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                        if (sourceReadBufferMinMb > sourceMaxMb || sourceReadBufferMinMb < Ctx::MEMORY_CHUNK_SIZE_MB)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"read-buffer-min-mb\" value: " +
+                                                         std::to_string(sourceReadBufferMinMb) + ", expected: one of {" +
+                                                         std::to_string(Ctx::MEMORY_CHUNK_SIZE_MB) + " .. " + std::to_string(sourceMaxMb) + "}");
+                    }
+
+                    if (memoryJson.HasMember("read-buffer-max-mb")) {
+                        sourceReadBufferMaxMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "read-buffer-max-mb");
+                        sourceReadBufferMaxMb = (sourceReadBufferMaxMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                        if (sourceReadBufferMaxMb > sourceMaxMb)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"read-buffer-max-mb\" value: " +
+                                                         std::to_string(sourceReadBufferMaxMb) +
+                                                         ", expected: not greater than \"max-mb\" value (" + std::to_string(sourceMaxMb) + ")");
+                    }
+
+                    if (memoryJson.HasMember("write-buffer-min-mb")) {
+                        sourceWriteBufferMinMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "write-buffer-min-mb");
+                        sourceWriteBufferMinMb = (sourceWriteBufferMinMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                        if (sourceWriteBufferMinMb > sourceMaxMb || sourceWriteBufferMinMb < Ctx::MEMORY_CHUNK_SIZE_MB)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"write-buffer-min-mb\" value: " +
+                                                         std::to_string(sourceWriteBufferMinMb) + ", expected: one of {" +
+                                                         std::to_string(Ctx::MEMORY_CHUNK_SIZE_MB) + " .. " + std::to_string(sourceMaxMb) + "}");
+                    }
+
+                    if (memoryJson.HasMember("write-buffer-max-mb")) {
+                        sourceWriteBufferMaxMb = Ctx::getJsonFieldU64(configFileName, memoryJson, "write-buffer-max-mb");
+                        sourceWriteBufferMaxMb = (sourceWriteBufferMaxMb / Ctx::MEMORY_CHUNK_SIZE_MB) * Ctx::MEMORY_CHUNK_SIZE_MB;
+                        if (sourceWriteBufferMaxMb > sourceMaxMb)
+                            throw ConfigurationException(30001, "bad JSON, invalid \"write-buffer-max-mb\" value: " +
+                                                         std::to_string(sourceWriteBufferMaxMb) +
+                                                         ", expected: not greater than \"max-mb\" value (" + std::to_string(sourceMaxMb) + ")");
+                    }
+                }
+
+                if (sourceReadBufferMaxMb < sourceReadBufferMinMb)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"read-buffer-max-mb\" value: " +
+                                                 std::to_string(sourceReadBufferMaxMb) + ", expected: at least: \"read-buffer-min-mb\" value (" +
+                                                 std::to_string(sourceReadBufferMinMb) + ")");
+                if (sourceWriteBufferMaxMb < sourceWriteBufferMinMb)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"write-buffer-max-mb\" value: " +
+                                                 std::to_string(sourceWriteBufferMaxMb) + ", expected: at least: \"write-buffer-min-mb\" value (" +
+                                                 std::to_string(sourceWriteBufferMinMb) + ")");
+                sourcesBufferMinMb += sourceReadBufferMinMb + sourceWriteBufferMinMb + sourceUnswapBufferMinMb;
+
+                // Swap files of each source are kept apart, the memory manager removes unknown swap files at startup
+                if (sourceSwapMb > 0) {
+                    sourceSwapPath = memorySwapPath + "/" + alias;
+                    if (mkdir(sourceSwapPath.c_str(), 0755) != 0 && errno != EEXIST)
+                        throw RuntimeException(10006, "file: " + sourceSwapPath + " - open for writing returned: " + strerror(errno));
+                }
+
+                sourceCtx = ctx->addSource(alias, sourceMaxMb, sourceReadBufferMaxMb, sourceReadBufferMinMb, sourceSwapMb, sourceUnswapBufferMinMb,
+                                           sourceWriteBufferMaxMb, sourceWriteBufferMinMb);
+            }
+
             const std::string name = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, sourceJson, "name");
             const rapidjson::Value& readerJson = Ctx::getJsonFieldO(configFileName, sourceJson, "reader");
 
-            if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+            if (!sourceCtx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> readerNames {
+                    "catch-up-threads",
                     "db-timezone",
                     "disable-checks",
                     "host-timezone",
@@ -503,6 +690,7 @@ namespace OpenLogReplicator {
                     "path-mapping",
                     "redo-copy-path",
                     "redo-log",
+                    "redo-threads",
                     "server",
                     "start-scn",
                     "start-seq",
@@ -515,19 +703,19 @@ namespace OpenLogReplicator {
             }
 
             if (sourceJson.HasMember("flags")) {
-                ctx->flags = Ctx::getJsonFieldU64(configFileName, sourceJson, "flags");
-                if (ctx->flags > 524287)
-                    throw ConfigurationException(30001, "bad JSON, invalid \"flags\" value: " + std::to_string(ctx->flags) +
-                                                 ", expected: one of {0 .. 524287}");
-                if (ctx->isFlagSet(Ctx::REDO_FLAGS::DIRECT_DISABLE))
-                    ctx->redoVerifyDelayUs = 500000;
+                sourceCtx->flags = Ctx::getJsonFieldU64(configFileName, sourceJson, "flags");
+                if (sourceCtx->flags > 1048575)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"flags\" value: " + std::to_string(sourceCtx->flags) +
+                                                 ", expected: one of {0 .. 1048575}");
+                if (sourceCtx->isFlagSet(Ctx::REDO_FLAGS::DIRECT_DISABLE))
+                    sourceCtx->redoVerifyDelayUs = 500000;
             }
 
             if (readerJson.HasMember("disable-checks")) {
-                ctx->disableChecks = Ctx::getJsonFieldU64(configFileName, readerJson, "disable-checks");
-                if (ctx->disableChecks > 15)
+                sourceCtx->disableChecks = Ctx::getJsonFieldU64(configFileName, readerJson, "disable-checks");
+                if (sourceCtx->disableChecks > 15)
                     throw ConfigurationException(30001, "bad JSON, invalid \"disable-checks\" value: " +
-                                                 std::to_string(ctx->disableChecks) + ", expected: one of {0 .. 15}");
+                                                 std::to_string(sourceCtx->disableChecks) + ", expected: one of {0 .. 15}");
             }
 
             Scn startScn = Scn::none();
@@ -564,7 +752,7 @@ namespace OpenLogReplicator {
             if (sourceJson.HasMember("debug")) {
                 const rapidjson::Value& debugJson = Ctx::getJsonFieldO(configFileName, sourceJson, "debug");
 
-                if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                if (!sourceCtx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                     static const std::vector<std::string> debugNames{
                         "owner",
                         "stop-checkpoints",
@@ -576,24 +764,24 @@ namespace OpenLogReplicator {
                 }
 
                 if (debugJson.HasMember("stop-log-switches")) {
-                    ctx->stopLogSwitches = Ctx::getJsonFieldU64(configFileName, debugJson, "stop-log-switches");
-                    ctx->info(0, "will shutdown after " + std::to_string(ctx->stopLogSwitches) + " log switches");
+                    sourceCtx->stopLogSwitches = Ctx::getJsonFieldU64(configFileName, debugJson, "stop-log-switches");
+                    sourceCtx->info(0, "will shutdown after " + std::to_string(sourceCtx->stopLogSwitches) + " log switches");
                 }
 
                 if (debugJson.HasMember("stop-checkpoints")) {
-                    ctx->stopCheckpoints = Ctx::getJsonFieldU64(configFileName, debugJson, "stop-checkpoints");
-                    ctx->info(0, "will shutdown after " + std::to_string(ctx->stopCheckpoints) + " checkpoints");
+                    sourceCtx->stopCheckpoints = Ctx::getJsonFieldU64(configFileName, debugJson, "stop-checkpoints");
+                    sourceCtx->info(0, "will shutdown after " + std::to_string(sourceCtx->stopCheckpoints) + " checkpoints");
                 }
 
                 if (debugJson.HasMember("stop-transactions")) {
-                    ctx->stopTransactions = Ctx::getJsonFieldU64(configFileName, debugJson, "stop-transactions");
-                    ctx->info(0, "will shutdown after " + std::to_string(ctx->stopTransactions) + " transactions");
+                    sourceCtx->stopTransactions = Ctx::getJsonFieldU64(configFileName, debugJson, "stop-transactions");
+                    sourceCtx->info(0, "will shutdown after " + std::to_string(sourceCtx->stopTransactions) + " transactions");
                 }
 
-                if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && (debugJson.HasMember("owner") || debugJson.HasMember("table"))) {
+                if (!sourceCtx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && (debugJson.HasMember("owner") || debugJson.HasMember("table"))) {
                     debugOwner = Ctx::getJsonFieldS(configFileName, SysUser::NAME_LENGTH, debugJson, "owner");
                     debugTable = Ctx::getJsonFieldS(configFileName, SysObj::NAME_LENGTH, debugJson, "table");
-                    ctx->info(0, "will shutdown after committed DML in " + debugOwner + "." + debugTable);
+                    sourceCtx->info(0, "will shutdown after committed DML in " + debugOwner + "." + debugTable);
                 }
             }
 
@@ -602,11 +790,11 @@ namespace OpenLogReplicator {
                 if (transactionMaxMb > memoryMaxMb)
                     throw ConfigurationException(30001, "bad JSON, invalid \"transaction-max-mb\" value: " + std::to_string(transactionMaxMb) +
                                                  ", expected: smaller than \"max-mb\" (" + std::to_string(memoryMaxMb) + ")");
-                ctx->transactionSizeMax = transactionMaxMb * 1024 * 1024;
+                sourceCtx->transactionSizeMax = transactionMaxMb * 1024 * 1024;
             }
 
             // METADATA
-            auto* metadata = new Metadata(ctx, locales, name, startScn, startSequence, startTime, startTimeRel);
+            auto* metadata = new Metadata(sourceCtx, locales, name, startScn, startSequence, startTime, startTimeRel);
             metadatas.push_back(metadata);
             metadata->resetElements();
             if (!debugOwner.empty())
@@ -614,42 +802,49 @@ namespace OpenLogReplicator {
 
             if (!debugOwner.empty() && !debugTable.empty())
                 metadata->addElement(debugOwner, debugTable, DbTable::OPTIONS::DEBUG_TABLE);
-            if (ctx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA))
+            if (sourceCtx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA))
                 metadata->addElement(".*", ".*", DbTable::OPTIONS::DEFAULT);
 
-            if (stateType == State::TYPE_DISK) {
-                metadata->state = new StateDisk(ctx, statePath);
-                metadata->stateDisk = new StateDisk(ctx, "scripts");
+            if (stateType == State::TYPE_DISK)
+                metadata->state = new StateDisk(sourceCtx, statePath);
+            else
+                metadata->state = new StateLog(sourceCtx, statePath, name + "-state", stateSegmentMb * 1024 * 1024, stateSyncMs);
+            metadata->stateDisk = new StateDisk(sourceCtx, "scripts");
+            if (stateFormat == Serializer::FORMAT::BINARY)
+                metadata->serializer = new SerializerBinary();
+            else
                 metadata->serializer = new SerializerJson();
-            }
 
             // CHECKPOINT
-            auto* checkpoint = new Checkpoint(ctx, metadata, alias + "-checkpoint", configFileName, configFileStat.st_mtime);
+            auto* checkpoint = new Checkpoint(sourceCtx, metadata, alias + "-checkpoint", configFileName, configFileStat.st_mtime);
             checkpoints.push_back(checkpoint);
-            ctx->spawnThread(checkpoint);
+            sourceCtx->spawnThread(checkpoint);
 
             // MEMORY MANAGER
-            auto* memoryManager = new MemoryManager(ctx, alias + "-memory-manager", memorySwapPath);
+            auto* memoryManager = new MemoryManager(sourceCtx, alias + "-memory-manager", sourceSwapPath);
             memoryManager->initialize();
             memoryManagers.push_back(memoryManager);
-            ctx->spawnThread(memoryManager);
+            sourceCtx->spawnThread(memoryManager);
 
             // TRANSACTION BUFFER
-            auto* transactionBuffer = new TransactionBuffer(ctx);
+            auto* transactionBuffer = new TransactionBuffer(sourceCtx);
             transactionBuffers.push_back(transactionBuffer);
 
             // FORMAT
             const rapidjson::Value& formatJson = Ctx::getJsonFieldO(configFileName, sourceJson, "format");
 
-            if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+            if (!sourceCtx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> formatNames{
                     "attributes",
+                    "batch-rows",
+                    "batch-size",
                     "char",
                     "column",
                     "db",
                     "flush-buffer",
                     "interval-dts",
                     "interval-ytm",
+                    "lob-chunk-size",
                     "message",
                     "rid",
                     "redo-thread",
@@ -737,8 +932,8 @@ namespace OpenLogReplicator {
 
             if (formatJson.HasMember("message")) {
                 const uint val = Ctx::getJsonFieldU(configFileName, formatJson, "message");
-                if (val > 31)
-                    throw ConfigurationException(30001, "bad JSON, invalid \"message\" value: " + std::to_string(val) + ", expected: one of {0 .. 31}");
+                if (val > 63)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"message\" value: " + std::to_string(val) + ", expected: one of {0 .. 63}");
                 if ((val & static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) != 0 &&
                         (val & (static_cast<uint>(Format::MESSAGE_FORMAT::SKIP_BEGIN) |
                         static_cast<uint>(Format::MESSAGE_FORMAT::SKIP_COMMIT))) != 0)
@@ -748,6 +943,11 @@ namespace OpenLogReplicator {
                                                  "/" + std::to_string(static_cast<uint>(Format::MESSAGE_FORMAT::SKIP_COMMIT)) +
                                                  ") together with FULL mode (" +
                                                  std::to_string(static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) + ")");
+                if ((val & static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) != 0 && (val & static_cast<uint>(Format::MESSAGE_FORMAT::BATCH)) != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"message\" value: " + std::to_string(val) +
+                                                 ", expected: BATCH mode (" + std::to_string(static_cast<uint>(Format::MESSAGE_FORMAT::BATCH)) +
+                                                 ") is unset together with FULL mode (" +
+                                                 std::to_string(static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) + ")");
                 messageFormat = static_cast<Format::MESSAGE_FORMAT>(val);
             }
 
@@ -847,9 +1047,9 @@ namespace OpenLogReplicator {
                 if (val > 2)
                     throw ConfigurationException(30001, "bad JSON, invalid \"column\" value: " + std::to_string(val) + ", expected: one of {0 .. 2}");
 
-                if (ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && val != 0)
+                if (sourceCtx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && val != 0)
                     throw ConfigurationException(30001, "bad JSON, invalid \"column\" value: " + std::to_string(val) +
-                                                 ", expected: not used when flags has set schemaless mode (flags: " + std::to_string(ctx->flags) + ")");
+                                                 ", expected: not used when flags has set schemaless mode (flags: " + std::to_string(sourceCtx->flags) + ")");
                 columnFormat = static_cast<Format::COLUMN_FORMAT>(val);
             }
 
@@ -864,22 +1064,66 @@ namespace OpenLogReplicator {
             if (formatJson.HasMember("flush-buffer"))
                 flushBuffer = Ctx::getJsonFieldU64(configFileName, formatJson, "flush-buffer");
 
+            uint64_t lobChunkSize = 0;
+            if (formatJson.HasMember("lob-chunk-size")) {
+                lobChunkSize = Ctx::getJsonFieldU64(configFileName, formatJson, "lob-chunk-size");
+                if (lobChunkSize != 0 && (lobChunkSize < 1024 || lobChunkSize > 1073741824))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"lob-chunk-size\" value: " + std::to_string(lobChunkSize) +
+                                                 ", expected: 0 or one of {1024 .. 1073741824}");
+                if (lobChunkSize != 0 && (static_cast<uint>(messageFormat) & static_cast<uint>(Format::MESSAGE_FORMAT::FULL)) != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"lob-chunk-size\" value: " + std::to_string(lobChunkSize) +
+                                                 ", expected: 0 together with FULL mode of \"message\"");
+                if (lobChunkSize != 0 && (static_cast<uint>(messageFormat) & static_cast<uint>(Format::MESSAGE_FORMAT::BATCH)) != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"lob-chunk-size\" value: " + std::to_string(lobChunkSize) +
+                                                 ", expected: 0 together with BATCH mode of \"message\"");
+            }
+
+            uint64_t batchRows = 1000;
+            if (formatJson.HasMember("batch-rows")) {
+                batchRows = Ctx::getJsonFieldU64(configFileName, formatJson, "batch-rows");
+                if (batchRows < 1 || batchRows > 1000000)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"batch-rows\" value: " + std::to_string(batchRows) +
+                                                 ", expected: one of {1 .. 1000000}");
+            }
+
+            uint64_t batchSize = 1048576;
+            if (formatJson.HasMember("batch-size")) {
+                batchSize = Ctx::getJsonFieldU64(configFileName, formatJson, "batch-size");
+                if (batchSize < 1024 || batchSize > 1073741824)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"batch-size\" value: " + std::to_string(batchSize) +
+                                                 ", expected: one of {1024 .. 1073741824}");
+            }
+
 
             Builder* builder;
             Format format(dbFormat, attributesFormat, intervalDtsFormat, intervalYtmFormat, messageFormat, ridFormat, redoThreadFormat, xidFormat,
                 timestampFormat, timestampMetadataFormat, timestampTzFormat, timestampType, charFormat, scnFormat, scnType, unknownFormat,
                 schemaFormat, columnFormat, unknownType, userType);
             if (formatType == "json" || formatType == "debezium") {
-                builder = new BuilderJson(ctx, locales, metadata, format, flushBuffer);
+                builder = new BuilderJson(sourceCtx, locales, metadata, format, flushBuffer);
+                builder->setLobChunkSize(lobChunkSize);
+                builder->setBatchLimits(batchRows, batchSize);
             } else if (formatType == "protobuf") {
 #ifdef LINK_LIBRARY_PROTOBUF
-                builder = new BuilderProtobuf(ctx, locales, metadata, format, flushBuffer);
+                if (lobChunkSize != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"lob-chunk-size\" value: " + std::to_string(lobChunkSize) +
+                                                 ", expected: 0 for \"protobuf\" format");
+                builder = new BuilderProtobuf(sourceCtx, locales, metadata, format, flushBuffer);
 #else
                 throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
                                              ", expected: not \"protobuf\" since the code is not compiled");
 #endif /* LINK_LIBRARY_PROTOBUF */
+            } else if (formatType == "arrow") {
+                if (lobChunkSize != 0)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"lob-chunk-size\" value: " + std::to_string(lobChunkSize) +
+                                                 ", expected: 0 for \"arrow\" format");
+                if (sourceCtx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                                 ", expected: not \"arrow\" together with schemaless mode");
+                builder = new BuilderArrow(sourceCtx, locales, metadata, format, flushBuffer);
             } else
-                throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType + R"(, expected: "protobuf", "json" or "debezium")");
+                throw ConfigurationException(30001, "bad JSON, invalid \"format\" value: " + formatType +
+                                             R"(, expected: "protobuf", "arrow", "json" or "debezium")");
             builders.push_back(builder);
 
             // READER
@@ -887,42 +1131,50 @@ namespace OpenLogReplicator {
             void(*archGetLog)(Replicator * replicator) = Replicator::archGetLogPath;
 
             if (sourceJson.HasMember("redo-read-sleep-us"))
-                ctx->redoReadSleepUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "redo-read-sleep-us");
+                sourceCtx->redoReadSleepUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "redo-read-sleep-us");
+
+            if (sourceJson.HasMember("redo-read-sleep-min-us")) {
+                sourceCtx->redoReadSleepMinUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "redo-read-sleep-min-us");
+                if (unlikely(sourceCtx->redoReadSleepMinUs > sourceCtx->redoReadSleepUs))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"redo-read-sleep-min-us\" value: " +
+                                                 std::to_string(sourceCtx->redoReadSleepMinUs) + ", expected: one of {0 .. " +
+                                                 std::to_string(sourceCtx->redoReadSleepUs) + "}");
+            }
 
             if (sourceJson.HasMember("arch-read-sleep-us"))
-                ctx->archReadSleepUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "arch-read-sleep-us");
+                sourceCtx->archReadSleepUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "arch-read-sleep-us");
 
             if (sourceJson.HasMember("arch-read-tries")) {
-                ctx->archReadTries = Ctx::getJsonFieldU(configFileName, sourceJson, "arch-read-tries");
-                if (ctx->archReadTries < 1 || ctx->archReadTries > 1000000000)
+                sourceCtx->archReadTries = Ctx::getJsonFieldU(configFileName, sourceJson, "arch-read-tries");
+                if (sourceCtx->archReadTries < 1 || sourceCtx->archReadTries > 1000000000)
                     throw ConfigurationException(30001, "bad JSON, invalid \"arch-read-tries\" value: " +
-                                                 std::to_string(ctx->archReadTries) + ", expected: one of: {1 .. 1000000000}");
+                                                 std::to_string(sourceCtx->archReadTries) + ", expected: one of: {1 .. 1000000000}");
             }
 
             if (sourceJson.HasMember("redo-verify-delay-us"))
-                ctx->redoVerifyDelayUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "redo-verify-delay-us");
+                sourceCtx->redoVerifyDelayUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "redo-verify-delay-us");
 
             if (sourceJson.HasMember("refresh-interval-us"))
-                ctx->refreshIntervalUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "refresh-interval-us");
+                sourceCtx->refreshIntervalUs = Ctx::getJsonFieldU64(configFileName, sourceJson, "refresh-interval-us");
 
             if (readerJson.HasMember("redo-copy-path"))
-                ctx->redoCopyPath = Ctx::getJsonFieldS(configFileName, Ctx::MAX_PATH_LENGTH, readerJson, "redo-copy-path");
+                sourceCtx->redoCopyPath = Ctx::getJsonFieldS(configFileName, Ctx::MAX_PATH_LENGTH, readerJson, "redo-copy-path");
 
             if (readerJson.HasMember("db-timezone")) {
                 const std::string dbTimezone = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, readerJson, "db-timezone");
-                if (!Data::parseTimezone(dbTimezone, ctx->dbTimezone))
+                if (!Data::parseTimezone(dbTimezone, sourceCtx->dbTimezone))
                     throw ConfigurationException(30001, "bad JSON, invalid \"db-timezone\" value: " + dbTimezone + ", expected value: {\"+/-HH:MM\"}");
             }
 
             if (readerJson.HasMember("host-timezone")) {
                 const std::string hostTimezone = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, readerJson, "host-timezone");
-                if (!Data::parseTimezone(hostTimezone, ctx->hostTimezone))
+                if (!Data::parseTimezone(hostTimezone, sourceCtx->hostTimezone))
                     throw ConfigurationException(30001, "bad JSON, invalid \"host-timezone\" value: " + hostTimezone + ", expected value: {\"+/-HH:MM\"}");
             }
 
             if (readerJson.HasMember("log-timezone")) {
                 const std::string logTimezone = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, readerJson, "log-timezone");
-                if (!Data::parseTimezone(logTimezone, ctx->logTimezone))
+                if (!Data::parseTimezone(logTimezone, sourceCtx->logTimezone))
                     throw ConfigurationException(30001, "bad JSON, invalid \"log-timezone\" value: " + logTimezone + ", expected value: {\"+/-HH:MM\"}");
             }
 
@@ -938,6 +1190,8 @@ namespace OpenLogReplicator {
 
                     if (arch == "path")
                         archGetLog = Replicator::archGetLogPath;
+                    else if (arch == "path-index")
+                        archGetLog = Replicator::archGetLogPathIndex;
                     else if (arch == "online") {
                         archGetLog = ReplicatorOnline::archGetLogOnline;
                     } else if (arch == "online-keep") {
@@ -945,11 +1199,11 @@ namespace OpenLogReplicator {
                         keepConnection = true;
                     } else
                         throw ConfigurationException(30001, "bad JSON, invalid \"arch\" value: " + arch +
-                                                     ", expected: one of {\"path\", \"online\", \"online-keep\"}");
+                                                     ", expected: one of {\"path\", \"path-index\", \"online\", \"online-keep\"}");
                 } else
                     archGetLog = ReplicatorOnline::archGetLogOnline;
 
-                replicator = new ReplicatorOnline(ctx, archGetLog, builder, metadata, transactionBuffer, alias, name, user, password, server, keepConnection);
+                replicator = new ReplicatorOnline(sourceCtx, archGetLog, builder, metadata, transactionBuffer, alias, name, user, password, server, keepConnection);
                 builder->initialize();
                 replicator->initialize();
                 mainProcessMapping(readerJson);
@@ -958,13 +1212,25 @@ namespace OpenLogReplicator {
                                              ", expected: not \"online\" since the code is not compiled");
 #endif /*LINK_LIBRARY_OCI*/
             } else if (readerType == "offline") {
-                replicator = new Replicator(ctx, archGetLog, builder, metadata, transactionBuffer, alias, name);
+                if (sourceJson.HasMember("arch")) {
+                    const std::string arch = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, sourceJson, "arch");
+
+                    if (arch == "path")
+                        archGetLog = Replicator::archGetLogPath;
+                    else if (arch == "path-index")
+                        archGetLog = Replicator::archGetLogPathIndex;
+                    else
+                        throw ConfigurationException(30001, "bad JSON, invalid \"arch\" value: " + arch +
+                                                     ", expected: one of {\"path\", \"path-index\"}");
+                }
+
+                replicator = new Replicator(sourceCtx, archGetLog, builder, metadata, transactionBuffer, alias, name);
                 builder->initialize();
                 replicator->initialize();
                 mainProcessMapping(readerJson);
             } else if (readerType == "batch") {
                 archGetLog = Replicator::archGetLogList;
-                replicator = new ReplicatorBatch(ctx, archGetLog, builder, metadata, transactionBuffer, alias, name);
+                replicator = new ReplicatorBatch(sourceCtx, archGetLog, builder, metadata, transactionBuffer, alias, name);
                 builder->initialize();
                 replicator->initialize();
 
@@ -975,10 +1241,46 @@ namespace OpenLogReplicator {
             } else
                 throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + readerType + R"(, expected: one of {"online", "offline", "batch"})");
 
+            if (readerJson.HasMember("catch-up-threads")) {
+                const uint64_t catchUpThreads = Ctx::getJsonFieldU64(configFileName, readerJson, "catch-up-threads");
+                if (unlikely(catchUpThreads > 64))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"catch-up-threads\" value: " + std::to_string(catchUpThreads) +
+                                                 ", expected: one of {0 .. 64}");
+                if (unlikely(catchUpThreads > 0 && readerType == "online"))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"catch-up-threads\" value: " + std::to_string(catchUpThreads) +
+                                                 ", expected: 0 for reader type: online");
+                if (unlikely(catchUpThreads > 0 && (sourceCtx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA) ||
+                                                    sourceCtx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS) || sourceCtx->dumpRedoLog > 0 ||
+                                                    sourceCtx->bufferSizeReadAhead > 0)))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"catch-up-threads\" value: " + std::to_string(catchUpThreads) +
+                                                 ", expected: 0 when adaptive schema, incomplete transactions, redo log dump or read ahead is used");
+                replicator->catchUpThreads = catchUpThreads;
+            }
+
+            if (readerJson.HasMember("redo-threads")) {
+                const uint64_t redoThreads = Ctx::getJsonFieldU64(configFileName, readerJson, "redo-threads");
+                if (unlikely(redoThreads > 64))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"redo-threads\" value: " + std::to_string(redoThreads) +
+                                                 ", expected: one of {0 .. 64}");
+                if (unlikely(redoThreads > 0 && (readerType == "online" || (readerType == "offline" &&
+                                                 !sourceCtx->isFlagSet(Ctx::REDO_FLAGS::ARCH_ONLY)))))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"redo-threads\" value: " + std::to_string(redoThreads) +
+                                                 ", expected: 0 for reader type: online and offline without archived redo logs only flag");
+                if (unlikely(redoThreads > 0 && (replicator->catchUpThreads > 0 || archGetLog == Replicator::archGetLogPathIndex)))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"redo-threads\" value: " + std::to_string(redoThreads) +
+                                                 ", expected: 0 when catch-up threads or archived redo log index is used");
+                if (unlikely(redoThreads > 0 && (sourceCtx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA) ||
+                                                 sourceCtx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS) || sourceCtx->dumpRedoLog > 0 ||
+                                                 sourceCtx->bufferSizeReadAhead > 0)))
+                    throw ConfigurationException(30001, "bad JSON, invalid \"redo-threads\" value: " + std::to_string(redoThreads) +
+                                                 ", expected: 0 when adaptive schema, incomplete transactions, redo log dump or read ahead is used");
+                replicator->redoThreads = redoThreads;
+            }
+
             if (sourceJson.HasMember("filter")) {
                 const rapidjson::Value& filterJson = Ctx::getJsonFieldO(configFileName, sourceJson, "filter");
 
-                if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                if (!sourceCtx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                     static const std::vector<std::string> filterNames{
                         "dump-xid",
                         "separator",
@@ -992,14 +1294,16 @@ namespace OpenLogReplicator {
                 if (filterJson.HasMember("separator"))
                     separator = Ctx::getJsonFieldS(configFileName, Ctx::JSON_FORMAT_SEPARATOR_LENGTH, filterJson, "separator");
 
-                if (filterJson.HasMember("table") && !ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
+                if (filterJson.HasMember("table") && !sourceCtx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
                     const rapidjson::Value& tableArrayJson = Ctx::getJsonFieldA(configFileName, filterJson, "table");
 
                     for (rapidjson::SizeType k = 0; k < tableArrayJson.Size(); ++k) {
                         const rapidjson::Value& tableElementJson = Ctx::getJsonFieldO(configFileName, tableArrayJson, "table", k);
 
-                        if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                        if (!sourceCtx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                             static const std::vector<std::string> tableElementNames{
+                                "column-filter",
+                                "columns",
                                 "condition",
                                 "key",
                                 "owner",
@@ -1023,6 +1327,15 @@ namespace OpenLogReplicator {
                         if (tableElementJson.HasMember("condition"))
                             element->condition = Ctx::getJsonFieldS(configFileName, Ctx::JSON_CONDITION_LENGTH, tableElementJson, "condition");
 
+                        if (tableElementJson.HasMember("columns")) {
+                            element->columns = Ctx::getJsonFieldS(configFileName, Ctx::JSON_KEY_LENGTH, tableElementJson, "columns");
+                            element->parseColumns(element->columns, separator);
+                        }
+
+                        if (tableElementJson.HasMember("column-filter"))
+                            DbFilter::parseJson(configFileName, Ctx::getJsonFieldA(configFileName, tableElementJson, "column-filter"),
+                                                element->filters);
+
                         if (tableElementJson.HasMember("tag")) {
                             element->tag = Ctx::getJsonFieldS(configFileName, Ctx::JSON_TAG_LENGTH, tableElementJson, "tag");
                             element->parseTag(element->tag, separator);
@@ -1034,7 +1347,7 @@ namespace OpenLogReplicator {
                     const rapidjson::Value& skipXidArrayJson = Ctx::getJsonFieldA(configFileName, filterJson, "skip-xid");
                     for (rapidjson::SizeType k = 0; k < skipXidArrayJson.Size(); ++k) {
                         const Xid xid(Ctx::getJsonFieldS(configFileName, Ctx::JSON_XID_LENGTH, skipXidArrayJson, "skip-xid", k));
-                        ctx->info(0, "adding XID to skip list: " + xid.toString());
+                        sourceCtx->info(0, "adding XID to skip list: " + xid.toString());
                         transactionBuffer->skipXidList.insert(xid);
                     }
                 }
@@ -1043,7 +1356,7 @@ namespace OpenLogReplicator {
                     const rapidjson::Value& dumpXidArrayJson = Ctx::getJsonFieldA(configFileName, filterJson, "dump-xid");
                     for (rapidjson::SizeType k = 0; k < dumpXidArrayJson.Size(); ++k) {
                         const Xid xid(Ctx::getJsonFieldS(configFileName, Ctx::JSON_XID_LENGTH, dumpXidArrayJson, "dump-xid", k));
-                        ctx->info(0, "adding XID to dump list: " + xid.toString());
+                        sourceCtx->info(0, "adding XID to dump list: " + xid.toString());
                         transactionBuffer->dumpXidList.insert(xid);
                     }
                 }
@@ -1056,15 +1369,38 @@ namespace OpenLogReplicator {
 
             metadata->commitElements();
             replicators.push_back(replicator);
-            ctx->spawnThread(replicator);
+            sourceCtx->spawnThread(replicator);
             replicator = nullptr;
         }
 
+        if (sourcesBufferMinMb + 4 > memoryMaxMb)
+            throw ConfigurationException(30001, R"(bad JSON, invalid "unswap-buffer-min-mb" + "read-buffer-min-mb" + "write-buffer-min-mb" of all sources + 4 ()" +
+                                         std::to_string(sourcesBufferMinMb) + " + 4) is greater than \"max-mb\" value (" +
+                                         std::to_string(memoryMaxMb) + ")");
+
         // Iterate through targets
         const rapidjson::Value& targetArrayJson = Ctx::getJsonFieldA(configFileName, document, "target");
-        if (targetArrayJson.Size() != 1) {
+        if (targetArrayJson.Size() < 1) {
             throw ConfigurationException(30001, "bad JSON, invalid \"target\" value: " + std::to_string(targetArrayJson.Size()) +
-                                         " elements, expected: 1 element");
+                                         " elements, expected: at least 1 element");
+        }
+
+        // Targets of the same source share the output buffers, the replication waits for all of them
+        std::unordered_map<std::string, uint64_t> sourceTargets;
+        std::set<std::string> targetAliases;
+        for (rapidjson::SizeType j = 0; j < targetArrayJson.Size(); ++j) {
+            const rapidjson::Value& targetJson = targetArrayJson[j];
+            const std::string alias = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, targetJson, "alias");
+            const std::string source = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, targetJson, "source");
+            if (!targetAliases.insert(alias).second)
+                throw ConfigurationException(30001, "bad JSON, invalid \"alias\" value: " + alias + ", expected: unique value");
+            ++sourceTargets[source];
+
+            const rapidjson::Value& writerJson = Ctx::getJsonFieldO(configFileName, targetJson, "writer");
+            const std::string writerType = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, writerJson, "type");
+            if (targetArrayJson.Size() > 1 && (writerType == "zeromq" || writerType == "network"))
+                throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + writerType +
+                                             ", expected: not \"zeromq\" or \"network\" when more than one target is defined");
         }
 
         for (rapidjson::SizeType j = 0; j < targetArrayJson.Size(); ++j) {
@@ -1079,16 +1415,23 @@ namespace OpenLogReplicator {
                     replicator2 = replicatorTmp;
             if (replicator2 == nullptr)
                 throw ConfigurationException(30001, "bad JSON, invalid \"source\" value: " + source + ", expected: value used earlier in \"source\" field");
+            replicator2->metadata->writers = sourceTargets[source];
+            Ctx* sourceCtx = replicator2->ctx;
 
             // Writer
             Writer* writer;
             const rapidjson::Value& writerJson = Ctx::getJsonFieldO(configFileName, targetJson, "writer");
             const std::string writerType = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, writerJson, "type");
 
-            if (!ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+            if (!sourceCtx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
                 static const std::vector<std::string> writerNames{
                     "append",
+                    "compression",
+                    "compression-frame-mb",
+                    "compression-level",
+                    "compression-threads",
                     "max-file-size",
+                    "max-lag-mb",
                     "max-message-mb",
                     "new-line",
                     "output",
@@ -1105,16 +1448,16 @@ namespace OpenLogReplicator {
             }
 
             if (writerJson.HasMember("poll-interval-us")) {
-                ctx->pollIntervalUs = Ctx::getJsonFieldU64(configFileName, writerJson, "poll-interval-us");
-                if (ctx->pollIntervalUs < 100 || ctx->pollIntervalUs > 3600000000)
+                sourceCtx->pollIntervalUs = Ctx::getJsonFieldU64(configFileName, writerJson, "poll-interval-us");
+                if (sourceCtx->pollIntervalUs < 100 || sourceCtx->pollIntervalUs > 3600000000)
                     throw ConfigurationException(30001, "bad JSON, invalid \"poll-interval-us\" value: " +
-                                                 std::to_string(ctx->pollIntervalUs) + ", expected: one of {100 .. 3600000000}");
+                                                 std::to_string(sourceCtx->pollIntervalUs) + ", expected: one of {100 .. 3600000000}");
             }
 
             if (writerJson.HasMember("queue-size")) {
-                ctx->queueSize = Ctx::getJsonFieldU64(configFileName, writerJson, "queue-size");
-                if (ctx->queueSize < 1 || ctx->queueSize > 1000000)
-                    throw ConfigurationException(30001, "bad JSON, invalid \"queue-size\" value: " + std::to_string(ctx->queueSize) +
+                sourceCtx->queueSize = Ctx::getJsonFieldU64(configFileName, writerJson, "queue-size");
+                if (sourceCtx->queueSize < 1 || sourceCtx->queueSize > 1000000)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"queue-size\" value: " + std::to_string(sourceCtx->queueSize) +
                                                  ", expected: one of {1 .. 1000000}");
             }
 
@@ -1156,10 +1499,60 @@ namespace OpenLogReplicator {
                                                      std::to_string(writeBufferFlushSize) + ", expected: one of {0 .. 1048576}");
                 }
 
-                writer = new WriterFile(ctx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, output,
-                                     fileTimestampFormat, maxFileSize, newLine, append, writeBufferFlushSize);
+                Compressor::TYPE compressionType = Compressor::TYPE::NONE;
+                int compressionLevel = 0;
+                if (writerJson.HasMember("compression")) {
+                    const std::string compression = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, writerJson, "compression");
+                    if (compression == "lz4") {
+#ifdef LINK_LIBRARY_LZ4
+                        compressionType = Compressor::TYPE::LZ4;
+#else
+                        throw ConfigurationException(30001, "bad JSON, invalid \"compression\" value: \"" + compression +
+                                                     "\", expected: not \"lz4\" since the code is not compiled");
+#endif /* LINK_LIBRARY_LZ4 */
+                    } else if (compression == "zstd") {
+#ifdef LINK_LIBRARY_ZSTD
+                        compressionType = Compressor::TYPE::ZSTD;
+                        compressionLevel = 3;
+#else
+                        throw ConfigurationException(30001, "bad JSON, invalid \"compression\" value: \"" + compression +
+                                                     "\", expected: not \"zstd\" since the code is not compiled");
+#endif /* LINK_LIBRARY_ZSTD */
+                    } else if (compression != "none")
+                        throw ConfigurationException(30001, "bad JSON, invalid \"compression\" value: \"" + compression +
+                                                     R"(", expected: one of {"lz4", "none", "zstd"})");
+                }
+
+                if (writerJson.HasMember("compression-level")) {
+                    const uint64_t maxLevel = compressionType == Compressor::TYPE::ZSTD ? 19 : 12;
+                    const uint64_t level = Ctx::getJsonFieldU64(configFileName, writerJson, "compression-level");
+                    if (level > maxLevel)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"compression-level\" value: " + std::to_string(level) +
+                                                     ", expected: one of {0 .. " + std::to_string(maxLevel) + "}");
+                    compressionLevel = static_cast<int>(level);
+                }
+
+                uint64_t compressionFrameMb = 4;
+                if (writerJson.HasMember("compression-frame-mb")) {
+                    compressionFrameMb = Ctx::getJsonFieldU64(configFileName, writerJson, "compression-frame-mb");
+                    if (compressionFrameMb < 1 || compressionFrameMb > 256)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"compression-frame-mb\" value: " +
+                                                     std::to_string(compressionFrameMb) + ", expected: one of {1 .. 256}");
+                }
+
+                uint compressionThreads = 2;
+                if (writerJson.HasMember("compression-threads")) {
+                    compressionThreads = Ctx::getJsonFieldU(configFileName, writerJson, "compression-threads");
+                    if (compressionThreads < 1 || compressionThreads > 64)
+                        throw ConfigurationException(30001, "bad JSON, invalid \"compression-threads\" value: " +
+                                                     std::to_string(compressionThreads) + ", expected: one of {1 .. 64}");
+                }
+
+                writer = new WriterFile(sourceCtx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, output,
+                                     fileTimestampFormat, maxFileSize, newLine, append, writeBufferFlushSize, compressionType, compressionLevel,
+                                     compressionFrameMb * 1024 * 1024, compressionThreads);
             } else if (writerType == "discard") {
-                writer = new WriterDiscard(ctx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata);
+                writer = new WriterDiscard(sourceCtx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata);
             } else if (writerType == "kafka") {
 #ifdef LINK_LIBRARY_RDKAFKA
                 uint64_t maxMessageMb = 100;
@@ -1173,7 +1566,7 @@ namespace OpenLogReplicator {
 
                 const std::string topic = Ctx::getJsonFieldS(configFileName, Ctx::JSON_TOPIC_LENGTH, writerJson, "topic");
 
-                writer = new WriterKafka(ctx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, topic);
+                writer = new WriterKafka(sourceCtx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, topic);
 
                 if (writerJson.HasMember("properties")) {
                     const rapidjson::Value& propertiesJson = Ctx::getJsonFieldO(configFileName, writerJson, "properties");
@@ -1191,9 +1584,9 @@ namespace OpenLogReplicator {
             } else if (writerType == "zeromq") {
 #if defined(LINK_LIBRARY_PROTOBUF) && defined(LINK_LIBRARY_ZEROMQ)
                 const std::string uri = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, writerJson, "uri");
-                auto* stream = new StreamZeroMQ(ctx, uri);
+                auto* stream = new StreamZeroMQ(sourceCtx, uri);
                 stream->initialize();
-                writer = new WriterStream(ctx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, stream);
+                writer = new WriterStream(sourceCtx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, stream);
 #else
                 throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + writerType +
                                              ", expected: not \"zeromq\" since the code is not compiled");
@@ -1202,9 +1595,9 @@ namespace OpenLogReplicator {
 #ifdef LINK_LIBRARY_PROTOBUF
                 const std::string uri = Ctx::getJsonFieldS(configFileName, Ctx::JSON_PARAMETER_LENGTH, writerJson, "uri");
 
-                auto* stream = new StreamNetwork(ctx, uri);
+                auto* stream = new StreamNetwork(sourceCtx, uri);
                 stream->initialize();
-                writer = new WriterStream(ctx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, stream);
+                writer = new WriterStream(sourceCtx, alias + "-writer", replicator2->database, replicator2->builder, replicator2->metadata, stream);
 #else
                 throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + writerType +
                                              ", expected: not \"network\" since the code is not compiled");
@@ -1213,9 +1606,20 @@ namespace OpenLogReplicator {
                 throw ConfigurationException(30001, "bad JSON, invalid \"type\" value: " + writerType +
                                              R"(, expected: one of {"file", "kafka", "zeromq", "network", "discard"})");
 
+            // Each target of a shared source keeps own checkpoint
+            if (sourceTargets[source] > 1)
+                writer->checkpointName = replicator2->database + "-" + alias + "-chkpt";
+
+            if (writerJson.HasMember("max-lag-mb")) {
+                writer->maxLagMb = Ctx::getJsonFieldU64(configFileName, writerJson, "max-lag-mb");
+                if (writer->maxLagMb > 0 && writer->maxLagMb < Ctx::MEMORY_CHUNK_SIZE_MB)
+                    throw ConfigurationException(30001, "bad JSON, invalid \"max-lag-mb\" value: " + std::to_string(writer->maxLagMb) +
+                                                 ", expected: 0 or at least " + std::to_string(Ctx::MEMORY_CHUNK_SIZE_MB));
+            }
+
             writers.push_back(writer);
             writer->initialize();
-            ctx->spawnThread(writer);
+            sourceCtx->spawnThread(writer);
         }
 
         ctx->mainLoop();
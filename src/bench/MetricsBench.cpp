@@ -0,0 +1,184 @@
+/* Counters for the benchmark tool
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include "MetricsBench.h"
+
+namespace OpenLogReplicator {
+    MetricsBench::MetricsBench():
+            Metrics(TAG_NAMES::NONE) {}
+
+    void MetricsBench::initialize(const Ctx* ctx __attribute__((unused))) {}
+
+    void MetricsBench::shutdown() {}
+
+    // The benchmark replicates a single source
+    Metrics* MetricsBench::addSource(const std::string& source __attribute__((unused))) {
+        return nullptr;
+    }
+
+    void MetricsBench::emitBytesConfirmed(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitBytesParsed(uint64_t counter) {
+        bytesParsed.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitBytesRead(uint64_t counter) {
+        bytesRead.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitBytesSent(uint64_t counter) {
+        bytesSent.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitCheckpointsOut(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitCheckpointsSkip(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitCheckpointLag(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitCheckpointLockUs(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitCompressionBytesIn(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitCompressionBytesOut(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitCompressionTimeUs(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDdlOpsAlter(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDdlOpsCreate(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDdlOpsDrop(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDdlOpsOther(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDdlOpsPurge(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDdlOpsTruncate(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDmlOpsDeleteOut(uint64_t counter) {
+        dmlOpsDelete.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitDmlOpsInsertOut(uint64_t counter) {
+        dmlOpsInsert.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitDmlOpsUpdateOut(uint64_t counter) {
+        dmlOpsUpdate.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitDmlOpsDeleteSkip(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDmlOpsInsertSkip(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDmlOpsUpdateSkip(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitDmlOpsDeleteOut(uint64_t counter, const std::string& owner __attribute__((unused)), const std::string& table __attribute__((unused))) {
+        dmlOpsDelete.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitDmlOpsInsertOut(uint64_t counter, const std::string& owner __attribute__((unused)), const std::string& table __attribute__((unused))) {
+        dmlOpsInsert.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitDmlOpsUpdateOut(uint64_t counter, const std::string& owner __attribute__((unused)), const std::string& table __attribute__((unused))) {
+        dmlOpsUpdate.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitDmlOpsDeleteSkip(uint64_t counter __attribute__((unused)), const std::string& owner __attribute__((unused)), const std::string& table __attribute__((unused))) {}
+
+    void MetricsBench::emitDmlOpsInsertSkip(uint64_t counter __attribute__((unused)), const std::string& owner __attribute__((unused)), const std::string& table __attribute__((unused))) {}
+
+    void MetricsBench::emitDmlOpsUpdateSkip(uint64_t counter __attribute__((unused)), const std::string& owner __attribute__((unused)), const std::string& table __attribute__((unused))) {}
+
+    void MetricsBench::emitLogSwitchesArchived(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitLogSwitchesOnline(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitLogSwitchesLagArchived(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitLogSwitchesLagOnline(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryAllocatedMb(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedTotalMb(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedMbBuilder(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedMbMisc(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedMbParser(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedMbReader(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedMbTransactions(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMemoryUsedMbWriter(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitMessagesConfirmed(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitMessagesSent(uint64_t counter) {
+        messagesSent.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitRedoLatencyUs(int64_t value __attribute__((unused))) {}
+
+    void MetricsBench::emitRedoThreadLag(int64_t gauge __attribute__((unused)), uint16_t thread __attribute__((unused))) {}
+
+    void MetricsBench::emitServiceStateInitializing(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitServiceStateReady(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitServiceStateStarting(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitServiceStateReplicating(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitServiceStateFinishing(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitServiceStateAborting(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitSwapOperationsMbDiscard(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitSwapOperationsMbRead(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitSwapOperationsMbWrite(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitSwapUsageMb(int64_t gauge __attribute__((unused))) {}
+
+    void MetricsBench::emitThreadContextUs(int64_t gauge __attribute__((unused)), const std::string& thread __attribute__((unused)), const std::string& context __attribute__((unused))) {}
+
+    void MetricsBench::emitThreadContextSwitches(int64_t gauge __attribute__((unused)), const std::string& thread __attribute__((unused))) {}
+
+    void MetricsBench::emitTransactionsCommitOut(uint64_t counter) {
+        transactionsCommit.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitTransactionsRollbackOut(uint64_t counter) {
+        transactionsRollback.fetch_add(counter, std::memory_order_relaxed);
+    }
+
+    void MetricsBench::emitTransactionsCommitPartial(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitTransactionsRollbackPartial(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitTransactionsCommitSkip(uint64_t counter __attribute__((unused))) {}
+
+    void MetricsBench::emitTransactionsRollbackSkip(uint64_t counter __attribute__((unused))) {}
+}
@@ -0,0 +1,116 @@
+/* Header for MetricsBench class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef METRICS_BENCH_H_
+#define METRICS_BENCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "../common/metrics/Metrics.h"
+
+namespace OpenLogReplicator {
+    // Counters used by the benchmark report, other metrics are ignored
+    class MetricsBench final : public Metrics {
+    public:
+        std::atomic<uint64_t> bytesParsed{0};
+        std::atomic<uint64_t> bytesRead{0};
+        std::atomic<uint64_t> bytesSent{0};
+        std::atomic<uint64_t> dmlOpsDelete{0};
+        std::atomic<uint64_t> dmlOpsInsert{0};
+        std::atomic<uint64_t> dmlOpsUpdate{0};
+        std::atomic<uint64_t> messagesSent{0};
+        std::atomic<uint64_t> transactionsCommit{0};
+        std::atomic<uint64_t> transactionsRollback{0};
+
+        MetricsBench();
+        ~MetricsBench() override = default;
+
+        void initialize(const Ctx* ctx) override;
+        void shutdown() override;
+        [[nodiscard]] Metrics* addSource(const std::string& source) override;
+
+        void emitBytesConfirmed(uint64_t counter) override;
+        void emitBytesParsed(uint64_t counter) override;
+        void emitBytesRead(uint64_t counter) override;
+        void emitBytesSent(uint64_t counter) override;
+        void emitCheckpointsOut(uint64_t counter) override;
+        void emitCheckpointsSkip(uint64_t counter) override;
+        void emitCheckpointLag(int64_t gauge) override;
+        void emitCheckpointLockUs(int64_t gauge) override;
+        void emitCompressionBytesIn(uint64_t counter) override;
+        void emitCompressionBytesOut(uint64_t counter) override;
+        void emitCompressionTimeUs(uint64_t counter) override;
+        void emitDdlOpsAlter(uint64_t counter) override;
+        void emitDdlOpsCreate(uint64_t counter) override;
+        void emitDdlOpsDrop(uint64_t counter) override;
+        void emitDdlOpsOther(uint64_t counter) override;
+        void emitDdlOpsPurge(uint64_t counter) override;
+        void emitDdlOpsTruncate(uint64_t counter) override;
+        void emitDmlOpsDeleteOut(uint64_t counter) override;
+        void emitDmlOpsInsertOut(uint64_t counter) override;
+        void emitDmlOpsUpdateOut(uint64_t counter) override;
+        void emitDmlOpsDeleteSkip(uint64_t counter) override;
+        void emitDmlOpsInsertSkip(uint64_t counter) override;
+        void emitDmlOpsUpdateSkip(uint64_t counter) override;
+        void emitDmlOpsDeleteOut(uint64_t counter, const std::string& owner, const std::string& table) override;
+        void emitDmlOpsInsertOut(uint64_t counter, const std::string& owner, const std::string& table) override;
+        void emitDmlOpsUpdateOut(uint64_t counter, const std::string& owner, const std::string& table) override;
+        void emitDmlOpsDeleteSkip(uint64_t counter, const std::string& owner, const std::string& table) override;
+        void emitDmlOpsInsertSkip(uint64_t counter, const std::string& owner, const std::string& table) override;
+        void emitDmlOpsUpdateSkip(uint64_t counter, const std::string& owner, const std::string& table) override;
+        void emitLogSwitchesArchived(uint64_t counter) override;
+        void emitLogSwitchesOnline(uint64_t counter) override;
+        void emitLogSwitchesLagArchived(int64_t gauge) override;
+        void emitLogSwitchesLagOnline(int64_t gauge) override;
+        void emitMemoryAllocatedMb(int64_t gauge) override;
+        void emitMemoryUsedTotalMb(int64_t gauge) override;
+        void emitMemoryUsedMbBuilder(int64_t gauge) override;
+        void emitMemoryUsedMbMisc(int64_t gauge) override;
+        void emitMemoryUsedMbParser(int64_t gauge) override;
+        void emitMemoryUsedMbReader(int64_t gauge) override;
+        void emitMemoryUsedMbTransactions(int64_t gauge) override;
+        void emitMemoryUsedMbWriter(int64_t gauge) override;
+        void emitMessagesConfirmed(uint64_t counter) override;
+        void emitMessagesSent(uint64_t counter) override;
+        void emitRedoLatencyUs(int64_t value) override;
+        void emitRedoThreadLag(int64_t gauge, uint16_t thread) override;
+        void emitServiceStateInitializing(int64_t gauge) override;
+        void emitServiceStateReady(int64_t gauge) override;
+        void emitServiceStateStarting(int64_t gauge) override;
+        void emitServiceStateReplicating(int64_t gauge) override;
+        void emitServiceStateFinishing(int64_t gauge) override;
+        void emitServiceStateAborting(int64_t gauge) override;
+        void emitSwapOperationsMbDiscard(uint64_t counter) override;
+        void emitSwapOperationsMbRead(uint64_t counter) override;
+        void emitSwapOperationsMbWrite(uint64_t counter) override;
+        void emitSwapUsageMb(int64_t gauge) override;
+        void emitThreadContextUs(int64_t gauge, const std::string& thread, const std::string& context) override;
+        void emitThreadContextSwitches(int64_t gauge, const std::string& thread) override;
+        void emitTransactionsCommitOut(uint64_t counter) override;
+        void emitTransactionsRollbackOut(uint64_t counter) override;
+        void emitTransactionsCommitPartial(uint64_t counter) override;
+        void emitTransactionsRollbackPartial(uint64_t counter) override;
+        void emitTransactionsCommitSkip(uint64_t counter) override;
+        void emitTransactionsRollbackSkip(uint64_t counter) override;
+    };
+}
+
+#endif
@@ -0,0 +1,543 @@
+/* Generator of synthetic archived redo log files
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#include "../common/Ctx.h"
+#include "../common/RedoLogRecord.h"
+#include "../common/exception/ConfigurationException.h"
+#include "../common/exception/RuntimeException.h"
+#include "../common/types/Scn.h"
+#include "RedoGenerator.h"
+
+namespace OpenLogReplicator {
+    RedoGenerator::OP RedoGenerator::randomOp() {
+        uint64_t total = 0;
+        for (const uint64_t weight: weights)
+            total += weight;
+
+        uint64_t value = random() % total;
+        for (uint op = 0; op < static_cast<uint>(OP::NUM); ++op) {
+            if (value < weights[op])
+                return static_cast<OP>(op);
+            value -= weights[op];
+        }
+        return OP::INSERT;
+    }
+
+    std::string RedoGenerator::randomValue(uint64_t size) {
+        static constexpr char CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+        std::string value(size, ' ');
+        for (char& c: value)
+            c = CHARS[random() % (sizeof(CHARS) - 1)];
+        return value;
+    }
+
+    std::vector<std::string> RedoGenerator::randomRow(uint64_t rowId, bool lob) {
+        std::vector<std::string> row;
+        row.reserve(columns);
+        row.push_back(std::to_string(rowId));
+        for (uint64_t col = 1; col < columns; ++col) {
+            if (lob && col == columns - 1)
+                row.push_back(randomValue(lobSize));
+            else
+                row.push_back(randomValue(8 + (random() % 17)));
+        }
+        return row;
+    }
+
+    typeDba RedoGenerator::rowBdba(uint64_t rowId) const {
+        return 0x01000000 | static_cast<typeDba>(((rowId / tables) / ROWS_PER_BLOCK) & 0x003FFFFF);
+    }
+
+    typeSlot RedoGenerator::rowSlot(uint64_t rowId) {
+        return static_cast<typeSlot>(rowId % ROWS_PER_BLOCK);
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldBytes(const std::string& value) {
+        return {value.begin(), value.end()};
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldColNums(const std::vector<uint16_t>& colNums) {
+        Field field(colNums.size() * 2, 0);
+        for (uint64_t i = 0; i < colNums.size(); ++i)
+            Ctx::write16Little(field.data() + (i * 2), colNums[i]);
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKtbRedo() {
+        Field field(8, 0);
+        field[0] = 0x03; // KTBOP_Z
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKdo(typeDba bdba, uint8_t op, uint size) {
+        Field field(size, 0);
+        Ctx::write32Little(field.data() + 0, bdba);
+        field[10] = op;
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKdoQm(typeDba bdba, uint8_t op, const std::vector<typeSlot>& slots) {
+        Field field = fieldKdo(bdba, op, std::max<uint>(24, 20 + (slots.size() * 2)));
+        field[18] = static_cast<uint8_t>(slots.size());
+        for (uint64_t i = 0; i < slots.size(); ++i)
+            Ctx::write16Little(field.data() + 20 + (i * 2), slots[i]);
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKdoIrp(typeDba bdba, typeSlot slot, const std::vector<std::string>& row) {
+        const auto cc = static_cast<typeCC>(row.size());
+        Field field = fieldKdo(bdba, RedoLogRecord::OP_IRP, std::max<uint>(48, 45 + ((cc + 7) / 8)));
+        // Size of the row piece in the block, differs from the size of the first column, so it is not taken for a compressed row
+        uint64_t sizeDelt = 3;
+        for (const std::string& value: row)
+            sizeDelt += value.length() + (value.length() > 250 ? 3 : 1);
+
+        field[16] = RedoLogRecord::FB_H | RedoLogRecord::FB_F | RedoLogRecord::FB_L;
+        field[18] = cc;
+        Ctx::write16Little(field.data() + 40, static_cast<uint16_t>(std::min<uint64_t>(sizeDelt, 0xFFFF)));
+        Ctx::write16Little(field.data() + 42, slot);
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKdoUrp(typeDba bdba, typeSlot slot, typeCC cc) {
+        Field field = fieldKdo(bdba, RedoLogRecord::OP_URP, std::max<uint>(28, 26 + ((cc + 7) / 8)));
+        field[16] = RedoLogRecord::FB_H | RedoLogRecord::FB_F | RedoLogRecord::FB_L;
+        Ctx::write16Little(field.data() + 20, slot);
+        field[23] = cc;
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldSuppLog(typeCC cc, uint16_t before, uint16_t after) {
+        Field field(20, 0);
+        field[0] = 1;
+        field[1] = RedoLogRecord::FB_H | RedoLogRecord::FB_F | RedoLogRecord::FB_L;
+        Ctx::write16Little(field.data() + 2, cc);
+        Ctx::write16Little(field.data() + 6, before);
+        Ctx::write16Little(field.data() + 8, after);
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKtudb(typeUsn usn, typeSlt slt) const {
+        Field field(20, 0);
+        Ctx::write16Little(field.data() + 8, static_cast<uint16_t>(usn));
+        Ctx::write16Little(field.data() + 10, slt);
+        Ctx::write32Little(field.data() + 12, sqn);
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKtub(typeObj obj, typeSlt slt) {
+        Field field(24, 0);
+        Ctx::write32Little(field.data() + 0, obj);
+        Ctx::write32Little(field.data() + 4, obj);
+        field[16] = 0x0B;
+        field[17] = 0x01;
+        field[18] = static_cast<uint8_t>(slt);
+        return field;
+    }
+
+    RedoGenerator::Field RedoGenerator::fieldKtuxid(typeSlt slt, uint32_t sqnValue, uint size) {
+        Field field(size, 0);
+        Ctx::write16Little(field.data() + 0, slt);
+        Ctx::write32Little(field.data() + 4, sqnValue);
+        return field;
+    }
+
+    void RedoGenerator::appendVector(Record& record, uint8_t op1, uint8_t op2, uint16_t cls, uint32_t afn, typeDba dba,
+                                     const std::vector<Field>& fields) const {
+        const uint64_t start = record.size();
+        const uint64_t listSize = 2 + (fields.size() * 2);
+        uint64_t size = VECTOR_HEADER_SIZE + ((listSize + 2) & 0xFFFC);
+        for (const Field& field: fields)
+            size += (field.size() + 3) & 0xFFFC;
+        record.resize(start + size, 0);
+
+        uint8_t* data = record.data() + start;
+        data[0] = op1;
+        data[1] = op2;
+        Ctx::write16Little(data + 2, cls);
+        Ctx::write32Little(data + 4, afn);
+        Ctx::write32Little(data + 8, dba);
+        Ctx::writeScnLittle(data + 12, Scn(scn));
+        data[20] = 1;
+        data[21] = 1;
+
+        Ctx::write16Little(data + VECTOR_HEADER_SIZE, static_cast<uint16_t>(listSize));
+        uint64_t pos = VECTOR_HEADER_SIZE + ((listSize + 2) & 0xFFFC);
+        for (uint64_t i = 0; i < fields.size(); ++i) {
+            Ctx::write16Little(data + VECTOR_HEADER_SIZE + 2 + (i * 2), static_cast<uint16_t>(fields[i].size()));
+            if (!fields[i].empty())
+                memcpy(data + pos, fields[i].data(), fields[i].size());
+            pos += (fields[i].size() + 3) & 0xFFFC;
+        }
+    }
+
+    void RedoGenerator::setChSum(uint8_t* data) {
+        Ctx::write16Little(data + 14, 0);
+        uint64_t sum = 0;
+        for (uint i = 0; i < BLOCK_SIZE; i += sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, data + i, sizeof(uint64_t));
+            sum ^= word;
+        }
+        sum ^= (sum >> 32);
+        sum ^= (sum >> 16);
+        Ctx::write16Little(data + 14, static_cast<typeSum>(sum & 0xFFFF));
+    }
+
+    RedoGenerator::Record RedoGenerator::newRecord() const {
+        // The first record of the LWN carries the LWN header
+        if (records.empty()) {
+            Record record(RECORD_HEADER_LWN_SIZE, 0);
+            record[4] = 0x05;
+            return record;
+        }
+
+        Record record(RECORD_HEADER_SIZE, 0);
+        record[4] = 0x01;
+        return record;
+    }
+
+    void RedoGenerator::addInsert(typeUsn usn, typeSlt slt, bool lob) {
+        const uint64_t rowId = rowIdNext++;
+        const typeObj obj = OBJ_FIRST + (rowId % tables);
+        const typeDba bdba = rowBdba(rowId);
+        const std::vector<std::string> row = randomRow(rowId, lob);
+
+        Field kdo = fieldKdo(bdba, RedoLogRecord::OP_DRP, 20);
+        Ctx::write16Little(kdo.data() + 16, rowSlot(rowId));
+
+        Record record = newRecord();
+        appendVector(record, 0x05, 0x01, 16 + (2 * usn), 3, 0x00C00000 | (sqn & 0xFFFF),
+                     {fieldKtudb(usn, slt), fieldKtub(obj, slt), fieldKtbRedo(), kdo, fieldSuppLog(0, 1, 1)});
+
+        std::vector<Field> fields{fieldKtbRedo(), fieldKdoIrp(bdba, rowSlot(rowId), row)};
+        for (const std::string& value: row)
+            fields.push_back(fieldBytes(value));
+        appendVector(record, 0x0B, 0x02, 1, 4, bdba, fields);
+        records.push_back(std::move(record));
+        ++rowsGenerated[static_cast<uint>(lob ? OP::LOB : OP::INSERT)];
+    }
+
+    void RedoGenerator::addUpdate(typeUsn usn, typeSlt slt) {
+        const uint64_t rowId = (rowIdNext > 0) ? random() % rowIdNext : 0;
+        const typeObj obj = OBJ_FIRST + (rowId % tables);
+        const typeDba bdba = rowBdba(rowId);
+        const auto cc = static_cast<typeCC>(1 + (random() % std::min<uint64_t>(3, columns - 1)));
+        const std::string key = std::to_string(rowId);
+
+        std::vector<uint16_t> colNums;
+        for (uint16_t col = 1; col <= cc; ++col)
+            colNums.push_back(col);
+
+        std::vector<Field> undo{fieldKtudb(usn, slt), fieldKtub(obj, slt), fieldKtbRedo(), fieldKdoUrp(bdba, rowSlot(rowId), cc),
+                                fieldColNums(colNums)};
+        for (typeCC i = 0; i < cc; ++i)
+            undo.push_back(fieldBytes(randomValue(8 + (random() % 17))));
+        // Primary key column logged as supplemental data
+        undo.push_back(fieldSuppLog(1, 2, 2));
+        undo.push_back(fieldColNums({1}));
+        undo.push_back(fieldColNums({static_cast<uint16_t>(key.length())}));
+        undo.push_back(fieldBytes(key));
+
+        std::vector<Field> redo{fieldKtbRedo(), fieldKdoUrp(bdba, rowSlot(rowId), cc), fieldColNums(colNums)};
+        for (typeCC i = 0; i < cc; ++i)
+            redo.push_back(fieldBytes(randomValue(8 + (random() % 17))));
+
+        Record record = newRecord();
+        appendVector(record, 0x05, 0x01, 16 + (2 * usn), 3, 0x00C00000 | (sqn & 0xFFFF), undo);
+        appendVector(record, 0x0B, 0x05, 1, 4, bdba, redo);
+        records.push_back(std::move(record));
+        ++rowsGenerated[static_cast<uint>(OP::UPDATE)];
+    }
+
+    void RedoGenerator::addDelete(typeUsn usn, typeSlt slt) {
+        const uint64_t rowId = (rowIdNext > 0) ? random() % rowIdNext : 0;
+        const typeObj obj = OBJ_FIRST + (rowId % tables);
+        const typeDba bdba = rowBdba(rowId);
+        const std::vector<std::string> row = randomRow(rowId, false);
+
+        std::vector<Field> undo{fieldKtudb(usn, slt), fieldKtub(obj, slt), fieldKtbRedo(), fieldKdoIrp(bdba, rowSlot(rowId), row)};
+        for (const std::string& value: row)
+            undo.push_back(fieldBytes(value));
+        undo.push_back(fieldSuppLog(0, 1, 1));
+
+        Field kdo = fieldKdo(bdba, RedoLogRecord::OP_DRP, 20);
+        Ctx::write16Little(kdo.data() + 16, rowSlot(rowId));
+
+        Record record = newRecord();
+        appendVector(record, 0x05, 0x01, 16 + (2 * usn), 3, 0x00C00000 | (sqn & 0xFFFF), undo);
+        appendVector(record, 0x0B, 0x03, 1, 4, bdba, {fieldKtbRedo(), kdo});
+        records.push_back(std::move(record));
+        ++rowsGenerated[static_cast<uint>(OP::DELETE)];
+    }
+
+    void RedoGenerator::addInsertMultiple(typeUsn usn, typeSlt slt) {
+        const uint64_t rowIdFirst = rowIdNext;
+        const typeObj obj = OBJ_FIRST + (rowIdFirst % tables);
+        const typeDba bdba = rowBdba(rowIdFirst);
+        std::vector<typeSlot> slots;
+        std::vector<uint16_t> rowSizes;
+        Field rowData;
+
+        // Rows of one array insert share the block and the object
+        while (slots.size() < std::min<uint64_t>(rowsPerMulti, 255)) {
+            const std::vector<std::string> row = randomRow(rowIdNext, false);
+            Field rowPiece{RedoLogRecord::FB_H | RedoLogRecord::FB_F | RedoLogRecord::FB_L, 0, static_cast<uint8_t>(row.size())};
+            for (const std::string& value: row) {
+                if (value.length() > 250) {
+                    rowPiece.push_back(0xFE);
+                    rowPiece.push_back(0);
+                    rowPiece.push_back(0);
+                    Ctx::write16Little(rowPiece.data() + rowPiece.size() - 2, static_cast<uint16_t>(value.length()));
+                } else
+                    rowPiece.push_back(static_cast<uint8_t>(value.length()));
+                rowPiece.insert(rowPiece.end(), value.begin(), value.end());
+            }
+            if (!slots.empty() && rowData.size() + rowPiece.size() > MULTI_ROW_DATA_MAX)
+                break;
+
+            slots.push_back(rowSlot(rowIdNext));
+            rowSizes.push_back(static_cast<uint16_t>(rowPiece.size()));
+            rowData.insert(rowData.end(), rowPiece.begin(), rowPiece.end());
+            ++rowIdNext;
+        }
+
+        Record record = newRecord();
+        appendVector(record, 0x05, 0x01, 16 + (2 * usn), 3, 0x00C00000 | (sqn & 0xFFFF),
+                     {fieldKtudb(usn, slt), fieldKtub(obj, slt), fieldKtbRedo(), fieldKdoQm(bdba, RedoLogRecord::OP_QMD, slots)});
+        appendVector(record, 0x0B, 0x0B, 1, 4, bdba, {fieldKtbRedo(), fieldKdoQm(bdba, RedoLogRecord::OP_QMI, slots), fieldColNums(rowSizes), rowData});
+        records.push_back(std::move(record));
+        rowsGenerated[static_cast<uint>(OP::MULTI)] += slots.size();
+    }
+
+    void RedoGenerator::addTransaction(uint64_t transaction) {
+        const auto usn = static_cast<typeUsn>(1 + (transaction % 8));
+        const auto slt = static_cast<typeSlt>((transaction / 8) % 48);
+        ++sqn;
+
+        Record begin = newRecord();
+        appendVector(begin, 0x05, 0x02, 15 + (2 * usn), 3, 0x00C00000 | (sqn & 0xFFFF), {fieldKtuxid(slt, sqn, 32)});
+        records.push_back(std::move(begin));
+
+        for (uint64_t i = 0; i < operations; ++i) {
+            switch (randomOp()) {
+                case OP::INSERT:
+                    addInsert(usn, slt, false);
+                    break;
+
+                case OP::UPDATE:
+                    addUpdate(usn, slt);
+                    break;
+
+                case OP::DELETE:
+                    addDelete(usn, slt);
+                    break;
+
+                case OP::LOB:
+                    addInsert(usn, slt, true);
+                    break;
+
+                case OP::MULTI:
+                case OP::NUM:
+                    addInsertMultiple(usn, slt);
+                    break;
+            }
+        }
+
+        Record commit = newRecord();
+        appendVector(commit, 0x05, 0x04, 15 + (2 * usn), 3, 0x00C00000 | (sqn & 0xFFFF), {fieldKtuxid(slt, sqn, 20)});
+        records.push_back(std::move(commit));
+        ++transactionsGenerated;
+    }
+
+    void RedoGenerator::writeBlock(const uint8_t* data) {
+        file.write(reinterpret_cast<const char*>(data), BLOCK_SIZE);
+        if (!file.good())
+            throw RuntimeException(10007, "file: " + getFileName("", sequence) + " - write failed: " + strerror(errno));
+        bytesWritten += BLOCK_SIZE;
+    }
+
+    void RedoGenerator::writeLwn() {
+        if (records.empty())
+            return;
+
+        // Records follow each other across blocks, a record doesn't start in the last 20 bytes of a block
+        std::vector<uint8_t> lwn(BLOCK_SIZE, 0);
+        uint64_t blockStart = 0;
+        uint pos = BLOCK_HEADER_SIZE;
+        uint16_t subScn = 0;
+        for (Record& record: records) {
+            Ctx::write32Little(record.data() + 0, static_cast<uint32_t>(record.size()));
+            Ctx::write16Little(record.data() + 6, static_cast<uint16_t>(scn >> 32));
+            Ctx::write32Little(record.data() + 8, static_cast<uint32_t>(scn & 0xFFFFFFFF));
+            Ctx::write16Little(record.data() + 12, ++subScn);
+
+            if (pos + 20 >= BLOCK_SIZE) {
+                blockStart += BLOCK_SIZE;
+                lwn.resize(blockStart + BLOCK_SIZE, 0);
+                pos = BLOCK_HEADER_SIZE;
+            }
+
+            uint64_t copied = 0;
+            while (copied < record.size()) {
+                if (pos == BLOCK_SIZE) {
+                    blockStart += BLOCK_SIZE;
+                    lwn.resize(blockStart + BLOCK_SIZE, 0);
+                    pos = BLOCK_HEADER_SIZE;
+                }
+                const uint64_t toCopy = std::min<uint64_t>(record.size() - copied, BLOCK_SIZE - pos);
+                memcpy(lwn.data() + blockStart + pos, record.data() + copied, toCopy);
+                copied += toCopy;
+                pos += toCopy;
+            }
+        }
+        records.clear();
+
+        const auto lwnSize = static_cast<uint32_t>(lwn.size() / BLOCK_SIZE);
+        uint8_t* lwnHeader = lwn.data() + BLOCK_HEADER_SIZE;
+        Ctx::write16Little(lwnHeader + 24, 1);
+        Ctx::write16Little(lwnHeader + 26, 1);
+        Ctx::write32Little(lwnHeader + 28, lwnSize);
+        Ctx::write32Little(lwnHeader + 32, lwnSize);
+        Ctx::writeScnLittle(lwnHeader + 40, Scn(scn));
+        Ctx::write32Little(lwnHeader + 64, timestamp);
+
+        for (uint32_t i = 0; i < lwnSize; ++i) {
+            uint8_t* data = lwn.data() + (static_cast<uint64_t>(i) * BLOCK_SIZE);
+            data[0] = 0x01;
+            data[1] = 0x22;
+            Ctx::write32Little(data + 4, block++);
+            Ctx::write32Little(data + 8, sequence);
+            setChSum(data);
+            writeBlock(data);
+        }
+
+        ++scn;
+        ++timestamp;
+    }
+
+    void RedoGenerator::writeHeader(uint64_t firstScn, uint32_t firstTime) {
+        uint8_t header[BLOCK_SIZE * 2]{};
+
+        // Block 0: file header
+        header[1] = 0x22;
+        Ctx::write32Little(header + 20, BLOCK_SIZE);
+        Ctx::write32Little(header + 24, block);
+        header[28] = 0x7D;
+        header[29] = 0x7C;
+        header[30] = 0x7B;
+        header[31] = 0x7A;
+
+        // Block 1: redo log header
+        uint8_t* data = header + BLOCK_SIZE;
+        data[0] = 0x01;
+        data[1] = 0x22;
+        Ctx::write32Little(data + 4, 1);
+        Ctx::write32Little(data + 8, sequence);
+        Ctx::write32Little(data + 20, COMPAT_VSN);
+        memcpy(data + 28, "OLRBENCH", 8);
+        Ctx::write32Little(data + 52, ACTIVATION);
+        Ctx::write32Little(data + 156, block);
+        Ctx::write32Little(data + 160, resetlogs);
+        Ctx::write16Little(data + 176, 1);
+        Ctx::writeScnLittle(data + 180, Scn(firstScn));
+        Ctx::write32Little(data + 188, firstTime);
+        Ctx::writeScnLittle(data + 192, Scn(scn));
+        Ctx::write32Little(data + 200, timestamp);
+        setChSum(data);
+
+        file.seekp(0);
+        writeBlock(header);
+        writeBlock(data);
+    }
+
+    void RedoGenerator::setMix(const std::string& mix) {
+        std::istringstream stream(mix);
+        std::string item;
+        uint op = 0;
+        uint64_t total = 0;
+        while (std::getline(stream, item, ',')) {
+            if (op == static_cast<uint>(OP::NUM) || item.empty() || item.find_first_not_of("0123456789") != std::string::npos)
+                throw ConfigurationException(30002, "invalid operation mix: " + mix + ", expected: INSERT,UPDATE,DELETE,LOB,MULTI weights");
+            weights[op] = strtoull(item.c_str(), nullptr, 10);
+            total += weights[op++];
+        }
+        if (op != static_cast<uint>(OP::NUM) || total == 0)
+            throw ConfigurationException(30002, "invalid operation mix: " + mix + ", expected: INSERT,UPDATE,DELETE,LOB,MULTI weights");
+    }
+
+    std::string RedoGenerator::getFileName(const std::string& path, uint32_t fileSequence) const {
+        // Matches log-archive-format: %t_%s_%r.arc
+        std::string fileName = "1_" + std::to_string(fileSequence) + "_" + std::to_string(resetlogs) + ".arc";
+        if (path.empty())
+            return fileName;
+        return path + "/" + fileName;
+    }
+
+    void RedoGenerator::generate(const std::string& path) {
+        if (files == 0 || transactions == 0 || transactionsPerLwn == 0 || tables == 0)
+            throw ConfigurationException(30002, "invalid generator parameters, files, transactions, lwn size and tables must be positive");
+        if (columns < 2 || columns > 200)
+            throw ConfigurationException(30002, "invalid number of columns: " + std::to_string(columns) + ", expected: 2 to 200");
+        if (lobSize > 32767)
+            throw ConfigurationException(30002, "invalid lob size: " + std::to_string(lobSize) + ", expected: at most 32767");
+
+        random.seed(seed);
+        sequence = sequenceFirst;
+        scn = scnFirst;
+        timestamp = encodeTime(2026, 1, 1, 0, 0, 0);
+        uint64_t transaction = 0;
+
+        for (uint64_t f = 0; f < files; ++f, ++sequence) {
+            const std::string fileName = getFileName(path, sequence);
+            file.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+                throw RuntimeException(10006, "file: " + fileName + " - open for writing returned: " + strerror(errno));
+
+            // Space for the header, written when the file is complete
+            memset(blockBuffer, 0, BLOCK_SIZE);
+            writeBlock(blockBuffer);
+            writeBlock(blockBuffer);
+            block = 2;
+
+            const uint64_t firstScn = scn;
+            const uint32_t firstTime = timestamp;
+            for (uint64_t t = 0; t < transactions; ++t) {
+                addTransaction(transaction++);
+                if ((t + 1) % transactionsPerLwn == 0)
+                    writeLwn();
+            }
+            writeLwn();
+
+            writeHeader(firstScn, firstTime);
+            bytesWritten -= BLOCK_SIZE * 2;
+            file.close();
+        }
+    }
+
+    uint32_t RedoGenerator::encodeTime(uint year, uint month, uint day, uint hour, uint minute, uint second) {
+        return ((((((year - 1988) * 12 + (month - 1)) * 31 + (day - 1)) * 24 + hour) * 60 + minute) * 60) + second;
+    }
+}
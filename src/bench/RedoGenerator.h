@@ -0,0 +1,130 @@
+/* Header for RedoGenerator class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef REDO_GENERATOR_H_
+#define REDO_GENERATOR_H_
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../common/types/Types.h"
+
+namespace OpenLogReplicator {
+    // Writes archived redo log files (version 19.0, little endian, 512 byte blocks) with a reproducible stream of DML transactions,
+    // decodable in schemaless mode
+    class RedoGenerator final {
+    public:
+        enum class OP : unsigned char {
+            INSERT,
+            UPDATE,
+            DELETE,
+            LOB,
+            MULTI,
+            NUM
+        };
+
+    protected:
+        static constexpr uint BLOCK_SIZE{512};
+        static constexpr uint BLOCK_HEADER_SIZE{16};
+        static constexpr uint RECORD_HEADER_SIZE{24};
+        static constexpr uint RECORD_HEADER_LWN_SIZE{68};
+        static constexpr uint VECTOR_HEADER_SIZE{32};
+        static constexpr uint32_t COMPAT_VSN{0x13000000};
+        static constexpr uint32_t ACTIVATION{0x4F4C5242};
+        static constexpr typeObj OBJ_FIRST{90000};
+        static constexpr uint ROWS_PER_BLOCK{64};
+        static constexpr uint MULTI_ROW_DATA_MAX{60000};
+
+        using Field = std::vector<uint8_t>;
+        using Record = std::vector<uint8_t>;
+
+        std::mt19937_64 random;
+        std::ofstream file;
+        uint32_t sequence{0};
+        uint64_t scn{0};
+        uint32_t timestamp{0};
+        typeBlk block{0};
+        uint32_t sqn{0};
+        uint64_t rowIdNext{0};
+        std::vector<Record> records;
+        uint8_t blockBuffer[BLOCK_SIZE]{};
+
+        [[nodiscard]] OP randomOp();
+        [[nodiscard]] std::string randomValue(uint64_t size);
+        [[nodiscard]] std::vector<std::string> randomRow(uint64_t rowId, bool lob);
+        [[nodiscard]] typeDba rowBdba(uint64_t rowId) const;
+        [[nodiscard]] static typeSlot rowSlot(uint64_t rowId);
+        [[nodiscard]] static Field fieldBytes(const std::string& value);
+        [[nodiscard]] static Field fieldColNums(const std::vector<uint16_t>& colNums);
+        [[nodiscard]] static Field fieldKtbRedo();
+        [[nodiscard]] static Field fieldKdo(typeDba bdba, uint8_t op, uint size);
+        [[nodiscard]] static Field fieldKdoQm(typeDba bdba, uint8_t op, const std::vector<typeSlot>& slots);
+        [[nodiscard]] static Field fieldKdoIrp(typeDba bdba, typeSlot slot, const std::vector<std::string>& row);
+        [[nodiscard]] static Field fieldKdoUrp(typeDba bdba, typeSlot slot, typeCC cc);
+        [[nodiscard]] static Field fieldSuppLog(typeCC cc, uint16_t before, uint16_t after);
+        [[nodiscard]] Field fieldKtudb(typeUsn usn, typeSlt slt) const;
+        [[nodiscard]] static Field fieldKtub(typeObj obj, typeSlt slt);
+        [[nodiscard]] static Field fieldKtuxid(typeSlt slt, uint32_t sqnValue, uint size);
+        void appendVector(Record& record, uint8_t op1, uint8_t op2, uint16_t cls, uint32_t afn, typeDba dba, const std::vector<Field>& fields) const;
+        static void setChSum(uint8_t* data);
+        [[nodiscard]] Record newRecord() const;
+
+        void addInsert(typeUsn usn, typeSlt slt, bool lob);
+        void addUpdate(typeUsn usn, typeSlt slt);
+        void addDelete(typeUsn usn, typeSlt slt);
+        void addInsertMultiple(typeUsn usn, typeSlt slt);
+        void addTransaction(uint64_t transaction);
+        void writeBlock(const uint8_t* data);
+        void writeLwn();
+        void writeHeader(uint64_t firstScn, uint32_t firstTime);
+
+    public:
+        // Workload definition
+        uint64_t files{4};
+        uint64_t transactions{10000};
+        uint64_t operations{4};
+        uint64_t transactionsPerLwn{8};
+        uint64_t tables{4};
+        uint64_t columns{8};
+        uint64_t rowsPerMulti{16};
+        uint64_t lobSize{3000};
+        uint64_t seed{1};
+        uint64_t weights[static_cast<uint>(OP::NUM)]{40, 30, 15, 5, 10};
+        uint32_t resetlogs{1000000000};
+        uint32_t sequenceFirst{1};
+        uint64_t scnFirst{1000000};
+
+        // Totals of the generated workload
+        uint64_t bytesWritten{0};
+        uint64_t rowsGenerated[static_cast<uint>(OP::NUM)]{};
+        uint64_t transactionsGenerated{0};
+
+        RedoGenerator() = default;
+
+        void setMix(const std::string& mix);
+        [[nodiscard]] std::string getFileName(const std::string& path, uint32_t fileSequence) const;
+        void generate(const std::string& path);
+        [[nodiscard]] static uint32_t encodeTime(uint year, uint month, uint day, uint hour, uint minute, uint second);
+    };
+}
+
+#endif
@@ -18,6 +18,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <cmath>
+#include <utility>
 #include <vector>
 
 #include "../common/DbColumn.h"
@@ -86,6 +87,55 @@ namespace OpenLogReplicator {
         valueBufferSize = VALUE_BUFFER_MIN;
     }
 
+    // DATE, TIMESTAMP and TIMESTAMP WITH LOCAL TIME ZONE share the format, only the local time zone value is moved to UTC
+    template<bool LOCAL_TZ>
+    void Builder::valueTimestamp(const std::string& columnName, const uint8_t* data, uint32_t size) {
+        if (size != 7 && size != 11) {
+            columnUnknown(columnName, data, size);
+            return;
+        }
+
+        int year;
+        const int month = data[2] - 1;  // 0..11
+        const int day = data[3] - 1;    // 0..30
+        const int hour = data[4] - 1;   // 0..23
+        const int minute = data[5] - 1; // 0..59
+        const int second = data[6] - 1; // 0..59
+
+        int val1 = data[0];
+        int val2 = data[1];
+        // AD
+        if (val1 >= 100 && val2 >= 100) {
+            val1 -= 100;
+            val2 -= 100;
+            year = (val1 * 100) + val2;
+
+        } else {
+            val1 = 100 - val1;
+            val2 = 100 - val2;
+            year = -((val1 * 100) + val2);
+        }
+
+        uint64_t fraction = 0;
+        if (size == 11)
+            fraction = Ctx::read32Big(data + 7);
+
+        if (second < 0 || second > 59 || minute < 0 || minute > 59 || hour < 0 || hour > 23 || day < 0 || day > 30 || month < 0 || month > 11 ||
+                fraction > 999999999) {
+            columnUnknown(columnName, data, size);
+            return;
+        }
+
+        time_t timestamp = dayToEpoch(year, month, day) + (hour * 3600) + (minute * 60) + second;
+        if constexpr (LOCAL_TZ)
+            timestamp -= metadata->dbTimezone;
+        if (year < 0 && fraction > 0) {
+            fraction = 1000000000 - fraction;
+            --timestamp;
+        }
+        columnTimestamp(columnName, timestamp, fraction);
+    }
+
     void Builder::processValue(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeCol col, const uint8_t* data, uint32_t size,
                                FileOffset fileOffset, bool after, bool compressed) {
         if (compressed) {
@@ -98,34 +148,23 @@ namespace OpenLogReplicator {
             columnRaw(columnName, data, size);
             return;
         }
-        DbColumn* column = table->columns[col];
-        if (ctx->isFlagSet(Ctx::REDO_FLAGS::RAW_COLUMN_DATA)) {
-            columnRaw(column->name, data, size);
-            return;
-        }
-        if (column->guard && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_GUARD_COLUMNS))
-            return;
-        if (column->nested && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_NESTED_COLUMNS))
-            return;
-        if (column->hidden && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_HIDDEN_COLUMNS))
-            return;
-        if (column->unused && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_UNUSED_COLUMNS))
+        const DbColumn* column = table->columns[col];
+        const DbTable::OutputColumn& outputColumn = table->outputPlan[col];
+        if (!outputColumn.visible)
             return;
 
         if (unlikely(size == 0))
             throw RedoLogException(50013, "trying to output null data for column: " + column->name + ", offset: " + fileOffset.toString());
 
-        if (column->storedAsLob) {
-            if (column->type == SysCol::COLTYPE::VARCHAR) {
-                // VARCHAR2 stored as CLOB
-                column->type = SysCol::COLTYPE::CLOB;
-            } else if (column->type == SysCol::COLTYPE::RAW) {
-                // RAW stored as BLOB
-                column->type = SysCol::COLTYPE::BLOB;
+        if (after && unlikely(!lobStreamed.empty())) {
+            const auto it = lobStreamed.find(col);
+            if (it != lobStreamed.end()) {
+                columnLobChunks(column->name, it->second.first, it->second.second);
+                return;
             }
         }
 
-        switch (column->type) {
+        switch (outputColumn.type) {
             case SysCol::COLTYPE::VARCHAR:
             case SysCol::COLTYPE::CHAR:
                 parseString(data, size, column->charsetId, fileOffset, false, false, false, table->systemTable > DbTable::TABLE::NONE);
@@ -165,90 +204,12 @@ namespace OpenLogReplicator {
                 break;
 
             case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
-                if (size != 7 && size != 11)
-                    columnUnknown(column->name, data, size);
-                else {
-                    int year;
-                    const int month = data[2] - 1;  // 0..11
-                    const int day = data[3] - 1;    // 0..30
-                    const int hour = data[4] - 1;   // 0..23
-                    const int minute = data[5] - 1; // 0..59
-                    const int second = data[6] - 1; // 0..59
-
-                    int val1 = data[0];
-                    int val2 = data[1];
-                    // AD
-                    if (val1 >= 100 && val2 >= 100) {
-                        val1 -= 100;
-                        val2 -= 100;
-                        year = (val1 * 100) + val2;
-
-                    } else {
-                        val1 = 100 - val1;
-                        val2 = 100 - val2;
-                        year = -((val1 * 100) + val2);
-                    }
-
-                    uint64_t fraction = 0;
-                    if (size == 11)
-                        fraction = Ctx::read32Big(data + 7);
-
-                    if (second < 0 || second > 59 || minute < 0 || minute > 59 || hour < 0 || hour > 23 || day < 0 || day > 30 || month < 0 || month > 11 ||
-                            fraction > 999999999) {
-                        columnUnknown(column->name, data, size);
-                    } else {
-                        time_t timestamp = Data::valuesToEpoch(year, month, day, hour, minute, second, metadata->dbTimezone);
-                        if (year < 0 && fraction > 0) {
-                            fraction = 1000000000 - fraction;
-                            --timestamp;
-                        }
-                        columnTimestamp(column->name, timestamp, fraction);
-                    }
-                }
+                valueTimestamp<true>(column->name, data, size);
                 break;
 
             case SysCol::COLTYPE::DATE:
             case SysCol::COLTYPE::TIMESTAMP:
-                if (size != 7 && size != 11)
-                    columnUnknown(column->name, data, size);
-                else {
-                    int year;
-                    const int month = data[2] - 1;  // 0..11
-                    const int day = data[3] - 1;    // 0..30
-                    const int hour = data[4] - 1;   // 0..23
-                    const int minute = data[5] - 1; // 0..59
-                    const int second = data[6] - 1; // 0..59
-
-                    int val1 = data[0];
-                    int val2 = data[1];
-                    // AD
-                    if (val1 >= 100 && val2 >= 100) {
-                        val1 -= 100;
-                        val2 -= 100;
-                        year = (val1 * 100) + val2;
-
-                    } else {
-                        val1 = 100 - val1;
-                        val2 = 100 - val2;
-                        year = -((val1 * 100) + val2);
-                    }
-
-                    uint64_t fraction = 0;
-                    if (size == 11)
-                        fraction = Ctx::read32Big(data + 7);
-
-                    if (second < 0 || second > 59 || minute < 0 || minute > 59 || hour < 0 || hour > 23 || day < 0 || day > 30 || month < 0 || month > 11 ||
-                            fraction > 999999999) {
-                        columnUnknown(column->name, data, size);
-                    } else {
-                        time_t timestamp = Data::valuesToEpoch(year, month, day, hour, minute, second, 0);
-                        if (year < 0 && fraction > 0) {
-                            fraction = 1000000000 - fraction;
-                            --timestamp;
-                        }
-                        columnTimestamp(column->name, timestamp, fraction);
-                    }
-                }
+                valueTimestamp<false>(column->name, data, size);
                 break;
 
             case SysCol::COLTYPE::RAW:
@@ -341,7 +302,7 @@ namespace OpenLogReplicator {
                     if (second < 0 || second > 59 || minute < 0 || minute > 59 || hour < 0 || hour > 23 || day < 0 || day > 30 || month < 0 || month > 11) {
                         columnUnknown(column->name, data, size);
                     } else {
-                        time_t timestamp = Data::valuesToEpoch(year, month, day, hour, minute, second, 0);
+                        time_t timestamp = dayToEpoch(year, month, day) + (hour * 3600) + (minute * 60) + second;
                         if (year < 0 && fraction > 0) {
                             fraction = 1000000000 - fraction;
                             --timestamp;
@@ -688,6 +649,131 @@ namespace OpenLogReplicator {
         maxMessageMb = maxMessageMb_;
     }
 
+    void Builder::setLobChunkSize(uint64_t newLobChunkSize) {
+        lobChunkSize = newLobChunkSize;
+    }
+
+    void Builder::setBatchLimits(uint64_t newBatchRowsMax, uint64_t newBatchSizeMax) {
+        batchRowsMax = newBatchRowsMax;
+        batchSizeMax = newBatchSizeMax;
+    }
+
+    bool Builder::matchesCondition(const DbTable* table, char op) {
+        if (table->conditionProgram == nullptr)
+            return true;
+
+        uint8_t bit;
+        switch (op) {
+            case 'i':
+                bit = 0x01;
+                break;
+            case 'u':
+                bit = 0x02;
+                break;
+            default:
+                bit = 0x04;
+        }
+
+        uint8_t& results = conditionResults[table];
+        if ((results & bit) == 0) {
+            results |= bit;
+            if (table->matchesCondition(ctx, op, attributes))
+                results |= bit << 3;
+        }
+        return (results & (bit << 3)) != 0;
+    }
+
+    // Column value filters compare raw column data, the second image is used when the first one doesn't contain the column. A column missing
+    // in both images is NULL for a full image (first and second are equal), otherwise the value is unknown and the filter is skipped.
+    bool Builder::matchesFilter(const DbTable* table, Format::VALUE_TYPE first, Format::VALUE_TYPE second) const {
+        for (const DbFilter& filter: table->filters) {
+            const typeCol column = filter.col;
+            if (values[column][+first] != nullptr) {
+                if (!filter.matches(values[column][+first], sizes[column][+first]))
+                    return false;
+            } else if (values[column][+second] != nullptr) {
+                if (!filter.matches(values[column][+second], sizes[column][+second]))
+                    return false;
+            } else if (first == second) {
+                if (!filter.matches(nullptr, 0))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    void Builder::lobStreamChunk(bool last) {
+        processLobChunk(last);
+        lobStream.offset += valueSize;
+        ++lobStream.chunks;
+        valueSize = 0;
+    }
+
+    void Builder::streamLobs(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                             typeSlot slot, FileOffset fileOffset) {
+        lobStreamed.clear();
+        if (lobChunkSize == 0 || table == nullptr || compressedAfter || ctx->isFlagSet(Ctx::REDO_FLAGS::RAW_COLUMN_DATA))
+            return;
+
+        // LOB values of the row larger than the chunk size are emitted before the row, which references them by the number of chunks.
+        // Smaller values are dropped here and parsed again with the row.
+        const typeCol baseMax = valuesMax >> 6;
+        for (typeCol base = 0; base <= baseMax; ++base) {
+            const auto columnBase = static_cast<typeCol>(base << 6);
+            typeMask set = valuesSet[base];
+            while (set != 0) {
+                const typeCol pos = ffsll(set) - 1;
+                set &= ~(1ULL << pos);
+                const typeCol col = columnBase + pos;
+
+                if (values[col][+Format::VALUE_TYPE::AFTER] == nullptr || sizes[col][+Format::VALUE_TYPE::AFTER] <= 0)
+                    continue;
+
+                const DbTable::OutputColumn& outputColumn = table->outputPlan[col];
+                if (!outputColumn.visible)
+                    continue;
+
+                bool isClob;
+                if (outputColumn.type == SysCol::COLTYPE::CLOB)
+                    isClob = true;
+                else if (outputColumn.type == SysCol::COLTYPE::BLOB &&
+                        !(table->columns[col]->xmlType && ctx->isFlagSet(Ctx::REDO_FLAGS::EXPERIMENTAL_XMLTYPE)))
+                    isClob = false;
+                else
+                    continue;
+
+                lobStream.table = table;
+                lobStream.col = col;
+                lobStream.sequence = sequence;
+                lobStream.scn = scn;
+                lobStream.timestamp = timestamp;
+                lobStream.obj = obj;
+                lobStream.dataObj = dataObj;
+                lobStream.bdba = bdba;
+                lobStream.slot = slot;
+                lobStream.isClob = isClob;
+                lobStream.offset = 0;
+                lobStream.chunks = 0;
+                lobStream.active = true;
+
+                if (isClob)
+                    parseLob(lobCtx, values[col][+Format::VALUE_TYPE::AFTER], sizes[col][+Format::VALUE_TYPE::AFTER], table->columns[col]->charsetId,
+                             table->obj, fileOffset, true, table->systemTable > DbTable::TABLE::NONE);
+                else
+                    parseLob(lobCtx, values[col][+Format::VALUE_TYPE::AFTER], sizes[col][+Format::VALUE_TYPE::AFTER], 0, table->obj, fileOffset, false,
+                             table->sys);
+                lobStream.active = false;
+
+                // The last chunk is emitted also for a LOB which turned out incomplete, to terminate the sequence
+                if (lobStream.chunks > 0) {
+                    lobStreamChunk(true);
+                    lobStreamed.insert_or_assign(col, std::make_pair(lobStream.chunks, lobStream.offset));
+                }
+                valueBufferPurge();
+            }
+        }
+    }
+
     void Builder::processBegin(Xid xid, uint16_t newThread, Seq newBeginSequence, Scn newBeginScn, Time newBeginTimestamp, Seq newCommitSequence,
                                Scn newCommitScn, Time newCommitTimestamp, const AttributeMap* newAttributes) {
         lastXid = xid;
@@ -704,6 +790,7 @@ namespace OpenLogReplicator {
         }
         newTran = true;
         attributes = newAttributes;
+        conditionResults.clear();
 
         if (attributes->empty()) {
             metadata->ctx->warning(50065, "empty attributes for XID: " + lastXid.toString());
@@ -770,7 +857,8 @@ namespace OpenLogReplicator {
                                                  redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                    table->matchesCondition(ctx, 'i', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                    matchesCondition(table, 'i') && (table->filters.empty() || matchesFilter(table, Format::VALUE_TYPE::AFTER,
+                    Format::VALUE_TYPE::AFTER))) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                     ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
                 processInsert(sequence, scn, timestamp, lobCtx, xmlCtx, table, redoLogRecord2->obj, redoLogRecord2->dataObj, redoLogRecord2->bdba,
                               ctx->read16(redoLogRecord2->data(redoLogRecord2->slotsDelta + (r * 2))), redoLogRecord1->fileOffset);
@@ -861,7 +949,8 @@ namespace OpenLogReplicator {
                                                  redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                    table->matchesCondition(ctx, 'd', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                    matchesCondition(table, 'd') && (table->filters.empty() || matchesFilter(table, Format::VALUE_TYPE::BEFORE,
+                    Format::VALUE_TYPE::BEFORE))) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                     ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
                 processDelete(sequence, scn, timestamp, lobCtx, xmlCtx, table, redoLogRecord2->obj, redoLogRecord2->dataObj,
                               redoLogRecord2->bdba, ctx->read16(redoLogRecord1->data(redoLogRecord1->slotsDelta + (r * 2))),
@@ -1425,6 +1514,17 @@ namespace OpenLogReplicator {
             }
         }
 
+        // Checked before unchanged columns are removed from UPDATE
+        bool filterMatch = true;
+        if (table != nullptr && !table->filters.empty() && !compressedBefore && !compressedAfter) {
+            if (transactionType == Format::TRANSACTION_TYPE::UPDATE)
+                filterMatch = matchesFilter(table, Format::VALUE_TYPE::AFTER, Format::VALUE_TYPE::BEFORE);
+            else if (transactionType == Format::TRANSACTION_TYPE::INSERT)
+                filterMatch = matchesFilter(table, Format::VALUE_TYPE::AFTER, Format::VALUE_TYPE::AFTER);
+            else if (transactionType == Format::TRANSACTION_TYPE::DELETE)
+                filterMatch = matchesFilter(table, Format::VALUE_TYPE::BEFORE, Format::VALUE_TYPE::BEFORE);
+        }
+
         if (transactionType == Format::TRANSACTION_TYPE::UPDATE) {
             if (!compressedBefore && !compressedAfter) {
                 baseMax = valuesMax >> 6;
@@ -1548,7 +1648,7 @@ namespace OpenLogReplicator {
                 systemTransaction->processUpdate(table, dataObj, bdba, slot, redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                    table->matchesCondition(ctx, 'u', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                    matchesCondition(table, 'u') && filterMatch) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                     ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
                 processUpdate(sequence, scn, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, redoLogRecord1->fileOffset);
                 if (ctx->metrics != nullptr) {
@@ -1629,7 +1729,7 @@ namespace OpenLogReplicator {
                 systemTransaction->processInsert(table, dataObj, bdba, slot, redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                    table->matchesCondition(ctx, 'i', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                    matchesCondition(table, 'i') && filterMatch) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                     ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
                 processInsert(sequence, scn, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, redoLogRecord1->fileOffset);
                 if (ctx->metrics != nullptr) {
@@ -1706,7 +1806,7 @@ namespace OpenLogReplicator {
                 systemTransaction->processDelete(table, dataObj, bdba, slot, redoLogRecord1->fileOffset);
 
             if ((!schema && table != nullptr && !DbTable::isSystemTable(table->options) && !DbTable::isDebugTable(table->options) &&
-                    table->matchesCondition(ctx, 'd', attributes)) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
+                    matchesCondition(table, 'd') && filterMatch) || ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_SYSTEM_TRANSACTIONS) ||
                     ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
                 processDelete(sequence, scn, timestamp, lobCtx, xmlCtx, table, obj, dataObj, bdba, slot, redoLogRecord1->fileOffset);
                 if (ctx->metrics != nullptr) {
@@ -1840,28 +1940,45 @@ namespace OpenLogReplicator {
         }
     }
 
+    const std::string_view* Builder::xmlPrefix(uint64_t nmSpc) const {
+        for (const auto& [prefixNmSpc, prefix]: xmlNmSpcPrefix)
+            if (prefixNmSpc == nmSpc)
+                return &prefix;
+        return nullptr;
+    }
+
+    void Builder::xmlAppendTag(uint64_t nmSpc, const std::string& localName) {
+        const uint64_t start = xmlTagNames.length();
+        const std::string_view* prefix = xmlPrefix(nmSpc);
+        if (prefix != nullptr) {
+            xmlTagNames.append(*prefix);
+            xmlTagNames.push_back(':');
+        }
+        xmlTagNames.append(localName);
+        xmlTags.push_back(start);
+    }
+
     // Parse binary XML format
     bool Builder::parseXml(const XmlCtx* xmlCtx, const uint8_t* data, uint64_t size, FileOffset fileOffset) {
-        if (valueBufferOld != nullptr) {
-            delete[] valueBufferOld;
-            valueBufferOld = nullptr;
+        // The buffers are swapped, the source value stays in valueBufferOld for output if decoding fails
+        if (valueBufferOld == nullptr) {
+            valueBufferOld = new char[VALUE_BUFFER_MIN];
+            valueBufferOldSize = VALUE_BUFFER_MIN;
         }
-
-        valueBufferOld = valueBuffer;
+        std::swap(valueBuffer, valueBufferOld);
+        std::swap(valueBufferSize, valueBufferOldSize);
         valueSizeOld = valueSize;
-        valueBuffer = new char[VALUE_BUFFER_MIN];
-        valueBufferSize = VALUE_BUFFER_MIN;
         valueSize = 0;
 
         // bool bigint = false;
-        std::string out;
         uint pos = 0;
-        std::vector<std::string> tags;
-        std::map<std::string, std::string> dictNmSpcMap;
-        std::map<std::string, std::string> nmSpcPrefixMap;
+        xmlTags.clear();
+        xmlTagNames.clear();
+        xmlLastTag.clear();
+        xmlDictNmSpc.clear();
+        xmlNmSpcPrefix.clear();
         bool tagOpen = false;
         bool attributeOpen = false;
-        std::string lastTag;
 
         while (pos < size) {
             // Header
@@ -2056,55 +2173,17 @@ namespace OpenLogReplicator {
                     isSingle = true;
                 }
 
-                std::string codeStr;
-                if (code < 0x100)
-                    codeStr = {
-                        Data::map16U((code >> 4) & 0x0F),
-                        Data::map16U(code & 0x0F)
-                    };
-                else if (code < 0x10000)
-                    codeStr = {
-                        Data::map16U((code >> 12) & 0x0F),
-                        Data::map16U((code >> 8) & 0x0F),
-                        Data::map16U((code >> 4) & 0x0F),
-                        Data::map16U(code & 0x0F)
-                    };
-                else if (code < 0x1000000)
-                    codeStr = {
-                        Data::map16U((code >> 20) & 0x0F),
-                        Data::map16U((code >> 16) & 0x0F),
-                        Data::map16U((code >> 12) & 0x0F),
-                        Data::map16U((code >> 8) & 0x0F),
-                        Data::map16U((code >> 4) & 0x0F),
-                        Data::map16U(code & 0x0F)
-                    };
-                else
-                    codeStr = {
-                        Data::map16U((code >> 28) & 0x0F),
-                        Data::map16U((code >> 24) & 0x0F),
-                        Data::map16U((code >> 20) & 0x0F),
-                        Data::map16U((code >> 16) & 0x0F),
-                        Data::map16U((code >> 12) & 0x0F),
-                        Data::map16U((code >> 8) & 0x0F),
-                        Data::map16U((code >> 4) & 0x0F),
-                        Data::map16U(code & 0x0F)
-                    };
-
-                auto xdbXQnMapIdIt = xmlCtx->xdbXQnPack.unorderedMapKey.find(XdbXQnKey(codeStr));
-                if (xdbXQnMapIdIt == xmlCtx->xdbXQnPack.unorderedMapKey.end()) {
-                    ctx->warning(60036, "incorrect XML data: string too short, can't decode qn   " + codeStr);
+                const XmlCtx::Token* token = xmlCtx->getToken(code);
+                if (token == nullptr) {
+                    ctx->warning(60036, "incorrect XML data: string too short, can't decode qn   " + std::to_string(code));
                     return false;
                 }
 
-                std::string tag = xdbXQnMapIdIt->second->localName;
-                // not very efficient, but it's not a problem
-                const uint64_t flagsSize = xdbXQnMapIdIt->second->flags.length();
-                const bool isAttribute = (((xdbXQnMapIdIt->second->flags.at(flagsSize - 1) - '0') & XdbXQn::FLAG_ISATTRIBUTE) != 0);
-
-                if (isAttribute) {
-                    out = " " + tag + "=\"";
-                    valueBufferCheck(out.length(), fileOffset);
-                    valueBufferAppend(out.c_str(), out.length());
+                if (token->isAttribute) {
+                    valueBufferCheck(token->localName.length() + 3, fileOffset);
+                    valueBufferAppend(' ');
+                    valueBufferAppend(token->localName.c_str(), token->localName.length());
+                    valueBufferAppend("=\"", 2);
                 } else {
                     if (attributeOpen) {
                         valueBufferCheck(2, fileOffset);
@@ -2116,19 +2195,17 @@ namespace OpenLogReplicator {
                         tagOpen = false;
                     }
 
-                    // append namespace to tag name
-                    const std::string nmSpcId = xdbXQnMapIdIt->second->nmSpcId;
-                    auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(nmSpcId);
-                    if (nmSpcPrefixMapIt != nmSpcPrefixMap.end())
-                        tag = nmSpcPrefixMapIt->second + ":" + tag;
-
-                    if (tagSize == 0 && !isSingle) {
-                        out = "<" + tag;
+                    // Tag name with namespace prefix is kept on the stack of open tags, closed by single values at once
+                    xmlAppendTag(token->nmSpc, token->localName);
+                    const uint64_t tagStart = xmlTags.back();
+                    const uint64_t tagLength = xmlTagNames.length() - tagStart;
+                    valueBufferCheck(tagLength + 2, fileOffset);
+                    valueBufferAppend('<');
+                    valueBufferAppend(xmlTagNames.data() + tagStart, tagLength);
+                    if (tagSize == 0 && !isSingle)
                         tagOpen = true;
-                    } else
-                        out = "<" + tag + ">";
-                    valueBufferCheck(out.length(), fileOffset);
-                    valueBufferAppend(out.c_str(), out.length());
+                    else
+                        valueBufferAppend('>');
                 }
 
                 if (tagSize > 0) {
@@ -2141,19 +2218,21 @@ namespace OpenLogReplicator {
                     pos += tagSize;
                 }
 
-                if (isAttribute) {
+                if (token->isAttribute) {
                     if (isSingle) {
                         valueBufferCheck(1, fileOffset);
                         valueBufferAppend('"');
                     } else
                         attributeOpen = true;
-                } else {
-                    if (isSingle) {
-                        out = "</" + tag + ">";
-                        valueBufferCheck(out.length(), fileOffset);
-                        valueBufferAppend(out.c_str(), out.length());
-                    } else
-                        tags.push_back(tag);
+                } else if (isSingle) {
+                    const uint64_t tagStart = xmlTags.back();
+                    const uint64_t tagLength = xmlTagNames.length() - tagStart;
+                    valueBufferCheck(tagLength + 3, fileOffset);
+                    valueBufferAppend("</", 2);
+                    valueBufferAppend(xmlTagNames.data() + tagStart, tagLength);
+                    valueBufferAppend('>');
+                    xmlTags.pop_back();
+                    xmlTagNames.resize(tagStart);
                 }
 
                 continue;
@@ -2176,51 +2255,21 @@ namespace OpenLogReplicator {
                 const uint16_t dict = Ctx::read16Big(data + pos);
                 pos += 2;
 
-                std::string nmSpcId;
-                if (nmSpc < 256)
-                    nmSpcId = {
-                        Data::map16U((nmSpc >> 4) & 0x0F),
-                        Data::map16U(nmSpc & 0x0F)
-                    };
-                else
-                    nmSpcId = {
-                        Data::map16U((nmSpc >> 12) & 0x0F),
-                        Data::map16U((nmSpc >> 8) & 0x0F),
-                        Data::map16U((nmSpc >> 4) & 0x0F),
-                        Data::map16U(nmSpc & 0x0F)
-                    };
-
-                std::string dictId;
-                if (dict < 256)
-                    dictId = {
-                        Data::map16U((dict >> 4) & 0x0F),
-                        Data::map16U(dict & 0x0F)
-                    };
-                else
-                    dictId = {
-                        Data::map16U((dict >> 12) & 0x0F),
-                        Data::map16U((dict >> 8) & 0x0F),
-                        Data::map16U((dict >> 4) & 0x0F),
-                        Data::map16U(dict & 0x0F)
-                    };
-
-                auto dictNmSpcMapIt = dictNmSpcMap.find(dictId);
-                if (dictNmSpcMapIt != dictNmSpcMap.end()) {
-                    ctx->warning(60036, "incorrect XML data: namespace " + dictId + " duplicated dict");
-                    return false;
+                for (const auto& [dictId, _]: xmlDictNmSpc) {
+                    if (dictId == dict) {
+                        ctx->warning(60036, "incorrect XML data: namespace " + std::to_string(dict) + " duplicated dict");
+                        return false;
+                    }
                 }
-                dictNmSpcMap.insert_or_assign(dictId, nmSpcId);
+                xmlDictNmSpc.emplace_back(dict, nmSpc);
 
                 if (tagSize > 0) {
-                    const std::string prefix(reinterpret_cast<const char*>(data + pos), tagSize);
-                    pos += tagSize;
-
-                    auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(nmSpcId);
-                    if (nmSpcPrefixMapIt != nmSpcPrefixMap.end()) {
-                        ctx->warning(60036, "incorrect XML data: namespace " + nmSpcId + " duplicated prefix");
+                    if (xmlPrefix(nmSpc) != nullptr) {
+                        ctx->warning(60036, "incorrect XML data: namespace " + std::to_string(nmSpc) + " duplicated prefix");
                         return false;
                     }
-                    nmSpcPrefixMap.insert_or_assign(nmSpcId, prefix);
+                    xmlNmSpcPrefix.emplace_back(nmSpc, std::string_view(reinterpret_cast<const char*>(data + pos), tagSize));
+                    pos += tagSize;
                 }
 
                 continue;
@@ -2237,53 +2286,34 @@ namespace OpenLogReplicator {
                 const uint16_t dict = Ctx::read16Big(data + pos);
                 pos += 2;
 
-                std::string dictId;
-                if (dict < 256)
-                    dictId = {
-                        Data::map16U((dict >> 4) & 0x0F),
-                        Data::map16U(dict & 0x0F)
-                    };
-                else
-                    dictId = {
-                        Data::map16U((dict >> 12) & 0x0F),
-                        Data::map16U((dict >> 8) & 0x0F),
-                        Data::map16U((dict >> 4) & 0x0F),
-                        Data::map16U(dict & 0x0F)
-                    };
-
-                auto dictNmSpcMapIt = dictNmSpcMap.find(dictId);
-                if (dictNmSpcMapIt == dictNmSpcMap.end()) {
-                    ctx->warning(60036, "incorrect XML data: namespace " + dictId + " not found for namespace");
+                const uint64_t* nmSpc = nullptr;
+                for (const auto& [dictId, dictNmSpc]: xmlDictNmSpc) {
+                    if (dictId == dict) {
+                        nmSpc = &dictNmSpc;
+                        break;
+                    }
+                }
+                if (nmSpc == nullptr) {
+                    ctx->warning(60036, "incorrect XML data: namespace " + std::to_string(dict) + " not found for namespace");
                     return false;
                 }
-                const std::string nmSpcId = dictNmSpcMapIt->second;
 
                 // search url
-                auto xdbXNmMapIdIt = xmlCtx->xdbXNmPack.unorderedMapKey.find(XdbXNmKey(nmSpcId));
-                if (xdbXNmMapIdIt == xmlCtx->xdbXNmPack.unorderedMapKey.end()) {
-                    ctx->warning(60036, "incorrect XML data: namespace " + nmSpcId + " not found");
+                const std::string* nmSpcUri = xmlCtx->getNmSpcUri(*nmSpc);
+                if (nmSpcUri == nullptr) {
+                    ctx->warning(60036, "incorrect XML data: namespace " + std::to_string(*nmSpc) + " not found");
                     return false;
                 }
 
-                valueBufferCheck(7, fileOffset);
+                const std::string_view* prefix = xmlPrefix(*nmSpc);
+                valueBufferCheck(nmSpcUri->length() + (prefix != nullptr ? prefix->length() : 0) + 10, fileOffset);
                 valueBufferAppend(" xmlns", 6);
-
-                auto nmSpcPrefixMapIt = nmSpcPrefixMap.find(nmSpcId);
-                if (nmSpcPrefixMapIt != nmSpcPrefixMap.end()) {
-                    valueBufferCheck(1, fileOffset);
+                if (prefix != nullptr) {
                     valueBufferAppend(':');
-
-                    valueBufferCheck(nmSpcPrefixMapIt->second.length(), fileOffset);
-                    valueBufferAppend(nmSpcPrefixMapIt->second.c_str(), nmSpcPrefixMapIt->second.length());
+                    valueBufferAppend(prefix->data(), prefix->length());
                 }
-
-                valueBufferCheck(2, fileOffset);
                 valueBufferAppend("=\"", 2);
-
-                valueBufferCheck(xdbXNmMapIdIt->second->nmSpcUri.length(), fileOffset);
-                valueBufferAppend(xdbXNmMapIdIt->second->nmSpcUri.c_str(), xdbXNmMapIdIt->second->nmSpcUri.length());
-
-                valueBufferCheck(1, fileOffset);
+                valueBufferAppend(nmSpcUri->c_str(), nmSpcUri->length());
                 valueBufferAppend('"');
 
                 continue;
@@ -2341,21 +2371,25 @@ namespace OpenLogReplicator {
             // end tag
             if (data[pos] == 0xD9) {
                 if (attributeOpen) {
-                    out = "\"";
+                    valueBufferCheck(1, fileOffset);
+                    valueBufferAppend('"');
                     attributeOpen = false;
                     tagOpen = true;
                 } else {
-                    if (tags.empty()) {
+                    if (xmlTags.empty()) {
                         ctx->warning(60036, "incorrect XML data: end tag found, but no tags open");
                         return false;
                     }
-                    lastTag = tags.back();
-                    tags.pop_back();
-                    out = "</" + lastTag + ">";
+                    const uint64_t tagStart = xmlTags.back();
+                    xmlTags.pop_back();
+                    xmlLastTag.assign(xmlTagNames, tagStart);
+                    xmlTagNames.resize(tagStart);
+
+                    valueBufferCheck(xmlLastTag.length() + 3, fileOffset);
+                    valueBufferAppend("</", 2);
+                    valueBufferAppend(xmlLastTag.c_str(), xmlLastTag.length());
+                    valueBufferAppend('>');
                 }
-
-                valueBufferCheck(out.length(), fileOffset);
-                valueBufferAppend(out.c_str(), out.length());
                 ++pos;
                 continue;
             }
@@ -2368,11 +2402,12 @@ namespace OpenLogReplicator {
 
             // repeat last tag
             if (data[pos] >= 0xD4 && data[pos] <= 0xD5) {
-                tags.push_back(lastTag);
-                out = "<" + lastTag;
+                xmlTags.push_back(xmlTagNames.length());
+                xmlTagNames.append(xmlLastTag);
                 tagOpen = true;
-                valueBufferCheck(out.length(), fileOffset);
-                valueBufferAppend(out.c_str(), out.length());
+                valueBufferCheck(xmlLastTag.length() + 1, fileOffset);
+                valueBufferAppend('<');
+                valueBufferAppend(xmlLastTag.c_str(), xmlLastTag.length());
                 ++pos;
                 continue;
             }
@@ -2389,11 +2424,29 @@ namespace OpenLogReplicator {
         return true;
     }
 
-    void Builder::releaseBuffers(Thread* t, uint64_t maxId) {
+    uint Builder::registerWriter() {
+        std::unique_lock const lck(mtx);
+        writersMaxId.push_back(0);
+        writersAttached.push_back(true);
+        ++writersAttachedNum;
+        return writersMaxId.size() - 1;
+    }
+
+    void Builder::releaseBuffers(Thread* t, uint writerNum, uint64_t maxId) {
         BuilderQueue* builderQueue;
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::BUILDER_RELEASE);
             std::unique_lock const lck(mtx);
+            if (writersMaxId[writerNum] < maxId)
+                writersMaxId[writerNum] = maxId;
+
+            // Buffers still used by any other writer are kept
+            for (uint i = 0; i < writersMaxId.size(); ++i)
+                if (writersAttached[i] && writersMaxId[i] < maxId)
+                    maxId = writersMaxId[i];
+            if (maxId > lastBuilderQueue->id)
+                maxId = lastBuilderQueue->id;
+
             builderQueue = firstBuilderQueue;
             while (firstBuilderQueue->id < maxId) {
                 firstBuilderQueue = firstBuilderQueue->next;
@@ -2412,6 +2465,35 @@ namespace OpenLogReplicator {
         }
     }
 
+    bool Builder::isWriterLagging(Thread* t, uint writerNum, uint64_t maxLagBuffers) {
+        bool lagging = false;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::BUILDER_RELEASE);
+            std::unique_lock const lck(mtx);
+            // The last attached writer is never detached, the parser is blocked instead; buffers are kept till the writer detaches
+            if (writersAttachedNum > 1 && lastBuilderQueue->id > writersMaxId[writerNum] + maxLagBuffers) {
+                --writersAttachedNum;
+                lagging = true;
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+        return lagging;
+    }
+
+    void Builder::detachWriter(Thread* t, uint writerNum) {
+        uint64_t maxId;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::BUILDER_RELEASE);
+            std::unique_lock const lck(mtx);
+            writersAttached[writerNum] = false;
+            maxId = lastBuilderQueue->id;
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        // Buffers kept only for the detached writer are released
+        releaseBuffers(t, writerNum, maxId);
+    }
+
     void Builder::releaseDdl() {
         while (ddlFirst != nullptr) {
             uint8_t* next = *reinterpret_cast<uint8_t**>(ddlFirst);
@@ -25,10 +25,13 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <cmath>
 #include <cstring>
 #include <deque>
+#include <limits>
 #include <map>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "../common/Attribute.h"
 #include "../common/Ctx.h"
@@ -75,7 +78,9 @@ namespace OpenLogReplicator {
             ALLOCATED  = 1 << 0,
             CONFIRMED  = 1 << 1,
             CHECKPOINT = 1 << 2,
-            REDO       = 1 << 3
+            REDO       = 1 << 3,
+            // Data isn't merged, ptr points to the BuilderQueue of the first part
+            SPLIT      = 1 << 4
         };
 
         void* ptr;
@@ -90,6 +95,8 @@ namespace OpenLogReplicator {
         typeObj obj;
         typeTag tagSize;
         OUTPUT_BUFFER flags;
+        // Time the redo data of the message was read from an online redo log, 0 when unknown
+        time_ut readTime;
 
         bool isFlagSet(OUTPUT_BUFFER flag) const {
             return (static_cast<uint>(flags) & static_cast<uint>(flag)) != 0;
@@ -126,6 +133,24 @@ namespace OpenLogReplicator {
         static constexpr uint8_t XML_PROLOG_PATHID{0x10};
         static constexpr uint8_t XML_PROLOG_BIGINT{0x40};
 
+        // LOB column of the current row emitted in chunks (format: lob-chunk-size)
+        class LobStream final {
+        public:
+            const DbTable* table{nullptr};
+            typeCol col{0};
+            Seq sequence{Seq::zero()};
+            Scn scn{Scn::none()};
+            Time timestamp{0};
+            typeObj obj{0};
+            typeDataObj dataObj{0};
+            typeDba bdba{0};
+            typeSlot slot{0};
+            bool isClob{false};
+            bool active{false};
+            uint64_t offset{0};
+            uint64_t chunks{0};
+        };
+
         Ctx* ctx;
         Locales* locales;
         Metadata* metadata;
@@ -141,6 +166,13 @@ namespace OpenLogReplicator {
         uint64_t valueBufferSize{0};
         char* valueBufferOld{nullptr};
         uint64_t valueSizeOld{0};
+        uint64_t valueBufferOldSize{0};
+        // State of parseXml kept between values to avoid allocations: open tags (offsets in xmlTagNames), namespaces of the value
+        std::vector<uint64_t> xmlTags;
+        std::string xmlTagNames;
+        std::string xmlLastTag;
+        std::vector<std::pair<uint64_t, uint64_t>> xmlDictNmSpc;
+        std::vector<std::pair<uint64_t, std::string_view>> xmlNmSpcPrefix;
         std::unordered_set<const DbTable*> tables;
         uint64_t lastBuilderSize{0};
         Scn beginScn{Scn::none()};
@@ -170,11 +202,31 @@ namespace OpenLogReplicator {
         bool compressedAfter{false};
         uint8_t prevChars[CharacterSet::MAX_CHARACTER_LENGTH * 2]{};
         uint64_t prevCharsSize{0};
+        uint64_t lobChunkSize{0};
+        // Limits of a message of the BATCH mode
+        uint64_t batchRowsMax{0};
+        uint64_t batchSizeMax{0};
+        LobStream lobStream;
+        // Columns of the current row already emitted in chunks: number of chunks and size
+        std::unordered_map<typeCol, std::pair<uint64_t, uint64_t>> lobStreamed;
+        // Last decoded and last formatted day, most date values of the output are from the same day
+        int dateYear{0};
+        int dateMonth{-1};
+        int dateDay{0};
+        time_t dateEpoch{0};
+        time_t isoDay{std::numeric_limits<time_t>::min()};
+        char isoDate[10]{};
         const AttributeMap* attributes{};
+        // Results of table conditions in the current transaction, which has the same attributes for all rows: bit 0-2 evaluated, bit 3-5 result
+        std::unordered_map<const DbTable*, uint8_t> conditionResults;
         uint16_t thread{0};
 
         std::mutex mtx;
         std::condition_variable condNoWriterWork;
+        // Output buffers are shared by all writers of the source, released when confirmed by all attached writers
+        std::vector<uint64_t> writersMaxId;
+        std::vector<bool> writersAttached;
+        uint64_t writersAttachedNum{0};
         char ddlSchemaName[SysUser::NAME_LENGTH]{};
         typeSize ddlSchemaSize{0};
 
@@ -219,6 +271,8 @@ namespace OpenLogReplicator {
             ctx->parserThread->contextSet(Thread::CONTEXT::TRAN, Thread::REASON::TRAN);
         }
 
+        template<bool LOCAL_TZ>
+        void valueTimestamp(const std::string& columnName, const uint8_t* data, uint32_t size);
         void processValue(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeCol col, const uint8_t* data, uint32_t size, FileOffset fileOffset,
                           bool after, bool compressed);
 
@@ -328,6 +382,7 @@ namespace OpenLogReplicator {
             msg->id = id++;
             msg->obj = obj;
             msg->flags = flags;
+            msg->readTime = lwnReadTime;
             msg->data = lastBuilderQueue->data + lastBuilderSize + sizeof(BuilderMsg);
         }
 
@@ -373,6 +428,49 @@ namespace OpenLogReplicator {
             }
         }
 
+        // (-)YYYY-MM-DD hh:mm:ss or (-)YYYY-MM-DDThh:mm:ss, the date part is formatted once per day
+        void appendIso8601(time_t timestamp, bool addT) {
+            time_t day = timestamp / 86400;
+            time_t secondOfDay = timestamp % 86400;
+            if (secondOfDay < 0) {
+                secondOfDay += 86400;
+                --day;
+            }
+
+            char buffer[22];
+            if (unlikely(day != isoDay)) {
+                if (unlikely(!Data::epochDayToIso8601(day, isoDate))) {
+                    appendArr(buffer, Data::epochToIso8601(timestamp, buffer, addT, false));
+                    return;
+                }
+                isoDay = day;
+            }
+
+            const auto second = static_cast<uint>(secondOfDay);
+            memcpy(buffer, isoDate, sizeof(isoDate));
+            buffer[10] = addT ? 'T' : ' ';
+            buffer[11] = Data::map10(second / 36000);
+            buffer[12] = Data::map10((second / 3600) % 10);
+            buffer[13] = ':';
+            buffer[14] = Data::map10((second / 600) % 6);
+            buffer[15] = Data::map10((second / 60) % 10);
+            buffer[16] = ':';
+            buffer[17] = Data::map10((second % 60) / 10);
+            buffer[18] = Data::map10(second % 10);
+            appendArr(buffer, 19);
+        }
+
+        // Epoch of the start of the day, the calendar is computed once per day
+        time_t dayToEpoch(int year, int month, int day) {
+            if (unlikely(year != dateYear || month != dateMonth || day != dateDay)) {
+                dateEpoch = Data::valuesToEpoch(year, month, day, 0, 0, 0, 0);
+                dateYear = year;
+                dateMonth = month;
+                dateDay = day;
+            }
+            return dateEpoch;
+        }
+
         template<bool fast = false>
         void append(const std::string_view& str) {
             appendArr<fast>(str.data(), str.size());
@@ -583,6 +681,9 @@ namespace OpenLogReplicator {
                 memcpy(valueBuffer + valueSize, data, size);
                 valueSize += size;
             }
+
+            if (unlikely(lobStream.active) && valueSize >= lobChunkSize)
+                lobStreamChunk(false);
         }
 
         bool parseLob(LobCtx* lobCtx, const uint8_t* data, uint64_t size, uint64_t charsetId, typeObj obj, FileOffset fileOffset, bool isClob, bool isSystem) {
@@ -612,7 +713,8 @@ namespace OpenLogReplicator {
                     return true;
                 }
                 LobData* lobData = lobsIt->second;
-                valueBufferCheck(lobData->pageSize * static_cast<uint64_t>(lobData->sizePages) + lobData->sizeRest, fileOffset);
+                if (likely(!lobStream.active))
+                    valueBufferCheck(lobData->pageSize * static_cast<uint64_t>(lobData->sizePages) + lobData->sizeRest, fileOffset);
 
                 typeDba pageNo = 0;
                 for (const auto& [pageNoLob, page]: lobData->indexMap) {
@@ -1226,6 +1328,13 @@ namespace OpenLogReplicator {
         virtual void columnRowId(const std::string& columnName, RowId rowId) = 0;
         virtual void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) = 0;
         virtual void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) = 0;
+        virtual void columnLobChunks(const std::string& columnName, uint64_t chunks, uint64_t size) = 0;
+        virtual void processLobChunk(bool last) = 0;
+        void lobStreamChunk(bool last);
+        [[nodiscard]] bool matchesCondition(const DbTable* table, char op);
+        [[nodiscard]] bool matchesFilter(const DbTable* table, Format::VALUE_TYPE first, Format::VALUE_TYPE second) const;
+        void streamLobs(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const DbTable* table, typeObj obj, typeDataObj dataObj, typeDba bdba,
+                        typeSlot slot, FileOffset fileOffset);
         virtual void processInsert(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
                                    typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) = 0;
         virtual void processUpdate(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
@@ -1234,6 +1343,8 @@ namespace OpenLogReplicator {
                                    typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) = 0;
         virtual void processDdl(Seq sequence, Scn scn, Time timestamp, const DbTable* table, typeObj obj) = 0;
         virtual void processBeginMessage(Seq sequence, Time timestamp) = 0;
+        [[nodiscard]] const std::string_view* xmlPrefix(uint64_t nmSpc) const;
+        void xmlAppendTag(uint64_t nmSpc, const std::string& localName);
         bool parseXml(const XmlCtx* xmlCtx, const uint8_t* data, uint64_t size, FileOffset fileOffset);
 
     public:
@@ -1243,13 +1354,17 @@ namespace OpenLogReplicator {
         BuilderQueue* lastBuilderQueue{nullptr};
         Scn lwnScn{Scn::none()};
         typeIdx lwnIdx{0};
+        // Time the current LWN was read from an online redo log
+        time_ut lwnReadTime{0};
 
         Builder(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, const Format& newFormat, uint64_t newFlushBuffer);
         virtual ~Builder();
 
-        [[nodiscard]] uint64_t builderSize() const;
+        [[nodiscard]] virtual uint64_t builderSize() const;
         [[nodiscard]] uint64_t getMaxMessageMb() const;
         void setMaxMessageMb(uint64_t maxMessageMb);
+        void setLobChunkSize(uint64_t newLobChunkSize);
+        void setBatchLimits(uint64_t newBatchRowsMax, uint64_t newBatchSizeMax);
         void processBegin(Xid xid, uint16_t newThread, Seq newBeginSequence, Scn newBeginScn, Time newBeginTimestamp, Seq newCommitSequence, Scn newCommitScn,
                           Time newCommitTimestamp, const AttributeMap* newAttributes);
         void processInsertMultiple(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const RedoLogRecord* redoLogRecord1,
@@ -1262,7 +1377,10 @@ namespace OpenLogReplicator {
         virtual void initialize();
         virtual void processCommit() = 0;
         virtual void processCheckpoint(Seq sequence, Scn scn, Time timestamp, FileOffset fileOffset, bool redo) = 0;
-        void releaseBuffers(Thread* t, uint64_t maxId);
+        uint registerWriter();
+        void releaseBuffers(Thread* t, uint writerNum, uint64_t maxId);
+        [[nodiscard]] bool isWriterLagging(Thread* t, uint writerNum, uint64_t maxLagBuffers);
+        void detachWriter(Thread* t, uint writerNum);
         void releaseDdl();
         void appendDdlChunk(const uint8_t* data, typeTransactionSize size);
         void sleepForWriterWork(Thread* t, uint64_t queueSize, uint64_t nanoseconds);
@@ -0,0 +1,734 @@
+/* Memory buffer for handling output buffer in Apache Arrow IPC format
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+#include <utility>
+
+#include "../common/DbColumn.h"
+#include "../common/DbTable.h"
+#include "../common/types/IntX.h"
+#include "../common/types/RowId.h"
+#include "BuilderArrow.h"
+
+namespace OpenLogReplicator {
+    // Message.fbs and Schema.fbs of the Arrow columnar format
+    namespace {
+        constexpr uint64_t METADATA_VERSION_V5{4};
+        constexpr uint64_t HEADER_SCHEMA{1};
+        constexpr uint64_t HEADER_RECORD_BATCH{3};
+        constexpr uint64_t TYPE_INT{2};
+        constexpr uint64_t TYPE_FLOATING_POINT{3};
+        constexpr uint64_t TYPE_BINARY{4};
+        constexpr uint64_t TYPE_UTF8{5};
+        constexpr uint64_t TYPE_DECIMAL{7};
+        constexpr uint64_t TYPE_TIMESTAMP{10};
+        constexpr uint64_t PRECISION_SINGLE{1};
+        constexpr uint64_t PRECISION_DOUBLE{2};
+        constexpr uint64_t TIME_UNIT_MICROSECOND{2};
+        constexpr uint32_t CONTINUATION{0xFFFFFFFF};
+        constexpr char PADDING[8]{};
+
+        uint64_t pad8(uint64_t size) {
+            return (size + 7) & 0xFFFFFFFFFFFFFFF8;
+        }
+    }
+
+    void BuilderArrow::Flatbuffer::pad(uint64_t alignment) {
+        while ((data.size() & (alignment - 1)) != 0)
+            data.push_back(0);
+    }
+
+    void BuilderArrow::Flatbuffer::put(uint64_t value, uint8_t size) {
+        for (uint8_t i = 0; i < size; ++i) {
+            data.push_back(static_cast<char>(value & 0xFF));
+            value >>= 8;
+        }
+    }
+
+    void BuilderArrow::Flatbuffer::patch(uint64_t position, uint64_t target) {
+        const uint64_t offset = target - position;
+        for (uint i = 0; i < 4; ++i)
+            data[position + i] = static_cast<char>((offset >> (i * 8)) & 0xFF);
+    }
+
+    uint64_t BuilderArrow::Flatbuffer::table(const Slot* slots, uint count, uint64_t* positions) {
+        // Widest fields first, the table starts aligned to 8, so every field is aligned to own size
+        uint64_t offsets[8]{};
+        uint64_t size = 4;
+        for (uint8_t width = 8; width > 0; width >>= 1) {
+            for (uint i = 0; i < count; ++i) {
+                if (slots[i].size != width)
+                    continue;
+                size = (size + width - 1) & ~static_cast<uint64_t>(width - 1);
+                offsets[i] = size;
+                size += width;
+            }
+        }
+
+        pad(2);
+        const uint64_t vtable = data.size();
+        const uint64_t start = pad8(vtable + 4 + (2 * count));
+        put(4 + (2 * count), 2);
+        put(size, 2);
+        for (uint i = 0; i < count; ++i)
+            put(offsets[i], 2);
+        data.resize(start, 0);
+
+        put(start - vtable, 4);
+        data.resize(start + size, 0);
+        for (uint i = 0; i < count; ++i) {
+            positions[i] = 0;
+            if (slots[i].size == 0)
+                continue;
+            positions[i] = start + offsets[i];
+            uint64_t value = slots[i].value;
+            for (uint8_t j = 0; j < slots[i].size; ++j) {
+                data[positions[i] + j] = static_cast<char>(value & 0xFF);
+                value >>= 8;
+            }
+        }
+        return start;
+    }
+
+    void BuilderArrow::Flatbuffer::string(uint64_t position, std::string_view value) {
+        pad(4);
+        patch(position, data.size());
+        put(value.size(), 4);
+        data.append(value);
+        data.push_back(0);
+    }
+
+    uint64_t BuilderArrow::Flatbuffer::vector(uint64_t position, uint32_t count, uint8_t alignment) {
+        pad(4);
+        while (((data.size() + 4) & (alignment - 1)) != 0)
+            data.push_back(0);
+        patch(position, data.size());
+        put(count, 4);
+        return data.size();
+    }
+
+    BuilderArrow::Column::Column(std::string newName, TYPE newType, int newPrecision, int newScale):
+            name(std::move(newName)),
+            type(newType),
+            precision(newPrecision),
+            scale(newScale) {
+        clear();
+    }
+
+    uint8_t BuilderArrow::Column::width() const {
+        switch (type) {
+            case TYPE::FLOAT32:
+                return 4;
+            case TYPE::DECIMAL:
+                return 16;
+            case TYPE::UTF8:
+            case TYPE::BINARY:
+                return 0;
+            default:
+                return 8;
+        }
+    }
+
+    void BuilderArrow::Column::appendNull() {
+        if ((length & 7) == 0)
+            validity.push_back(0);
+        ++nullCount;
+        ++length;
+        if (isVariable()) {
+            const auto offset = static_cast<uint32_t>(values.size());
+            offsets.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        } else
+            values.append(width(), 0);
+    }
+
+    void BuilderArrow::Column::appendValid() {
+        if ((length & 7) == 0)
+            validity.push_back(0);
+        validity.back() = static_cast<char>(validity.back() | (1 << (length & 7)));
+        ++length;
+    }
+
+    void BuilderArrow::Column::appendFixed(const void* data, uint8_t size) {
+        appendValid();
+        values.append(reinterpret_cast<const char*>(data), size);
+    }
+
+    void BuilderArrow::Column::appendVariable(const char* data, uint64_t size) {
+        appendValid();
+        values.append(data, size);
+        const auto offset = static_cast<uint32_t>(values.size());
+        offsets.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+
+    void BuilderArrow::Column::clear() {
+        length = 0;
+        nullCount = 0;
+        validity.clear();
+        offsets.clear();
+        values.clear();
+        if (isVariable())
+            offsets.append(sizeof(uint32_t), 0);
+    }
+
+    BuilderArrow::BuilderArrow(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer):
+            Builder(newCtx, newLocales, newMetadata, newFormat, newFlushBuffer) {}
+
+    BuilderArrow::~BuilderArrow() {
+        for (const Batch* batch: batches)
+            delete batch;
+        batches.clear();
+        batchMap.clear();
+    }
+
+    void BuilderArrow::fieldType(const DbColumn* dbColumn, SysCol::COLTYPE type, TYPE& arrowType, int& precision, int& scale) {
+        precision = 0;
+        scale = 0;
+        switch (type) {
+            case SysCol::COLTYPE::NUMBER:
+                // NUMBER without precision is a decimal floating point, kept as text
+                if (dbColumn->scale == 0 && dbColumn->precision > 0 && dbColumn->precision <= 18) {
+                    arrowType = TYPE::INT64;
+                } else if (dbColumn->scale >= 0 && dbColumn->precision > 0 && dbColumn->precision <= 38 && dbColumn->scale <= dbColumn->precision) {
+                    arrowType = TYPE::DECIMAL;
+                    precision = dbColumn->precision;
+                    scale = dbColumn->scale;
+                } else if (dbColumn->scale == 0 && dbColumn->precision == -1) {
+                    arrowType = TYPE::DECIMAL;
+                    precision = 38;
+                } else
+                    arrowType = TYPE::UTF8;
+                break;
+
+            case SysCol::COLTYPE::FLOAT:
+                arrowType = TYPE::FLOAT32;
+                break;
+
+            case SysCol::COLTYPE::DOUBLE:
+                arrowType = TYPE::FLOAT64;
+                break;
+
+            case SysCol::COLTYPE::DATE:
+            case SysCol::COLTYPE::TIMESTAMP:
+                arrowType = TYPE::TIMESTAMP;
+                break;
+
+            case SysCol::COLTYPE::TIMESTAMP_WITH_TZ:
+            case SysCol::COLTYPE::TIMESTAMP_WITH_LOCAL_TZ:
+                arrowType = TYPE::TIMESTAMP_UTC;
+                break;
+
+            case SysCol::COLTYPE::RAW:
+            case SysCol::COLTYPE::BLOB:
+            case SysCol::COLTYPE::JSON:
+                arrowType = TYPE::BINARY;
+                break;
+
+            default:
+                arrowType = TYPE::UTF8;
+        }
+    }
+
+    BuilderArrow::Batch* BuilderArrow::getBatch(Seq sequence, Scn scn, const DbTable* table, typeObj obj) {
+        const auto it = batchMap.find(table);
+        if (it != batchMap.end()) {
+            Batch* batch = it->second;
+            if (batch->rows == 0) {
+                batch->sequence = sequence;
+                batch->scn = scn;
+            }
+            return batch;
+        }
+
+        auto* batch = new Batch();
+        batch->table = table;
+        batch->obj = obj;
+        batch->sequence = sequence;
+        batch->scn = scn;
+        batch->columns.emplace_back("op", TYPE::UTF8, 0, 0);
+        batch->columns.emplace_back("scn", TYPE::UINT64, 0, 0);
+        batch->columns.emplace_back("xid", TYPE::UINT64, 0, 0);
+        for (typeCol col = 0; col < static_cast<typeCol>(table->columns.size()); ++col) {
+            const DbColumn* dbColumn = table->columns[col];
+            if (dbColumn == nullptr || !table->outputPlan[col].visible)
+                continue;
+
+            TYPE arrowType;
+            int precision;
+            int scale;
+            fieldType(dbColumn, table->outputPlan[col].type, arrowType, precision, scale);
+            batch->cols.push_back(col);
+            batch->columns.emplace_back(dbColumn->name, arrowType, precision, scale);
+        }
+        buildSchema(batch);
+        batch->metaSize = pad8(flatbuffer.data.size()) + MESSAGE_META + (batch->columns.size() * COLUMN_META);
+
+        batches.push_back(batch);
+        batchMap.insert_or_assign(table, batch);
+        return batch;
+    }
+
+    void BuilderArrow::appendRow(Seq sequence, Scn scn, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj, char op,
+                                 Format::VALUE_TYPE valueType, bool compressed, FileOffset fileOffset) {
+        // Without the table there is no schema of the record batch
+        if (unlikely(table == nullptr))
+            return;
+
+        Batch* batch = getBatch(sequence, scn, table, obj);
+        const uint64_t scnValue = format.isScnTypeCommitValue() ? commitScn.getData() : scn.getData();
+        const uint64_t xidValue = lastXid.getData();
+        batch->columns[0].appendVariable(&op, 1);
+        batch->columns[1].appendFixed(&scnValue, sizeof(scnValue));
+        batch->columns[2].appendFixed(&xidValue, sizeof(xidValue));
+
+        for (uint64_t i = 0; i < batch->cols.size(); ++i) {
+            const typeCol col = batch->cols[i];
+            column = &batch->columns[FIELDS_META + i];
+            const uint64_t length = column->length;
+            if (values[col][+valueType] != nullptr && sizes[col][+valueType] > 0)
+                processValue(lobCtx, xmlCtx, table, col, values[col][+valueType], sizes[col][+valueType], fileOffset,
+                             valueType == Format::VALUE_TYPE::AFTER, compressed);
+            // Values which can't be represented in the type of the field are null
+            if (column->length == length)
+                column->appendNull();
+        }
+        column = nullptr;
+
+        uint64_t size = 0;
+        for (const Column& field: batch->columns)
+            size += field.size();
+        batch->rowSizeMax = std::max(batch->rowSizeMax, size - batch->size);
+        batch->size = size;
+
+        // The next row must fit too
+        ++batch->rows;
+        if (batch->rows >= BATCH_ROWS_MAX || batch->size + batch->rowSizeMax > batchSizeMax(batch))
+            flushBatch(batch);
+    }
+
+    uint64_t BuilderArrow::batchSizeMax(const Batch* batch) const {
+        if (maxMessageMb == 0)
+            return BATCH_SIZE_MAX;
+
+        const uint64_t messageMax = maxMessageMb * 1024 * 1024;
+        if (messageMax <= batch->metaSize + MESSAGE_MARGIN)
+            return 0;
+        return std::min(BATCH_SIZE_MAX, messageMax - batch->metaSize - MESSAGE_MARGIN);
+    }
+
+    uint64_t BuilderArrow::builderSize() const {
+        // Every record batch is sent as a separate message, the biggest one counts for dividing big transactions
+        uint64_t size = Builder::builderSize();
+        for (const Batch* batch: batches)
+            if (batch->rows > 0)
+                size = std::max(size, batch->size + batch->metaSize);
+        return size;
+    }
+
+    void BuilderArrow::appendBlock(const char* data, uint64_t size) {
+        while (size > 0) {
+            uint64_t chunk = OUTPUT_BUFFER_DATA_SIZE - lastBuilderSize - messagePosition - 1;
+            if (chunk > size)
+                chunk = size;
+            appendArr<true>(data, chunk);
+            data += chunk;
+            size -= chunk;
+            if (size > 0) {
+                append(*data++);
+                --size;
+            }
+        }
+    }
+
+    void BuilderArrow::appendMessage(const std::string& header) {
+        // Encapsulated message: continuation marker, metadata size, metadata padded to 8 bytes
+        const uint32_t headerSize = pad8(header.size());
+        appendBlock(reinterpret_cast<const char*>(&CONTINUATION), sizeof(CONTINUATION));
+        appendBlock(reinterpret_cast<const char*>(&headerSize), sizeof(headerSize));
+        appendBlock(header.data(), header.size());
+        appendBlock(PADDING, headerSize - header.size());
+    }
+
+    void BuilderArrow::buildSchema(const Batch* batch) {
+        flatbuffer.data.clear();
+        flatbuffer.put(0, 4);
+
+        uint64_t messagePositions[4];
+        const Flatbuffer::Slot messageSlots[]{{2, METADATA_VERSION_V5}, {1, HEADER_SCHEMA}, {4, 0}, {8, 0}};
+        flatbuffer.patch(0, flatbuffer.table(messageSlots, 4, messagePositions));
+
+        uint64_t schemaPositions[2];
+        const Flatbuffer::Slot schemaSlots[]{{2, 0}, {4, 0}};
+        flatbuffer.patch(messagePositions[2], flatbuffer.table(schemaSlots, 2, schemaPositions));
+
+        const uint64_t fields = flatbuffer.vector(schemaPositions[1], batch->columns.size(), 4);
+        for (uint64_t i = 0; i < batch->columns.size(); ++i)
+            flatbuffer.put(0, 4);
+
+        for (uint64_t i = 0; i < batch->columns.size(); ++i) {
+            const Column& field = batch->columns[i];
+            uint64_t typeType;
+            switch (field.type) {
+                case TYPE::INT64:
+                case TYPE::UINT64:
+                    typeType = TYPE_INT;
+                    break;
+                case TYPE::FLOAT32:
+                case TYPE::FLOAT64:
+                    typeType = TYPE_FLOATING_POINT;
+                    break;
+                case TYPE::DECIMAL:
+                    typeType = TYPE_DECIMAL;
+                    break;
+                case TYPE::TIMESTAMP:
+                case TYPE::TIMESTAMP_UTC:
+                    typeType = TYPE_TIMESTAMP;
+                    break;
+                case TYPE::BINARY:
+                    typeType = TYPE_BINARY;
+                    break;
+                default:
+                    typeType = TYPE_UTF8;
+            }
+
+            // Field: name, nullable, type, dictionary, children
+            uint64_t fieldPositions[6];
+            const Flatbuffer::Slot fieldSlots[]{{4, 0}, {1, i >= FIELDS_META ? 1U : 0U}, {1, typeType}, {4, 0}, {0, 0}, {4, 0}};
+            flatbuffer.patch(fields + (i * 4), flatbuffer.table(fieldSlots, 6, fieldPositions));
+            flatbuffer.string(fieldPositions[0], field.name);
+
+            uint64_t typePositions[3];
+            switch (field.type) {
+                case TYPE::INT64:
+                case TYPE::UINT64: {
+                    const Flatbuffer::Slot typeSlots[]{{4, 64}, {1, field.type == TYPE::INT64 ? 1U : 0U}};
+                    flatbuffer.patch(fieldPositions[3], flatbuffer.table(typeSlots, 2, typePositions));
+                    break;
+                }
+                case TYPE::FLOAT32:
+                case TYPE::FLOAT64: {
+                    const Flatbuffer::Slot typeSlots[]{{2, field.type == TYPE::FLOAT32 ? PRECISION_SINGLE : PRECISION_DOUBLE}};
+                    flatbuffer.patch(fieldPositions[3], flatbuffer.table(typeSlots, 1, typePositions));
+                    break;
+                }
+                case TYPE::DECIMAL: {
+                    const Flatbuffer::Slot typeSlots[]{{4, static_cast<uint64_t>(field.precision)}, {4, static_cast<uint64_t>(field.scale)}, {4, 128}};
+                    flatbuffer.patch(fieldPositions[3], flatbuffer.table(typeSlots, 3, typePositions));
+                    break;
+                }
+                case TYPE::TIMESTAMP:
+                case TYPE::TIMESTAMP_UTC: {
+                    const Flatbuffer::Slot typeSlots[]{{2, TIME_UNIT_MICROSECOND}, {field.type == TYPE::TIMESTAMP_UTC ? uint8_t{4} : uint8_t{0}, 0}};
+                    flatbuffer.patch(fieldPositions[3], flatbuffer.table(typeSlots, 2, typePositions));
+                    if (field.type == TYPE::TIMESTAMP_UTC)
+                        flatbuffer.string(typePositions[1], "UTC");
+                    break;
+                }
+                default:
+                    flatbuffer.patch(fieldPositions[3], flatbuffer.table(nullptr, 0, typePositions));
+            }
+
+            flatbuffer.vector(fieldPositions[5], 0, 4);
+        }
+    }
+
+    void BuilderArrow::appendSchema(const Batch* batch) {
+        buildSchema(batch);
+        appendMessage(flatbuffer.data);
+    }
+
+    void BuilderArrow::appendRecordBatch(const Batch* batch) {
+        uint64_t bodyLength = 0;
+        uint32_t buffers = 0;
+        for (const Column& field: batch->columns) {
+            bodyLength += pad8(field.validity.size()) + pad8(field.offsets.size()) + pad8(field.values.size());
+            buffers += field.isVariable() ? 3 : 2;
+        }
+
+        flatbuffer.data.clear();
+        flatbuffer.put(0, 4);
+
+        uint64_t messagePositions[4];
+        const Flatbuffer::Slot messageSlots[]{{2, METADATA_VERSION_V5}, {1, HEADER_RECORD_BATCH}, {4, 0}, {8, bodyLength}};
+        flatbuffer.patch(0, flatbuffer.table(messageSlots, 4, messagePositions));
+
+        // RecordBatch: length, nodes, buffers
+        uint64_t recordBatchPositions[3];
+        const Flatbuffer::Slot recordBatchSlots[]{{8, batch->rows}, {4, 0}, {4, 0}};
+        flatbuffer.patch(messagePositions[2], flatbuffer.table(recordBatchSlots, 3, recordBatchPositions));
+
+        flatbuffer.vector(recordBatchPositions[1], batch->columns.size(), 8);
+        for (const Column& field: batch->columns) {
+            flatbuffer.put(field.length, 8);
+            flatbuffer.put(field.nullCount, 8);
+        }
+
+        flatbuffer.vector(recordBatchPositions[2], buffers, 8);
+        uint64_t offset = 0;
+        for (const Column& field: batch->columns) {
+            flatbuffer.put(offset, 8);
+            flatbuffer.put(field.validity.size(), 8);
+            offset += pad8(field.validity.size());
+            if (field.isVariable()) {
+                flatbuffer.put(offset, 8);
+                flatbuffer.put(field.offsets.size(), 8);
+                offset += pad8(field.offsets.size());
+            }
+            flatbuffer.put(offset, 8);
+            flatbuffer.put(field.values.size(), 8);
+            offset += pad8(field.values.size());
+        }
+
+        appendMessage(flatbuffer.data);
+        for (const Column& field: batch->columns) {
+            appendBlock(field.validity.data(), field.validity.size());
+            appendBlock(PADDING, pad8(field.validity.size()) - field.validity.size());
+            if (field.isVariable()) {
+                appendBlock(field.offsets.data(), field.offsets.size());
+                appendBlock(PADDING, pad8(field.offsets.size()) - field.offsets.size());
+            }
+            appendBlock(field.values.data(), field.values.size());
+            appendBlock(PADDING, pad8(field.values.size()) - field.values.size());
+        }
+    }
+
+    void BuilderArrow::flushBatch(Batch* batch) {
+        if (batch->rows == 0)
+            return;
+
+        builderBegin(batch->sequence, batch->scn, batch->obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+        appendSchema(batch);
+        appendRecordBatch(batch);
+        // End of stream
+        const uint32_t end[2]{CONTINUATION, 0};
+        appendBlock(reinterpret_cast<const char*>(end), sizeof(end));
+        builderCommit();
+
+        batch->rows = 0;
+        batch->size = 0;
+        for (Column& field: batch->columns)
+            field.clear();
+    }
+
+    void BuilderArrow::flushBatches() {
+        for (Batch* batch: batches) {
+            flushBatch(batch);
+            delete batch;
+        }
+        batches.clear();
+        batchMap.clear();
+    }
+
+    void BuilderArrow::columnFloat(const std::string& columnName __attribute__((unused)), double value) {
+        if (column->type == TYPE::FLOAT32) {
+            const auto valueFloat = static_cast<float>(value);
+            column->appendFixed(&valueFloat, sizeof(valueFloat));
+        } else if (column->type == TYPE::FLOAT64)
+            column->appendFixed(&value, sizeof(value));
+    }
+
+    void BuilderArrow::columnDouble(const std::string& columnName __attribute__((unused)), long double value) {
+        if (column->type == TYPE::FLOAT32) {
+            const auto valueFloat = static_cast<float>(value);
+            column->appendFixed(&valueFloat, sizeof(valueFloat));
+        } else if (column->type == TYPE::FLOAT64) {
+            const auto valueDouble = static_cast<double>(value);
+            column->appendFixed(&valueDouble, sizeof(valueDouble));
+        }
+    }
+
+    void BuilderArrow::columnString(const std::string& columnName __attribute__((unused))) {
+        if (column->isVariable())
+            column->appendVariable(valueBuffer, valueSize);
+    }
+
+    void BuilderArrow::columnNumber(const std::string& columnName, int precision __attribute__((unused)),
+                                    int scale __attribute__((unused))) {
+        valueBuffer[valueSize] = 0;
+        switch (column->type) {
+            case TYPE::INT64: {
+                char* retPtr;
+                const int64_t value = strtoll(valueBuffer, &retPtr, 10);
+                if (retPtr == valueBuffer + valueSize)
+                    column->appendFixed(&value, sizeof(value));
+                break;
+            }
+
+            case TYPE::DECIMAL: {
+                // Unscaled value: digits of the total and of the fraction padded to the scale
+                char digits[IntX::DIGITS];
+                uint length = 0;
+                int fraction = -1;
+                bool minus = false;
+                for (uint64_t i = 0; i < valueSize; ++i) {
+                    const char character = valueBuffer[i];
+                    if (character == '-' && i == 0) {
+                        minus = true;
+                    } else if (character == '.' && fraction == -1) {
+                        fraction = 0;
+                    } else if (character >= '0' && character <= '9') {
+                        if (fraction >= 0 && fraction++ >= column->scale)
+                            continue;
+                        if (length == 0 && character == '0')
+                            continue;
+                        if (length == static_cast<uint>(column->precision))
+                            return;
+                        digits[length++] = character;
+                    } else
+                        return;
+                }
+                for (int i = fraction < 0 ? 0 : fraction; i < column->scale && length > 0; ++i) {
+                    if (length == static_cast<uint>(column->precision))
+                        return;
+                    digits[length++] = '0';
+                }
+
+                std::string err;
+                IntX value;
+                value.setStr(digits, length, err);
+                if (!err.empty())
+                    return;
+
+                uint64_t words[2]{value.getData(0), value.getData(1)};
+                if (minus) {
+                    words[0] = ~words[0] + 1;
+                    words[1] = ~words[1] + (words[0] == 0 ? 1 : 0);
+                }
+                column->appendFixed(words, sizeof(words));
+                break;
+            }
+
+            case TYPE::FLOAT32:
+            case TYPE::FLOAT64:
+                columnDouble(columnName, strtold(valueBuffer, nullptr));
+                break;
+
+            case TYPE::UTF8:
+                column->appendVariable(valueBuffer, valueSize);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void BuilderArrow::columnRowId(const std::string& columnName __attribute__((unused)), RowId rowId) {
+        if (column->type != TYPE::UTF8)
+            return;
+        char str[RowId::SIZE + 1];
+        rowId.toString(str);
+        column->appendVariable(str, RowId::SIZE);
+    }
+
+    void BuilderArrow::columnRaw(const std::string& columnName __attribute__((unused)), const uint8_t* data, uint64_t size) {
+        if (column->isVariable())
+            column->appendVariable(reinterpret_cast<const char*>(data), size);
+    }
+
+    void BuilderArrow::columnTimestamp(const std::string& columnName __attribute__((unused)), time_t timestamp, uint64_t fraction) {
+        if (column->type != TYPE::TIMESTAMP && column->type != TYPE::TIMESTAMP_UTC)
+            return;
+        const int64_t value = (static_cast<int64_t>(timestamp) * 1000000) + static_cast<int64_t>(fraction / 1000);
+        column->appendFixed(&value, sizeof(value));
+    }
+
+    void BuilderArrow::columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction,
+                                         const std::string_view& tz __attribute__((unused))) {
+        columnTimestamp(columnName, timestamp, fraction);
+    }
+
+    void BuilderArrow::columnLobChunks(const std::string& columnName __attribute__((unused)), uint64_t chunks __attribute__((unused)),
+                                       uint64_t size __attribute__((unused))) {
+        // Not used, "lob-chunk-size" is not allowed for this format
+    }
+
+    void BuilderArrow::processLobChunk(bool last __attribute__((unused))) {
+        // Not used, "lob-chunk-size" is not allowed for this format
+    }
+
+    void BuilderArrow::processBeginMessage(Seq sequence __attribute__((unused)), Time timestamp __attribute__((unused))) {
+        newTran = false;
+    }
+
+    void BuilderArrow::processCommit() {
+        // Skip empty transaction
+        if (newTran) {
+            newTran = false;
+            return;
+        }
+
+        flushBatches();
+        num = 0;
+    }
+
+    void BuilderArrow::processInsert(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                     typeDataObj dataObj __attribute__((unused)), typeDba bdba __attribute__((unused)),
+                                     typeSlot slot __attribute__((unused)), FileOffset fileOffset) {
+        if (newTran)
+            processBeginMessage(sequence, timestamp);
+
+        appendRow(sequence, scn, lobCtx, xmlCtx, table, obj, 'c', Format::VALUE_TYPE::AFTER, compressedAfter, fileOffset);
+        ++num;
+    }
+
+    void BuilderArrow::processUpdate(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                     typeDataObj dataObj __attribute__((unused)), typeDba bdba __attribute__((unused)),
+                                     typeSlot slot __attribute__((unused)), FileOffset fileOffset) {
+        if (newTran)
+            processBeginMessage(sequence, timestamp);
+
+        appendRow(sequence, scn, lobCtx, xmlCtx, table, obj, 'u', Format::VALUE_TYPE::AFTER, compressedAfter, fileOffset);
+        ++num;
+    }
+
+    void BuilderArrow::processDelete(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                                     typeDataObj dataObj __attribute__((unused)), typeDba bdba __attribute__((unused)),
+                                     typeSlot slot __attribute__((unused)), FileOffset fileOffset) {
+        if (newTran)
+            processBeginMessage(sequence, timestamp);
+
+        appendRow(sequence, scn, lobCtx, xmlCtx, table, obj, 'd', Format::VALUE_TYPE::BEFORE, compressedBefore, fileOffset);
+        ++num;
+    }
+
+    void BuilderArrow::processDdl(Seq sequence, Scn scn __attribute__((unused)), Time timestamp, const DbTable* table __attribute__((unused)),
+                                  typeObj obj __attribute__((unused))) {
+        if (newTran)
+            processBeginMessage(sequence, timestamp);
+
+        // The rows collected so far have the columns from before the DDL
+        flushBatches();
+    }
+
+    void BuilderArrow::processCheckpoint(Seq sequence, Scn scn, Time timestamp __attribute__((unused)), FileOffset fileOffset __attribute__((unused)),
+                                         bool redo) {
+        if (lwnScn != scn) {
+            lwnScn = scn;
+            lwnIdx = 0;
+        }
+
+        // Checkpoint holds just the end-of-stream marker, it is sent only with the show checkpoint flag
+        auto flags = BuilderMsg::OUTPUT_BUFFER::CHECKPOINT;
+        if (redo)
+            flags = static_cast<BuilderMsg::OUTPUT_BUFFER>(static_cast<uint>(flags) | static_cast<uint>(BuilderMsg::OUTPUT_BUFFER::REDO));
+        builderBegin(sequence, scn, 0, flags);
+        const uint32_t end[2]{CONTINUATION, 0};
+        appendBlock(reinterpret_cast<const char*>(end), sizeof(end));
+        builderCommit();
+    }
+}
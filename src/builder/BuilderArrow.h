@@ -0,0 +1,166 @@
+/* Header for BuilderArrow class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef BUILDER_ARROW_H_
+#define BUILDER_ARROW_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/DbTable.h"
+#include "Builder.h"
+
+namespace OpenLogReplicator {
+    // Rows of a transaction are collected per table in columns and sent as Apache Arrow IPC streams: every message holds the schema, one
+    // record batch and the end-of-stream marker, so it can be read alone. The batch is sent at commit, before DDL or when it grows too big.
+    class BuilderArrow final : public Builder {
+    protected:
+        static constexpr uint64_t BATCH_ROWS_MAX{65536};
+        static constexpr uint64_t BATCH_SIZE_MAX{8388608};
+        static constexpr uint64_t FIELDS_META{3};
+        // Message prefixes, end-of-stream marker and record batch tables; every column adds a node, up to three buffers and their padding
+        static constexpr uint64_t MESSAGE_META{160};
+        static constexpr uint64_t COLUMN_META{88};
+        // Left free below the writer message size, so that big transactions are not divided because of the batch
+        static constexpr uint64_t MESSAGE_MARGIN{65536};
+
+        enum class TYPE : unsigned char {
+            INT64,
+            UINT64,
+            FLOAT32,
+            FLOAT64,
+            DECIMAL,
+            TIMESTAMP,
+            TIMESTAMP_UTC,
+            UTF8,
+            BINARY
+        };
+
+        // Flatbuffers encoding of the IPC metadata, written front to back: offsets are patched when the referenced object is written
+        class Flatbuffer final {
+        public:
+            class Slot final {
+            public:
+                uint8_t size;
+                uint64_t value;
+            };
+
+            std::string data;
+
+            void pad(uint64_t alignment);
+            void put(uint64_t value, uint8_t size);
+            void patch(uint64_t position, uint64_t target);
+            uint64_t table(const Slot* slots, uint count, uint64_t* positions);
+            void string(uint64_t position, std::string_view value);
+            uint64_t vector(uint64_t position, uint32_t count, uint8_t alignment);
+        };
+
+        class Column final {
+        public:
+            std::string name;
+            TYPE type;
+            int precision;
+            int scale;
+            uint64_t length{0};
+            uint64_t nullCount{0};
+            std::string validity;
+            std::string offsets;
+            std::string values;
+
+            Column(std::string newName, TYPE newType, int newPrecision, int newScale);
+
+            void appendNull();
+            void appendValid();
+            void appendFixed(const void* data, uint8_t size);
+            void appendVariable(const char* data, uint64_t size);
+            void clear();
+            [[nodiscard]] bool isVariable() const {
+                return type == TYPE::UTF8 || type == TYPE::BINARY;
+            }
+            [[nodiscard]] uint8_t width() const;
+            [[nodiscard]] uint64_t size() const {
+                return validity.size() + offsets.size() + values.size();
+            }
+        };
+
+        class Batch final {
+        public:
+            const DbTable* table;
+            typeObj obj;
+            Seq sequence{Seq::zero()};
+            Scn scn{Scn::none()};
+            uint64_t rows{0};
+            uint64_t size{0};
+            uint64_t rowSizeMax{0};
+            // Schema and record batch metadata of the message
+            uint64_t metaSize{0};
+            // Table column of every data field
+            std::vector<typeCol> cols;
+            std::vector<Column> columns;
+        };
+
+        std::vector<Batch*> batches;
+        std::unordered_map<const DbTable*, Batch*> batchMap;
+        Column* column{nullptr};
+        Flatbuffer flatbuffer;
+
+        static void fieldType(const DbColumn* dbColumn, SysCol::COLTYPE type, TYPE& arrowType, int& precision, int& scale);
+        Batch* getBatch(Seq sequence, Scn scn, const DbTable* table, typeObj obj);
+        void appendRow(Seq sequence, Scn scn, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj, char op,
+                       Format::VALUE_TYPE valueType, bool compressed, FileOffset fileOffset);
+        void appendMessage(const std::string& header);
+        void appendBlock(const char* data, uint64_t size);
+        void buildSchema(const Batch* batch);
+        void appendSchema(const Batch* batch);
+        void appendRecordBatch(const Batch* batch);
+        void flushBatch(Batch* batch);
+        void flushBatches();
+        [[nodiscard]] uint64_t batchSizeMax(const Batch* batch) const;
+
+        void columnFloat(const std::string& columnName, double value) override;
+        void columnDouble(const std::string& columnName, long double value) override;
+        void columnString(const std::string& columnName) override;
+        void columnNumber(const std::string& columnName, int precision, int scale) override;
+        void columnRaw(const std::string& columnName, const uint8_t* data, uint64_t size) override;
+        void columnRowId(const std::string& columnName, RowId rowId) override;
+        void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
+        void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLobChunks(const std::string& columnName, uint64_t chunks, uint64_t size) override;
+        void processLobChunk(bool last) override;
+        void processInsert(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processUpdate(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processDelete(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
+                           typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
+        void processDdl(Seq sequence, Scn scn, Time timestamp, const DbTable* table, typeObj obj) override;
+        void processBeginMessage(Seq sequence, Time timestamp) override;
+
+    public:
+        BuilderArrow(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer);
+        ~BuilderArrow() override;
+
+        [[nodiscard]] uint64_t builderSize() const override;
+        void processCommit() override;
+        void processCheckpoint(Seq sequence, Scn scn, Time timestamp, FileOffset fileOffset, bool redo) override;
+    };
+}
+
+#endif
@@ -102,12 +102,22 @@ namespace OpenLogReplicator {
         }
     }
 
+    void BuilderJson::columnLobChunks(const std::string& columnName, uint64_t chunks, uint64_t size) {
+        comma(hasPreviousColumn);
+        append('"');
+        appendEscape(columnName);
+        append(std::string_view(R"(":{"chunks":)"));
+        appendDec(chunks);
+        append(std::string_view(R"(,"size":)"));
+        appendDec(size);
+        append('}');
+    }
+
     void BuilderJson::columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) {
         comma(hasPreviousColumn);
         append('"');
         appendEscape(columnName);
         append(std::string_view(R"(":)"));
-        char buffer[22];
 
         switch (format.timestampFormat) {
             case Format::TIMESTAMP_FORMAT::UNIX_NANO:
@@ -185,7 +195,7 @@ namespace OpenLogReplicator {
             case Format::TIMESTAMP_FORMAT::ISO8601_NANO_TZ:
                 // "2024-04-05T19:34:38.123456789Z"
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append('.');
                 appendDecN<9>(fraction);
                 append(std::string_view(R"(Z")"));
@@ -200,7 +210,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append('.');
                 appendDecN<6>(fraction);
                 append(std::string_view(R"(Z")"));
@@ -215,7 +225,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append('.');
                 appendDecN<3>(fraction);
                 append(std::string_view(R"(Z")"));
@@ -226,13 +236,13 @@ namespace OpenLogReplicator {
                 if (fraction >= 500000000)
                     ++timestamp;
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append(std::string_view(R"(Z")"));
                 break;
             case Format::TIMESTAMP_FORMAT::ISO8601_NANO:
                 // "2024-04-05 19:34:38.123456789"
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('.');
                 appendDecN<9>(fraction);
                 append('"');
@@ -247,7 +257,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('.');
                 appendDecN<6>(fraction);
                 append('"');
@@ -262,7 +272,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('.');
                 appendDecN<3>(fraction);
                 append('"');
@@ -273,7 +283,7 @@ namespace OpenLogReplicator {
                 if (fraction >= 500000000)
                     ++timestamp;
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('"');
                 break;
         }
@@ -284,7 +294,6 @@ namespace OpenLogReplicator {
         append('"');
         appendEscape(columnName);
         append(std::string_view(R"(":)"));
-        char buffer[22];
 
         switch (format.timestampTzFormat) {
             case Format::TIMESTAMP_TZ_FORMAT::UNIX_NANO_STRING:
@@ -338,7 +347,7 @@ namespace OpenLogReplicator {
             case Format::TIMESTAMP_TZ_FORMAT::ISO8601_NANO_TZ:
                 // "2024-04-05T19:34:38.123456789Z Europe/Warsaw"
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append('.');
                 appendDecN<9>(fraction);
                 append(std::string_view("Z "));
@@ -355,7 +364,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append('.');
                 appendDecN<6>(fraction);
                 append(std::string_view("Z "));
@@ -372,7 +381,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append('.');
                 appendDecN<3>(fraction);
                 append(std::string_view("Z "));
@@ -385,7 +394,7 @@ namespace OpenLogReplicator {
                 if (fraction >= 500000000)
                     ++timestamp;
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, true, false));
+                appendIso8601(timestamp, true);
                 append(std::string_view("Z "));
                 append(tz);
                 append('"');
@@ -394,7 +403,7 @@ namespace OpenLogReplicator {
             case Format::TIMESTAMP_TZ_FORMAT::ISO8601_NANO:
                 // "2024-04-05 19:34:38.123456789,Europe/Warsaw"
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('.');
                 appendDecN<9>(fraction);
                 append(' ');
@@ -411,7 +420,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('.');
                 appendDecN<6>(fraction);
                 append(' ');
@@ -428,7 +437,7 @@ namespace OpenLogReplicator {
                     ++timestamp;
                 }
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append('.');
                 appendDecN<3>(fraction);
                 append(' ');
@@ -441,7 +450,7 @@ namespace OpenLogReplicator {
                 if (fraction >= 500000000)
                     ++timestamp;
                 append('"');
-                appendArr(buffer, Data::epochToIso8601(timestamp, buffer, false, false));
+                appendIso8601(timestamp, false);
                 append(' ');
                 append(tz);
                 append('"');
@@ -480,6 +489,7 @@ namespace OpenLogReplicator {
             return;
         }
 
+        batchClose();
         if (format.isMessageFormatFull()) {
             append(std::string_view("]}"));
             builderCommit();
@@ -500,14 +510,50 @@ namespace OpenLogReplicator {
         num = 0;
     }
 
+    void BuilderJson::processLobChunk(bool last) {
+        builderBegin(lobStream.sequence, lobStream.scn, lobStream.obj, BuilderMsg::OUTPUT_BUFFER::NONE);
+
+        append('{');
+        hasPreviousValue = false;
+        appendHeader(lobStream.scn, lobStream.timestamp, false, format.isDbFormatAddDml(), true, format.isUserTypeDml());
+
+        comma(hasPreviousValue);
+        if (format.isAttributesFormatDml())
+            appendAttributes();
+
+        append(std::string_view(R"("payload":[{"op":"lob",)"));
+        appendSchema(lobStream.table, lobStream.obj);
+        appendRowid(lobStream.dataObj, lobStream.bdba, lobStream.slot);
+        append(std::string_view(R"(,"column":")"));
+        appendEscape(lobStream.table->columns[lobStream.col]->name);
+        append(std::string_view(R"(","offset":)"));
+        appendDec(lobStream.offset);
+        if (last)
+            append(std::string_view(R"(,"last":true)"));
+        append(std::string_view(R"(,"data":")"));
+        if (lobStream.isClob)
+            appendEscape(valueBuffer, valueSize);
+        else {
+            for (uint64_t j = 0; j < valueSize; ++j)
+                appendHex2(static_cast<uint8_t>(valueBuffer[j]));
+        }
+        append(std::string_view(R"("}]})"));
+        builderCommit();
+    }
+
     void BuilderJson::processInsert(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table,
                                     typeObj obj, typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) {
         if (newTran)
             processBeginMessage(sequence, timestamp);
 
+        bool batched = false;
         if (format.isMessageFormatFull()) {
             comma(hasPreviousRedo);
+        } else if (batchAppend(scn, timestamp, table, obj, 'c', fileOffset)) {
+            batched = true;
         } else {
+            if (lobChunkSize > 0)
+                streamLobs(sequence, scn, timestamp, lobCtx, table, obj, dataObj, bdba, slot, fileOffset);
             builderBegin(sequence, scn, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
             addTagData(lobCtx, xmlCtx, table, Format::VALUE_TYPE::AFTER, fileOffset);
 
@@ -522,20 +568,23 @@ namespace OpenLogReplicator {
             append(std::string_view(R"("payload":[)"));
         }
 
-        append(std::string_view(R"({"op":"c",)"));
-        if (format.isMessageFormatAddOffset()) {
-            append(std::string_view(R"("offset":)"));
-            appendDec(fileOffset.getData());
-            append(',');
+        if (!batched) {
+            append(std::string_view(R"({"op":"c",)"));
+            if (format.isMessageFormatAddOffset()) {
+                append(std::string_view(R"("offset":)"));
+                appendDec(fileOffset.getData());
+                append(',');
+            }
+            appendSchema(table, obj);
         }
-        appendSchema(table, obj);
         appendRowid(dataObj, bdba, slot);
         appendAfter(lobCtx, xmlCtx, table, fileOffset);
         append('}');
 
         if (!format.isMessageFormatFull()) {
-            append(std::string_view("]}"));
-            builderCommit();
+            batchEnd(scn, timestamp, table, obj, 'c');
+            if (lobChunkSize > 0)
+                lobStreamed.clear();
         }
         ++num;
     }
@@ -545,9 +594,14 @@ namespace OpenLogReplicator {
         if (newTran)
             processBeginMessage(sequence, timestamp);
 
+        bool batched = false;
         if (format.isMessageFormatFull()) {
             comma(hasPreviousRedo);
+        } else if (batchAppend(scn, timestamp, table, obj, 'u', fileOffset)) {
+            batched = true;
         } else {
+            if (lobChunkSize > 0)
+                streamLobs(sequence, scn, timestamp, lobCtx, table, obj, dataObj, bdba, slot, fileOffset);
             builderBegin(sequence, scn, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
             addTagData(lobCtx, xmlCtx, table, Format::VALUE_TYPE::AFTER, fileOffset);
 
@@ -562,21 +616,24 @@ namespace OpenLogReplicator {
             append(std::string_view(R"("payload":[)"));
         }
 
-        append(std::string_view(R"({"op":"u",)"));
-        if (format.isMessageFormatAddOffset()) {
-            append(std::string_view(R"("offset":)"));
-            appendDec(fileOffset.getData());
-            append(',');
+        if (!batched) {
+            append(std::string_view(R"({"op":"u",)"));
+            if (format.isMessageFormatAddOffset()) {
+                append(std::string_view(R"("offset":)"));
+                appendDec(fileOffset.getData());
+                append(',');
+            }
+            appendSchema(table, obj);
         }
-        appendSchema(table, obj);
         appendRowid(dataObj, bdba, slot);
         appendBefore(lobCtx, xmlCtx, table, fileOffset);
         appendAfter(lobCtx, xmlCtx, table, fileOffset);
         append('}');
 
         if (!format.isMessageFormatFull()) {
-            append(std::string_view("]}"));
-            builderCommit();
+            batchEnd(scn, timestamp, table, obj, 'u');
+            if (lobChunkSize > 0)
+                lobStreamed.clear();
         }
         ++num;
     }
@@ -586,8 +643,11 @@ namespace OpenLogReplicator {
         if (newTran)
             processBeginMessage(sequence, timestamp);
 
+        bool batched = false;
         if (format.isMessageFormatFull()) {
             comma(hasPreviousRedo);
+        } else if (batchAppend(scn, timestamp, table, obj, 'd', fileOffset)) {
+            batched = true;
         } else {
             builderBegin(sequence, scn, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
             addTagData(lobCtx, xmlCtx, table, Format::VALUE_TYPE::BEFORE, fileOffset);
@@ -603,21 +663,21 @@ namespace OpenLogReplicator {
             append(std::string_view(R"("payload":[)"));
         }
 
-        append(std::string_view(R"({"op":"d",)"));
-        if (format.isMessageFormatAddOffset()) {
-            append(std::string_view(R"("offset":)"));
-            appendDec(fileOffset.getData());
-            append(',');
+        if (!batched) {
+            append(std::string_view(R"({"op":"d",)"));
+            if (format.isMessageFormatAddOffset()) {
+                append(std::string_view(R"("offset":)"));
+                appendDec(fileOffset.getData());
+                append(',');
+            }
+            appendSchema(table, obj);
         }
-        appendSchema(table, obj);
         appendRowid(dataObj, bdba, slot);
         appendBefore(lobCtx, xmlCtx, table, fileOffset);
         append('}');
 
-        if (!format.isMessageFormatFull()) {
-            append(std::string_view("]}"));
-            builderCommit();
-        }
+        if (!format.isMessageFormatFull())
+            batchEnd(scn, timestamp, table, obj, 'd');
         ++num;
     }
 
@@ -628,6 +688,7 @@ namespace OpenLogReplicator {
         if (format.isMessageFormatFull()) {
             comma(hasPreviousRedo);
         } else {
+            batchClose();
             builderBegin(sequence, scn, obj, BuilderMsg::OUTPUT_BUFFER::NONE);
             append('{');
             hasPreviousValue = false;
@@ -34,6 +34,12 @@ namespace OpenLogReplicator {
         bool hasPreviousValue{false};
         bool hasPreviousRedo{false};
         bool hasPreviousColumn{false};
+        // BATCH mode: rows in the open message, all of the same table and operation
+        uint64_t batchRows{0};
+        typeObj batchObj{0};
+        char batchOp{0};
+        Scn batchScn{Scn::none()};
+        Time batchTimestamp{0};
 
         inline void comma(bool &prev) {
             if (prev)
@@ -42,19 +48,71 @@ namespace OpenLogReplicator {
                 prev = true;
         }
 
+        [[nodiscard]] bool isBatchable(const DbTable* table) const {
+            // Tag data is set per message, rows of tables with tag columns are not batched
+            return format.isMessageFormatBatch() && (table == nullptr || table->tagCols.empty());
+        }
+
+        // BATCH mode: the row is added to the open message when it holds rows of the same table and operation
+        bool batchAppend(Scn scn, Time timestamp, const DbTable* table, typeObj obj, char op, FileOffset fileOffset) {
+            if (batchRows == 0)
+                return false;
+
+            // The scn and timestamp of the message header are also the values of every row
+            if (obj != batchObj || op != batchOp || !isBatchable(table) || (format.isScnTypeDml() && scn != batchScn) ||
+                    (format.isTimestampTypeDml() && !(timestamp == batchTimestamp))) {
+                batchClose();
+                return false;
+            }
+
+            append(std::string_view(R"(,{"op":")"));
+            append(op);
+            append('"');
+            if (format.isMessageFormatAddOffset()) {
+                append(std::string_view(R"(,"offset":)"));
+                appendDec(fileOffset.getData());
+            }
+            return true;
+        }
+
+        void batchClose() {
+            if (batchRows == 0)
+                return;
+
+            append(std::string_view("]}"));
+            builderCommit();
+            batchRows = 0;
+        }
+
+        // The message of the row is closed, in BATCH mode it stays open for the next rows until a limit is reached
+        void batchEnd(Scn scn, Time timestamp, const DbTable* table, typeObj obj, char op) {
+            if (!isBatchable(table)) {
+                append(std::string_view("]}"));
+                builderCommit();
+                return;
+            }
+
+            if (batchRows == 0) {
+                batchScn = scn;
+                batchTimestamp = timestamp;
+            }
+            batchObj = obj;
+            batchOp = op;
+            ++batchRows;
+            if (batchRows >= batchRowsMax || messageSize + messagePosition >= batchSizeMax)
+                batchClose();
+        }
+
         void columnNull(const DbTable* table, typeCol col, bool after) {
+            if (table != nullptr && unlikely(!table->outputPlan[col].projected))
+                return;
+
             if (unlikely(table != nullptr && format.unknownType == Format::UNKNOWN_TYPE::HIDE)) {
-                const DbColumn* column = table->columns[col];
-                if (column->guard && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_GUARD_COLUMNS))
-                    return;
-                if (column->nested && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_NESTED_COLUMNS))
-                    return;
-                if (column->hidden && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_HIDDEN_COLUMNS))
-                    return;
-                if (column->unused && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_UNUSED_COLUMNS))
+                const DbTable::OutputColumn& outputColumn = table->outputPlan[col];
+                if (!outputColumn.visible)
                     return;
 
-                const SysCol::COLTYPE typeNo = table->columns[col]->type;
+                const SysCol::COLTYPE typeNo = outputColumn.type;
                 if (typeNo != SysCol::COLTYPE::VARCHAR
                     && typeNo != SysCol::COLTYPE::NUMBER
                     && typeNo != SysCol::COLTYPE::DATE
@@ -919,6 +977,7 @@ namespace OpenLogReplicator {
         void columnRowId(const std::string& columnName, RowId rowId) override;
         void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
         void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLobChunks(const std::string& columnName, uint64_t chunks, uint64_t size) override;
         void processInsert(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processUpdate(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
@@ -927,6 +986,7 @@ namespace OpenLogReplicator {
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processDdl(Seq sequence, Scn scn, Time timestamp, const DbTable* table, typeObj obj) override;
         void processBeginMessage(Seq sequence, Time timestamp) override;
+        void processLobChunk(bool last) override;
         void addTagData(LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, Format::VALUE_TYPE valueType, FileOffset fileOffset);
 
     public:
@@ -97,6 +97,15 @@ namespace OpenLogReplicator {
         // TODO: implement
     }
 
+    void BuilderProtobuf::columnLobChunks(const std::string& columnName __attribute__((unused)), uint64_t chunks __attribute__((unused)),
+                                          uint64_t size __attribute__((unused))) {
+        // Not used, "lob-chunk-size" is not allowed for this format
+    }
+
+    void BuilderProtobuf::processLobChunk(bool last __attribute__((unused))) {
+        // Not used, "lob-chunk-size" is not allowed for this format
+    }
+
     void BuilderProtobuf::processBeginMessage(Seq sequence, Time timestamp) {
         newTran = false;
         builderBegin(sequence, beginScn, 0, BuilderMsg::OUTPUT_BUFFER::NONE);
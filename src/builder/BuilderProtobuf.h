@@ -36,20 +36,17 @@ namespace OpenLogReplicator {
         pb::Schema* schemaPB{nullptr};
 
         void columnNull(const DbTable* table, typeCol col, bool after) {
+            if (table != nullptr && unlikely(!table->outputPlan[col].projected))
+                return;
+
             if (table != nullptr && format.unknownType == Format::UNKNOWN_TYPE::HIDE) {
-                const DbColumn* column = table->columns[col];
-                if (column->storedAsLob)
-                    return;
-                if (column->guard && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_GUARD_COLUMNS))
-                    return;
-                if (column->nested && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_NESTED_COLUMNS))
-                    return;
-                if (column->hidden && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_HIDDEN_COLUMNS))
+                const DbTable::OutputColumn& outputColumn = table->outputPlan[col];
+                if (table->columns[col]->storedAsLob)
                     return;
-                if (column->unused && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_UNUSED_COLUMNS))
+                if (!outputColumn.visible)
                     return;
 
-                const SysCol::COLTYPE typeNo = table->columns[col]->type;
+                const SysCol::COLTYPE typeNo = outputColumn.type;
                 if (typeNo != SysCol::COLTYPE::VARCHAR
                     && typeNo != SysCol::COLTYPE::NUMBER
                     && typeNo != SysCol::COLTYPE::DATE
@@ -431,6 +428,7 @@ namespace OpenLogReplicator {
         void columnRowId(const std::string& columnName, RowId rowId) override;
         void columnTimestamp(const std::string& columnName, time_t timestamp, uint64_t fraction) override;
         void columnTimestampTz(const std::string& columnName, time_t timestamp, uint64_t fraction, const std::string_view& tz) override;
+        void columnLobChunks(const std::string& columnName, uint64_t chunks, uint64_t size) override;
         void processInsert(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processUpdate(Seq sequence, Scn scn, Time timestamp, LobCtx* lobCtx, const XmlCtx* xmlCtx, const DbTable* table, typeObj obj,
@@ -439,6 +437,7 @@ namespace OpenLogReplicator {
                            typeDataObj dataObj, typeDba bdba, typeSlot slot, FileOffset fileOffset) override;
         void processDdl(Seq sequence, Scn scn, Time timestamp, const DbTable* table, typeObj obj) override;
         void processBeginMessage(Seq sequence, Time timestamp) override;
+        void processLobChunk(bool last) override;
 
     public:
         BuilderProtobuf(Ctx* newCtx, Locales* newLocales, Metadata* newMetadata, Format& newFormat, uint64_t newFlushBuffer);
@@ -504,6 +504,7 @@ namespace OpenLogReplicator {
             case DbTable::TABLE::XDB_XNM: {
                 auto* xmlCtx = findMatchingXmlCtx(table);
                 updateAllValues(&xmlCtx->xdbXNmPack, table, xmlCtx->xdbXNmPack.forInsert(ctx, rowId, fileOffset), fileOffset);
+                xmlCtx->invalidateTokens();
                 break;
             }
 
@@ -516,6 +517,7 @@ namespace OpenLogReplicator {
             case DbTable::TABLE::XDB_XQN: {
                 auto* xmlCtx = findMatchingXmlCtx(table);
                 updateAllValues(&xmlCtx->xdbXQnPack, table, xmlCtx->xdbXQnPack.forInsert(ctx, rowId, fileOffset), fileOffset);
+                xmlCtx->invalidateTokens();
                 break;
             }
         }
@@ -618,6 +620,7 @@ namespace OpenLogReplicator {
                 auto* xmlCtx = findMatchingXmlCtx(table);
                 if (auto* xdbXNm = xmlCtx->xdbXNmPack.forUpdate(ctx, rowId, fileOffset))
                     updateAllValues(&xmlCtx->xdbXNmPack, table, xdbXNm, fileOffset);
+                xmlCtx->invalidateTokens();
                 break;
             }
 
@@ -632,6 +635,7 @@ namespace OpenLogReplicator {
                 auto* xmlCtx = findMatchingXmlCtx(table);
                 if (auto* xdbXQn = xmlCtx->xdbXQnPack.forUpdate(ctx, rowId, fileOffset))
                     updateAllValues(&xmlCtx->xdbXQnPack, table, xdbXQn, fileOffset);
+                xmlCtx->invalidateTokens();
                 break;
             }
         }
@@ -712,17 +716,23 @@ namespace OpenLogReplicator {
                 metadata->schema->xdbTtSetPack.drop(ctx, rowId, fileOffset, true);
                 break;
 
-            case DbTable::TABLE::XDB_XNM:
-                findMatchingXmlCtx(table)->xdbXNmPack.drop(ctx, rowId, fileOffset, true);
+            case DbTable::TABLE::XDB_XNM: {
+                auto* xmlCtx = findMatchingXmlCtx(table);
+                xmlCtx->xdbXNmPack.drop(ctx, rowId, fileOffset, true);
+                xmlCtx->invalidateTokens();
                 break;
+            }
 
             case DbTable::TABLE::XDB_XPT:
                 findMatchingXmlCtx(table)->xdbXPtPack.drop(ctx, rowId, fileOffset, true);
                 break;
 
-            case DbTable::TABLE::XDB_XQN:
-                findMatchingXmlCtx(table)->xdbXQnPack.drop(ctx, rowId, fileOffset, true);
+            case DbTable::TABLE::XDB_XQN: {
+                auto* xmlCtx = findMatchingXmlCtx(table);
+                xmlCtx->xdbXQnPack.drop(ctx, rowId, fileOffset, true);
+                xmlCtx->invalidateTokens();
                 break;
+            }
         }
     }
 
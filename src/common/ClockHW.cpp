@@ -17,6 +17,8 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <unistd.h>
+
 #include "ClockHW.h"
 
 namespace OpenLogReplicator {
@@ -29,4 +31,22 @@ namespace OpenLogReplicator {
     time_t ClockHW::getTimeT() const {
         return time(nullptr);
     }
+
+    uint64_t ClockHW::calibrateTicksPerMs() {
+        timespec tsStart{0, 0};
+        timespec tsEnd{0, 0};
+        clock_gettime(CLOCK_MONOTONIC, &tsStart);
+        const uint64_t ticksStart = getTicks();
+        usleep(20000);
+        clock_gettime(CLOCK_MONOTONIC, &tsEnd);
+        const uint64_t ticksEnd = getTicks();
+
+        const uint64_t elapsedNs = (static_cast<uint64_t>(tsEnd.tv_sec - tsStart.tv_sec) * 1000000000) + tsEnd.tv_nsec - tsStart.tv_nsec;
+        if (elapsedNs == 0 || ticksEnd <= ticksStart)
+            return 1;
+        const uint64_t ticksPerMs = ((ticksEnd - ticksStart) * 1000000) / elapsedNs;
+        if (ticksPerMs == 0)
+            return 1;
+        return ticksPerMs;
+    }
 }
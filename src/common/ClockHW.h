@@ -20,6 +20,11 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef CLOCK_HW_H_
 #define CLOCK_HW_H_
 
+#include <ctime>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 #include "Clock.h"
 
 namespace OpenLogReplicator {
@@ -27,6 +32,27 @@ namespace OpenLogReplicator {
     public:
         [[nodiscard]] time_ut getTimeUt() const override;
         [[nodiscard]] time_t getTimeT() const override;
+
+        // Raw, monotonic tick counter for hot paths, no virtual call and no system call where the CPU provides a counter
+        static uint64_t getTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#elif defined(__aarch64__)
+            uint64_t ticks;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+            return ticks;
+#else
+            timespec ts{0, 0};
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return (static_cast<uint64_t>(ts.tv_sec) * 1000000000) + static_cast<uint64_t>(ts.tv_nsec);
+#endif
+        }
+
+        [[nodiscard]] static uint64_t calibrateTicksPerMs();
+
+        static uint64_t ticksToUt(uint64_t ticks, uint64_t ticksPerMs) {
+            return ((ticks / ticksPerMs) * 1000) + (((ticks % ticksPerMs) * 1000) / ticksPerMs);
+        }
     };
 }
 
@@ -57,9 +57,19 @@ namespace OpenLogReplicator {
         tzset();
         logTimezone = -timezone;
         hostTimezone = -timezone;
+
+        // Context times of the threads are counted in clock ticks, the rate is measured once for all contexts
+        if constexpr (Thread::contextCompiled) {
+            static const uint64_t calibratedTicksPerMs = ClockHW::calibrateTicksPerMs();
+            ticksPerMs = calibratedTicksPerMs;
+        }
     }
 
     Ctx::~Ctx() {
+        for (const Ctx* sourceCtx: sourceCtxs)
+            delete sourceCtx;
+        sourceCtxs.clear();
+
         lobIdToXidMap.clear();
 
         while (memoryChunksAllocated > 0) {
@@ -357,48 +367,122 @@ namespace OpenLogReplicator {
         }
     }
 
+    Ctx* Ctx::addSource(const std::string& alias, uint64_t memoryQuotaMb, uint64_t memoryReadBufferMaxMb, uint64_t memoryReadBufferMinMb,
+                        uint64_t memorySwapMb, uint64_t memoryUnswapBufferMinMb, uint64_t memoryWriteBufferMaxMb, uint64_t memoryWriteBufferMinMb) {
+        // The source context keeps own state of the replication, the memory chunks come from the pool of the main context
+        auto* sourceCtx = new Ctx();
+        sourceCtx->mainCtx = this;
+        sourceCtx->trace = trace;
+        sourceCtx->disableChecks = disableChecks;
+        sourceCtx->logLevel = logLevel;
+        sourceCtx->hostTimezone = hostTimezone;
+        sourceCtx->logTimezone = logTimezone;
+        sourceCtx->dumpRedoLog = dumpRedoLog.load();
+        sourceCtx->dumpRawData = dumpRawData.load();
+        sourceCtx->dumpPath = dumpPath;
+        sourceCtx->checkpointIntervalS = checkpointIntervalS;
+        sourceCtx->checkpointIntervalMb = checkpointIntervalMb;
+        sourceCtx->checkpointKeep = checkpointKeep;
+        sourceCtx->schemaForceInterval = schemaForceInterval;
+        sourceCtx->schemaDeltaMax = schemaDeltaMax;
+        sourceCtx->bufferSizeReadAhead = bufferSizeReadAhead;
+        sourceCtx->threadStats = threadStats;
+        sourceCtx->threadStatsIntervalUs = threadStatsIntervalUs;
+        if (metrics != nullptr)
+            sourceCtx->metrics = metrics->addSource(alias);
+
+        sourceCtx->memoryChunksQuota = memoryQuotaMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->memoryChunksSwap = memorySwapMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->memoryChunksReadBufferMax = memoryReadBufferMaxMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->memoryChunksReadBufferMin = memoryReadBufferMinMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->memoryChunksUnswapBufferMin = memoryUnswapBufferMinMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->memoryChunksWriteBufferMax = memoryWriteBufferMaxMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->memoryChunksWriteBufferMin = memoryWriteBufferMinMb / MEMORY_CHUNK_SIZE_MB;
+        sourceCtx->bufferSizeMax = memoryReadBufferMaxMb * 1024 * 1024;
+        sourceCtx->bufferSizeFree = memoryReadBufferMaxMb / MEMORY_CHUNK_SIZE_MB;
+
+        {
+            std::unique_lock const lck(mtx);
+            std::unique_lock const lckMemory(memoryMtx);
+            sourceCtxs.push_back(sourceCtx);
+        }
+        return sourceCtx;
+    }
+
+    uint64_t Ctx::getReservedChunks() const {
+        // Assuming the caller holds memoryMtx of the memory pool
+        uint64_t reservedChunks = 0;
+        if (memoryModulesAllocated[static_cast<uint>(MEMORY::READER)] < memoryChunksReadBufferMin)
+            reservedChunks += memoryChunksReadBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::READER)];
+        if (memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMin)
+            reservedChunks += memoryChunksWriteBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)];
+        return reservedChunks;
+    }
+
     void Ctx::wakeAllOutOfMemory() {
-        std::unique_lock const lck(memoryMtx);
-        condOutOfMemory.notify_all();
+        Ctx* pool = mainCtx != nullptr ? mainCtx : this;
+        std::unique_lock const lck(pool->memoryMtx);
+        pool->condOutOfMemory.notify_all();
     }
 
     bool Ctx::nothingToSwap(Thread* t) const {
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         bool ret;
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_NOTHING_TO_SWAP);
-            std::unique_lock const lck(memoryMtx);
-            ret = memoryChunksSwap == 0 || (memoryChunksAllocated - memoryChunksFree < memoryChunksSwap);
+            std::unique_lock const lck(pool->memoryMtx);
+            // A source of a shared pool swaps also when the whole pool is above the swap threshold
+            ret = memoryChunksSwap == 0 || (memoryChunksUsed < memoryChunksSwap && (pool == this || pool->memoryChunksSwap == 0 ||
+                    pool->memoryChunksAllocated - pool->memoryChunksFree < pool->memoryChunksSwap));
         }
         t->contextSet(Thread::CONTEXT::CPU);
         return ret;
     }
 
     uint64_t Ctx::getMemoryHWM() const {
-        std::unique_lock const lck(memoryMtx);
-        return memoryChunksHWM * MEMORY_CHUNK_SIZE_MB;
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
+        std::unique_lock const lck(pool->memoryMtx);
+        return pool->memoryChunksHWM * MEMORY_CHUNK_SIZE_MB;
     }
 
     uint64_t Ctx::getFreeMemory(Thread* t) const {
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         uint64_t ret;
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_FREE_MEMORY);
-            std::unique_lock const lck(memoryMtx);
-            ret = memoryChunksFree * MEMORY_CHUNK_SIZE_MB;
+            std::unique_lock const lck(pool->memoryMtx);
+            ret = pool->memoryChunksFree * MEMORY_CHUNK_SIZE_MB;
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+        return ret;
+    }
+
+    bool Ctx::isMemoryLow(Thread* t) const {
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
+        bool ret;
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_FREE_MEMORY);
+            std::unique_lock const lck(pool->memoryMtx);
+            // Less than a quarter of the memory is free or not allocated yet, or of the quota of the source
+            ret = (pool->memoryChunksFree + pool->memoryChunksMax - pool->memoryChunksAllocated) * 4 < pool->memoryChunksMax ||
+                    (memoryChunksQuota > 0 && memoryChunksUsed * 4 > memoryChunksQuota * 3);
         }
         t->contextSet(Thread::CONTEXT::CPU);
         return ret;
     }
 
     uint64_t Ctx::getAllocatedMemory() const {
-        std::unique_lock const lck(memoryMtx);
-        return memoryChunksAllocated * MEMORY_CHUNK_SIZE_MB;
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
+        std::unique_lock const lck(pool->memoryMtx);
+        return pool->memoryChunksAllocated * MEMORY_CHUNK_SIZE_MB;
     }
 
     uint64_t Ctx::getSwapMemory(Thread* t) const {
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         uint64_t ret;
         {
             t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_GET_SWAP);
-            std::unique_lock const lck(memoryMtx);
+            std::unique_lock const lck(pool->memoryMtx);
             ret = memoryChunksSwap * MEMORY_CHUNK_SIZE_MB;
         }
         t->contextSet(Thread::CONTEXT::CPU);
@@ -406,6 +490,7 @@ namespace OpenLogReplicator {
     }
 
     uint8_t* Ctx::getMemoryChunk(Thread* t, MEMORY module, bool swap) {
+        Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         uint64_t allocatedModule = 0;
         uint64_t usedTotal = 0;
         uint64_t allocatedTotal = 0;
@@ -413,7 +498,7 @@ namespace OpenLogReplicator {
 
         t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
         {
-            std::unique_lock lck(memoryMtx);
+            std::unique_lock lck(pool->memoryMtx);
             while (true) {
                 if (module == MEMORY::READER) {
                     if (memoryModulesAllocated[static_cast<uint>(MEMORY::READER)] < memoryChunksReadBufferMin)
@@ -423,29 +508,31 @@ namespace OpenLogReplicator {
                         break;
                 }
 
-                uint64_t reservedChunks = 0;
-                if (memoryModulesAllocated[static_cast<uint>(MEMORY::READER)] < memoryChunksReadBufferMin)
-                    reservedChunks += memoryChunksReadBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::READER)];
-                if (memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMin)
-                    reservedChunks += memoryChunksWriteBufferMin - memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)];
+                // Minimal buffers of all sources sharing the pool stay reserved
+                uint64_t reservedChunks = pool->getReservedChunks();
+                for (const Ctx* sourceCtx: pool->sourceCtxs)
+                    reservedChunks += sourceCtx->getReservedChunks();
                 if (!swap)
                     reservedChunks += memoryChunksUnswapBufferMin;
 
-                if (module != MEMORY::BUILDER || memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMax) {
-                    if (memoryChunksFree > reservedChunks)
+                // A source above own quota waits for own chunks to be released, leaving the pool to the other sources
+                const bool overQuota = memoryChunksQuota > 0 && memoryChunksUsed >= memoryChunksQuota;
+                if (!overQuota && (module != MEMORY::BUILDER ||
+                        memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] < memoryChunksWriteBufferMax)) {
+                    if (pool->memoryChunksFree > reservedChunks)
                         break;
 
-                    if (memoryChunksAllocated < memoryChunksMax) {
+                    if (pool->memoryChunksAllocated < pool->memoryChunksMax) {
                         t->contextSet(Thread::CONTEXT::OS, Thread::REASON::OS);
-                        memoryChunks[memoryChunksFree] = static_cast<uint8_t*>(aligned_alloc(MEMORY_ALIGNMENT, MEMORY_CHUNK_SIZE));
+                        pool->memoryChunks[pool->memoryChunksFree] = static_cast<uint8_t*>(aligned_alloc(MEMORY_ALIGNMENT, MEMORY_CHUNK_SIZE));
                         t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
-                        if (unlikely(memoryChunks[memoryChunksFree] == nullptr))
+                        if (unlikely(pool->memoryChunks[pool->memoryChunksFree] == nullptr))
                             throw RuntimeException(10016, "couldn't allocate " + std::to_string(MEMORY_CHUNK_SIZE_MB) +
                                                    " bytes memory for: " + memoryModules[static_cast<uint>(module)]);
-                        ++memoryChunksFree;
-                        allocatedTotal = ++memoryChunksAllocated;
+                        ++pool->memoryChunksFree;
+                        allocatedTotal = ++pool->memoryChunksAllocated;
 
-                        memoryChunksHWM = std::max(memoryChunksAllocated, memoryChunksHWM);
+                        pool->memoryChunksHWM = std::max(pool->memoryChunksAllocated, pool->memoryChunksHWM);
                         break;
                     }
                 }
@@ -459,29 +546,29 @@ namespace OpenLogReplicator {
                 if (unlikely(isTraceSet(TRACE::SLEEP)))
                     logTrace(TRACE::SLEEP, "Ctx:getMemoryChunk");
                 t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::MEMORY_EXHAUSTED);
-                condOutOfMemory.wait(lck);
+                pool->condOutOfMemory.wait(lck);
                 t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
             }
 
             if (module == MEMORY::PARSER)
                 outOfMemoryParser = false;
 
-            --memoryChunksFree;
-            usedTotal = memoryChunksAllocated - memoryChunksFree;
+            --pool->memoryChunksFree;
+            usedTotal = ++memoryChunksUsed;
             allocatedModule = ++memoryModulesAllocated[static_cast<uint>(module)];
             memoryModulesHWM[static_cast<uint>(module)] = std::max(memoryModulesAllocated[static_cast<uint>(module)],
                                                                    memoryModulesHWM[static_cast<uint>(module)]);
-            chunk = memoryChunks[memoryChunksFree];
+            chunk = pool->memoryChunks[pool->memoryChunksFree];
         }
         t->contextSet(Thread::CONTEXT::CPU);
 
         if (unlikely(hardShutdown))
             throw RuntimeException(10018, "shutdown during memory allocation");
 
-        if (metrics != nullptr) {
-            if (allocatedTotal > 0)
-                metrics->emitMemoryAllocatedMb(allocatedTotal * MEMORY_CHUNK_SIZE_MB);
+        if (allocatedTotal > 0 && pool->metrics != nullptr)
+            pool->metrics->emitMemoryAllocatedMb(allocatedTotal * MEMORY_CHUNK_SIZE_MB);
 
+        if (metrics != nullptr) {
             metrics->emitMemoryUsedTotalMb(usedTotal * MEMORY_CHUNK_SIZE_MB);
 
             switch (module) {
@@ -514,28 +601,29 @@ namespace OpenLogReplicator {
     }
 
     void Ctx::freeMemoryChunk(Thread* t, MEMORY module, uint8_t* chunk) {
+        Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         uint64_t allocatedModule = 0;
         uint64_t usedTotal = 0;
         uint64_t allocatedTotal = 0;
         t->contextSet(Thread::CONTEXT::MEM, Thread::REASON::MEM);
         {
-            std::unique_lock const lck(memoryMtx);
+            std::unique_lock const lck(pool->memoryMtx);
 
-            if (unlikely(memoryChunksFree == memoryChunksAllocated))
+            if (unlikely(pool->memoryChunksFree == pool->memoryChunksAllocated || memoryChunksUsed == 0))
                 throw RuntimeException(50001, "trying to free unknown memory block for: " + memoryModules[static_cast<uint>(module)]);
 
             // Keep memoryChunksMin reserved
-            if (memoryChunksFree >= memoryChunksMin)
-                allocatedTotal = --memoryChunksAllocated;
+            if (pool->memoryChunksFree >= pool->memoryChunksMin)
+                allocatedTotal = --pool->memoryChunksAllocated;
             else {
-                memoryChunks[memoryChunksFree++] = chunk;
+                pool->memoryChunks[pool->memoryChunksFree++] = chunk;
                 chunk = nullptr;
             }
 
-            usedTotal = memoryChunksAllocated - memoryChunksFree;
+            usedTotal = --memoryChunksUsed;
             allocatedModule = --memoryModulesAllocated[static_cast<uint>(module)];
 
-            condOutOfMemory.notify_all();
+            pool->condOutOfMemory.notify_all();
         }
 
         if (chunk != nullptr) {
@@ -544,10 +632,10 @@ namespace OpenLogReplicator {
         }
 
         t->contextSet(Thread::CONTEXT::CPU);
-        if (metrics != nullptr) {
-            if (allocatedTotal > 0)
-                metrics->emitMemoryAllocatedMb(allocatedTotal * MEMORY_CHUNK_SIZE_MB);
+        if (allocatedTotal > 0 && pool->metrics != nullptr)
+            pool->metrics->emitMemoryAllocatedMb(allocatedTotal * MEMORY_CHUNK_SIZE_MB);
 
+        if (metrics != nullptr) {
             metrics->emitMemoryUsedTotalMb(usedTotal * MEMORY_CHUNK_SIZE_MB);
 
             switch (module) {
@@ -759,8 +847,9 @@ namespace OpenLogReplicator {
     }
 
     void Ctx::wontSwap(Thread* t) const {
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::CTX_SWAPPED_WONT);
-        std::unique_lock const lck(memoryMtx);
+        std::unique_lock const lck(pool->memoryMtx);
 
         if (!outOfMemoryParser) {
             t->contextSet(Thread::CONTEXT::CPU);
@@ -793,10 +882,7 @@ namespace OpenLogReplicator {
 
             condMainLoop.notify_all();
         }
-        {
-            std::unique_lock const lck(memoryMtx);
-            condOutOfMemory.notify_all();
-        }
+        wakeAllOutOfMemory();
         if (metrics != nullptr) {
             metrics->emitServiceStateInitializing(0);
             metrics->emitServiceStateStarting(0);
@@ -805,29 +891,75 @@ namespace OpenLogReplicator {
             metrics->emitServiceStateFinishing(0);
             metrics->emitServiceStateAborting(1);
         }
+
+        // An error of any source aborts all sources of the process
+        if (mainCtx != nullptr)
+            mainCtx->stopHard();
+        std::vector<Ctx*> sourceCtxsCopy;
+        {
+            std::unique_lock const lck(mtx);
+            sourceCtxsCopy = sourceCtxs;
+        }
+        for (Ctx* sourceCtx: sourceCtxsCopy)
+            sourceCtx->stopHard();
     }
 
     void Ctx::stopSoft() {
         logTrace(TRACE::THREADS, "stop soft");
 
-        std::unique_lock const lck(mtx);
-        if (softShutdown)
-            return;
+        std::vector<Ctx*> sourceCtxsCopy;
+        {
+            std::unique_lock const lck(mtx);
+            if (softShutdown)
+                return;
+
+            softShutdown = true;
+            condMainLoop.notify_all();
+            if (metrics != nullptr) {
+                metrics->emitServiceStateInitializing(0);
+                metrics->emitServiceStateStarting(0);
+                metrics->emitServiceStateReady(0);
+                metrics->emitServiceStateReplicating(0);
+                metrics->emitServiceStateFinishing(1);
+            }
+            sourceCtxsCopy = sourceCtxs;
+        }
+
+        // A finished source stops alone, the main context stops all sources
+        for (Ctx* sourceCtx: sourceCtxsCopy)
+            sourceCtx->stopSoft();
+        if (mainCtx != nullptr)
+            mainCtx->sourceStopped();
+    }
 
-        softShutdown = true;
+    void Ctx::sourceStopped() {
+        std::unique_lock const lck(mtx);
         condMainLoop.notify_all();
-        if (metrics != nullptr) {
-            metrics->emitServiceStateInitializing(0);
-            metrics->emitServiceStateStarting(0);
-            metrics->emitServiceStateReady(0);
-            metrics->emitServiceStateReplicating(0);
-            metrics->emitServiceStateFinishing(1);
+    }
+
+    bool Ctx::isSourcesStopped() const {
+        // Assuming the caller holds mtx
+        if (sourceCtxs.empty())
+            return false;
+
+        for (const Ctx* sourceCtx: sourceCtxs) {
+            if (!sourceCtx->softShutdown)
+                return false;
         }
+        return true;
     }
 
     void Ctx::mainFinish() {
         logTrace(TRACE::THREADS, "main finish start");
 
+        std::vector<Ctx*> sourceCtxsCopy;
+        {
+            std::unique_lock const lck(mtx);
+            sourceCtxsCopy = sourceCtxs;
+        }
+        for (Ctx* sourceCtx: sourceCtxsCopy)
+            sourceCtx->mainFinish();
+
         while (wakeThreads()) {
             usleepInt(10000);
             wakeAllOutOfMemory();
@@ -850,16 +982,46 @@ namespace OpenLogReplicator {
 
         {
             std::unique_lock lck(mtx);
-            if (!hardShutdown) {
+            // With many sources the main loop ends when the last of them has stopped
+            while (!softShutdown && !isSourcesStopped()) {
                 if (unlikely(isTraceSet(TRACE::SLEEP)))
                     logTrace(TRACE::SLEEP, "Ctx:mainLoop");
-                condMainLoop.wait(lck);
+                if (threadStatsIntervalUs > 0 && metrics != nullptr) {
+                    if (condMainLoop.wait_for(lck, std::chrono::microseconds(threadStatsIntervalUs)) == std::cv_status::timeout)
+                        emitThreadStats();
+                } else
+                    condMainLoop.wait(lck);
             }
         }
 
         logTrace(TRACE::THREADS, "main loop end");
     }
 
+    void Ctx::enableThreadStats(uint64_t intervalUs) {
+        threadStats = true;
+        threadStatsIntervalUs = intervalUs;
+        info(0, "thread statistics enabled, clock ticks per ms: " + std::to_string(ticksPerMs));
+    }
+
+    void Ctx::emitThreadStats() const {
+        // Assuming the caller holds mtx
+        for (const Ctx* sourceCtx: sourceCtxs) {
+            std::unique_lock const lck(sourceCtx->mtx);
+            if (sourceCtx->metrics != nullptr)
+                sourceCtx->emitThreadStats();
+        }
+
+        for (const Thread* thread: threads) {
+            if (!thread->contextEnabled || thread->finished)
+                continue;
+
+            for (uint context = static_cast<uint>(Thread::CONTEXT::CPU); context < static_cast<uint>(Thread::CONTEXT::NUM); ++context)
+                metrics->emitThreadContextUs(static_cast<int64_t>(thread->getContextUt(static_cast<Thread::CONTEXT>(context))), thread->alias,
+                                             Thread::contextNames[context]);
+            metrics->emitThreadContextSwitches(static_cast<int64_t>(thread->contextSwitches.load(std::memory_order_relaxed)), thread->alias);
+        }
+    }
+
     void Ctx::printStacktrace() {
         void* array[128];
         int size;
@@ -930,6 +1092,18 @@ namespace OpenLogReplicator {
             return;
         threads.erase(t);
         pthread_join(t->pthread, nullptr);
+
+        // CPU time of finished threads, summed up by thread type
+        std::string name = t->getName();
+        const size_t pos = name.find(':');
+        if (pos != std::string::npos)
+            name.resize(pos);
+        threadCpuUs[name] += t->cpuUs;
+    }
+
+    std::map<std::string, uint64_t> Ctx::getThreadCpuUs() const {
+        std::unique_lock const lck(mtx);
+        return threadCpuUs;
     }
 
     void Ctx::signalDump() const {
@@ -945,6 +1119,9 @@ namespace OpenLogReplicator {
                   " switches: " + std::to_string(thread->contextSwitches));
             pthread_kill(thread->pthread, SIGUSR1);
         }
+
+        for (const Ctx* sourceCtx: sourceCtxs)
+            sourceCtx->signalDump();
     }
 
     void Ctx::usleepInt(uint64_t usec) const {
@@ -1167,9 +1344,10 @@ namespace OpenLogReplicator {
     }
 
     void Ctx::printMemoryUsageCurrent() const {
+        const Ctx* pool = mainCtx != nullptr ? mainCtx : this;
         info(0, "Memory current swap: " + std::to_string(memoryChunksSwap * MEMORY_CHUNK_SIZE_MB) + "MB, allocated: " +
-             std::to_string(memoryChunksAllocated * MEMORY_CHUNK_SIZE_MB) + "MB, free: " +
-             std::to_string(memoryChunksFree * MEMORY_CHUNK_SIZE_MB) + "MB, memory builder: " +
+             std::to_string(pool->memoryChunksAllocated * MEMORY_CHUNK_SIZE_MB) + "MB, free: " +
+             std::to_string(pool->memoryChunksFree * MEMORY_CHUNK_SIZE_MB) + "MB, memory builder: " +
              std::to_string(memoryModulesAllocated[static_cast<uint>(MEMORY::BUILDER)] * MEMORY_CHUNK_SIZE_MB) + "MB, misc: " +
              std::to_string(memoryModulesAllocated[static_cast<uint>(MEMORY::MISC)] * MEMORY_CHUNK_SIZE_MB) + "MB, parser: " +
              std::to_string(memoryModulesAllocated[static_cast<uint>(MEMORY::PARSER)] * MEMORY_CHUNK_SIZE_MB) + "MB, disk read buffer: " +
@@ -24,6 +24,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <condition_variable>
 #include <cstddef>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <rapidjson/document.h>
@@ -102,7 +103,8 @@ namespace OpenLogReplicator {
             RAW_COLUMN_DATA               = 1 << 15,
             EXPERIMENTAL_XMLTYPE          = 1 << 16,
             EXPERIMENTAL_JSON             = 1 << 17,
-            EXPERIMENTAL_NOT_NULL_MISSING = 1 << 18
+            EXPERIMENTAL_NOT_NULL_MISSING = 1 << 18,
+            LWN_SUMMARY                   = 1 << 19
         };
 
         enum class TRACE : unsigned int {
@@ -171,10 +173,13 @@ namespace OpenLogReplicator {
         uint64_t memoryChunksFree{0};
         uint64_t memoryChunksHWM{0};
         uint64_t memoryModulesAllocated[MEMORY_COUNT]{0, 0, 0, 0, 0, 0};
+        uint64_t memoryChunksQuota{0};
+        uint64_t memoryChunksUsed{0};
 
         mutable std::mutex mtx;
         std::condition_variable condMainLoop;
         std::set<Thread*> threads;
+        std::map<std::string, uint64_t> threadCpuUs;
         pthread_t mainThread;
         bool outOfMemoryParser{false};
         bool bigEndian{false};
@@ -199,22 +204,29 @@ namespace OpenLogReplicator {
 
         // Disk read buffers
         uint64_t bufferSizeMax{0};
-        uint64_t bufferSizeFree{0};
+        std::atomic<uint64_t> bufferSizeFree{0};
+        uint64_t bufferSizeReadAhead{0};
         uint64_t bufferSizeHWM{0};
-        uint64_t suppLogSize{0};
+        std::atomic<uint64_t> suppLogSize{0};
         // Checkpoint
         uint64_t checkpointIntervalS{600};
         uint64_t checkpointIntervalMb{500};
         uint64_t checkpointKeep{100};
         uint64_t schemaForceInterval{20};
+        uint64_t schemaDeltaMax{0};
         // Reader
         uint64_t redoReadSleepUs{50000};
+        uint64_t redoReadSleepMinUs{0};
         uint64_t redoVerifyDelayUs{0};
         uint64_t archReadSleepUs{10000000};
         uint64_t refreshIntervalUs{10000000};
         // Writer
         uint64_t pollIntervalUs{100000};
         uint64_t queueSize{65536};
+        // Thread statistics
+        bool threadStats{false};
+        uint64_t threadStatsIntervalUs{0};
+        uint64_t ticksPerMs{1};
 
         std::atomic<uint32_t> version{0}; // Compatibility level of redo logs
         std::atomic<uint> dumpRedoLog{0};
@@ -243,6 +255,9 @@ namespace OpenLogReplicator {
         Xid swappedShrinkXid{0, 0, 0};
         mutable std::mutex swapMtx;
         std::condition_variable reusedTransactions;
+        // Sources sharing the memory pool of the main context
+        Ctx* mainCtx{nullptr};
+        std::vector<Ctx*> sourceCtxs;
         bool version12{false};
         bool hardShutdown{false};
         bool softShutdown{false};
@@ -599,12 +614,17 @@ namespace OpenLogReplicator {
 
         void initialize(uint64_t memoryMinMb, uint64_t memoryMaxMb, uint64_t memoryReadBufferMaxMb, uint64_t memoryReadBufferMinMb, uint64_t memorySwapMb,
                         uint64_t memoryUnswapBufferMinMb, uint64_t memoryWriteBufferMaxMb, uint64_t memoryWriteBufferMinMb);
+        [[nodiscard]] Ctx* addSource(const std::string& alias, uint64_t memoryQuotaMb, uint64_t memoryReadBufferMaxMb, uint64_t memoryReadBufferMinMb,
+                                     uint64_t memorySwapMb, uint64_t memoryUnswapBufferMinMb, uint64_t memoryWriteBufferMaxMb,
+                                     uint64_t memoryWriteBufferMinMb);
+        [[nodiscard]] uint64_t getReservedChunks() const;
         void wakeAllOutOfMemory();
         [[nodiscard]] bool nothingToSwap(Thread* t) const;
         [[nodiscard]] uint64_t getMemoryHWM() const;
         [[nodiscard]] uint64_t getAllocatedMemory() const;
         [[nodiscard]] uint64_t getSwapMemory(Thread* t) const;
         [[nodiscard]] uint64_t getFreeMemory(Thread* t) const;
+        [[nodiscard]] bool isMemoryLow(Thread* t) const;
         [[nodiscard]] uint8_t* getMemoryChunk(Thread* t, MEMORY module, bool swap = false);
         void freeMemoryChunk(Thread* t, MEMORY module, uint8_t* chunk);
         void swappedMemoryInit(Thread* t, Xid xid);
@@ -619,7 +639,11 @@ namespace OpenLogReplicator {
 
         void stopHard();
         void stopSoft();
+        void sourceStopped();
+        [[nodiscard]] bool isSourcesStopped() const;
         void mainLoop();
+        void enableThreadStats(uint64_t intervalUs);
+        void emitThreadStats() const;
         void mainFinish();
         void printStacktrace();
         void signalHandler(int s);
@@ -627,6 +651,7 @@ namespace OpenLogReplicator {
         bool wakeThreads();
         void spawnThread(Thread* t);
         void finishThread(Thread* t);
+        [[nodiscard]] std::map<std::string, uint64_t> getThreadCpuUs() const;
         void signalDump() const;
         void usleepInt(uint64_t usec) const;
 
@@ -0,0 +1,244 @@
+/* Column value filter of a table
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <cstring>
+#include <utility>
+
+#include "../locales/CharacterSet.h"
+#include "Ctx.h"
+#include "DbColumn.h"
+#include "DbFilter.h"
+#include "exception/ConfigurationException.h"
+#include "exception/DataException.h"
+
+namespace OpenLogReplicator {
+    DbFilter::DbFilter(std::string newColumn, bool newNegate):
+            column(std::move(newColumn)),
+            negate(newNegate) {}
+
+    void DbFilter::encode(const Ctx* ctx, const std::string& table, const DbColumn* dbColumn, const CharacterSet* characterSet) {
+        encoded.clear();
+        pad.clear();
+        // AL16UTF16 stores every character in 2 bytes
+        const bool utf16 = (dbColumn->charsetId == 2000);
+
+        switch (dbColumn->type) {
+            case SysCol::COLTYPE::NUMBER:
+                for (const std::string& value: values) {
+                    std::string out;
+                    if (unlikely(!encodeNumber(value, out)))
+                        throw DataException(10078, "table " + table + " - column: " + column + ", invalid filter value: " + value +
+                                                   ", expected: decimal number");
+                    encoded.push_back(std::move(out));
+                }
+                break;
+
+            case SysCol::COLTYPE::CHAR:
+            case SysCol::COLTYPE::VARCHAR:
+                if (unlikely(dbColumn->storedAsLob))
+                    throw DataException(10079, "table " + table + " - column: " + column + ", type: " +
+                                               std::to_string(static_cast<uint>(dbColumn->type)) + " is not supported by column filter");
+
+                if (dbColumn->type == SysCol::COLTYPE::CHAR) {
+                    if (utf16)
+                        pad.push_back('\0');
+                    pad.push_back(' ');
+                }
+
+                for (std::string value: values) {
+                    if (dbColumn->type == SysCol::COLTYPE::CHAR)
+                        while (!value.empty() && value.back() == ' ')
+                            value.pop_back();
+
+                    // Empty string is stored as NULL
+                    if (value.empty()) {
+                        matchNull = true;
+                        continue;
+                    }
+
+                    std::string out;
+                    for (const char c: value) {
+                        const auto byte = static_cast<uint8_t>(c);
+                        bool valid = (byte < 0x80);
+                        if (valid && !utf16 && characterSet != nullptr) {
+                            const uint8_t* str = &byte;
+                            uint64_t length = 1;
+                            valid = (characterSet->decode(ctx, Xid(), str, length) == byte);
+                        }
+                        if (unlikely(!valid))
+                            throw DataException(10078, "table " + table + " - column: " + column + ", invalid filter value: " + value +
+                                                       ", expected: ASCII characters stored unchanged in the column character set");
+
+                        if (utf16)
+                            out.push_back('\0');
+                        out.push_back(c);
+                    }
+                    encoded.push_back(std::move(out));
+                }
+                break;
+
+            case SysCol::COLTYPE::RAW:
+                for (const std::string& value: values) {
+                    if (value.empty()) {
+                        matchNull = true;
+                        continue;
+                    }
+
+                    std::string out;
+                    bool valid = ((value.length() & 1) == 0);
+                    for (uint64_t i = 0; valid && i < value.length(); i += 2) {
+                        uint8_t byte = 0;
+                        for (uint64_t j = i; j < i + 2; ++j) {
+                            const char c = value[j];
+                            byte <<= 4;
+                            if (c >= '0' && c <= '9')
+                                byte |= c - '0';
+                            else if (c >= 'A' && c <= 'F')
+                                byte |= c - 'A' + 10;
+                            else if (c >= 'a' && c <= 'f')
+                                byte |= c - 'a' + 10;
+                            else
+                                valid = false;
+                        }
+                        out.push_back(static_cast<char>(byte));
+                    }
+                    if (unlikely(!valid))
+                        throw DataException(10078, "table " + table + " - column: " + column + ", invalid filter value: " + value +
+                                                   ", expected: hexadecimal string");
+                    encoded.push_back(std::move(out));
+                }
+                break;
+
+            default:
+                throw DataException(10079, "table " + table + " - column: " + column + ", type: " +
+                                           std::to_string(static_cast<uint>(dbColumn->type)) + " is not supported by column filter");
+        }
+    }
+
+    bool DbFilter::matches(const uint8_t* data, uint64_t size) const {
+        bool found = false;
+        if (size == 0) {
+            found = matchNull;
+        } else {
+            if (!pad.empty())
+                while (size >= pad.length() && memcmp(data + size - pad.length(), pad.data(), pad.length()) == 0)
+                    size -= pad.length();
+
+            for (const std::string& value: encoded) {
+                if (value.length() == size && memcmp(value.data(), data, size) == 0) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        return found != negate;
+    }
+
+    void DbFilter::parseJson(const std::string& fileName, const rapidjson::Value& filterArrayJson, std::vector<DbFilter>& filters) {
+        for (rapidjson::SizeType i = 0; i < filterArrayJson.Size(); ++i) {
+            const rapidjson::Value& filterJson = Ctx::getJsonFieldO(fileName, filterArrayJson, "column-filter", i);
+
+            static const std::vector<std::string> filterNames{
+                "column",
+                "in",
+                "not-in"
+            };
+            Ctx::checkJsonFields(fileName, filterJson, filterNames);
+
+            std::string column = Ctx::getJsonFieldS(fileName, SysCol::NAME_LENGTH, filterJson, "column");
+            if (unlikely(filterJson.HasMember("in") == filterJson.HasMember("not-in")))
+                throw ConfigurationException(30001, "bad JSON, invalid \"column-filter\" value for column: " + column +
+                                                    ", expected: one of \"in\" or \"not-in\"");
+
+            const char* field = filterJson.HasMember("in") ? "in" : "not-in";
+            DbFilter& filter = filters.emplace_back(std::move(column), filterJson.HasMember("not-in"));
+
+            const rapidjson::Value& valueArrayJson = Ctx::getJsonFieldA(fileName, filterJson, field);
+            for (rapidjson::SizeType j = 0; j < valueArrayJson.Size(); ++j) {
+                if (valueArrayJson[j].IsNull())
+                    filter.matchNull = true;
+                else
+                    filter.values.push_back(Ctx::getJsonFieldS(fileName, Ctx::JSON_KEY_LENGTH, valueArrayJson, field, j));
+            }
+        }
+    }
+
+    // Oracle NUMBER: exponent byte followed by base-100 digits, negative values have the digits complemented and a terminating byte
+    bool DbFilter::encodeNumber(const std::string& value, std::string& out) {
+        uint64_t i = 0;
+        bool negative = false;
+        if (i < value.length() && (value[i] == '-' || value[i] == '+')) {
+            negative = (value[i] == '-');
+            ++i;
+        }
+
+        std::string digits;
+        int64_t point = -1;
+        for (; i < value.length(); ++i) {
+            const char c = value[i];
+            if (c == '.' && point == -1)
+                point = static_cast<int64_t>(digits.length());
+            else if (c >= '0' && c <= '9')
+                digits.push_back(c);
+            else
+                return false;
+        }
+        if (digits.empty())
+            return false;
+        if (point == -1)
+            point = static_cast<int64_t>(digits.length());
+
+        // Align the decimal point to the base-100 digits
+        if ((point & 1) != 0) {
+            digits.insert(0, 1, '0');
+            ++point;
+        }
+        if ((digits.length() & 1) != 0)
+            digits.push_back('0');
+
+        int64_t exponent = point / 2;
+        uint64_t first = 0;
+        uint64_t last = digits.length();
+        while (first < last && digits[first] == '0' && digits[first + 1] == '0') {
+            first += 2;
+            --exponent;
+        }
+        while (last > first && digits[last - 2] == '0' && digits[last - 1] == '0')
+            last -= 2;
+
+        out.clear();
+        if (first == last) {
+            out.push_back(static_cast<char>(0x80));
+            return true;
+        }
+
+        const uint64_t length = (last - first) / 2;
+        if (length > 20 || exponent > 63 || exponent < -62)
+            return false;
+
+        out.push_back(static_cast<char>(negative ? 0x3F - exponent : 0xC0 + exponent));
+        for (uint64_t j = first; j < last; j += 2) {
+            const int pair = ((digits[j] - '0') * 10) + (digits[j + 1] - '0');
+            out.push_back(static_cast<char>(negative ? 101 - pair : pair + 1));
+        }
+        if (negative && length < 20)
+            out.push_back(static_cast<char>(0x66));
+        return true;
+    }
+}
@@ -0,0 +1,57 @@
+/* Header for DbFilter class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef DB_FILTER_H_
+#define DB_FILTER_H_
+
+#include <rapidjson/document.h>
+#include <string>
+#include <vector>
+
+#include "types/Types.h"
+
+namespace OpenLogReplicator {
+    class CharacterSet;
+    class Ctx;
+    class DbColumn;
+
+    // Column value filter of a table (filter: table: column-filter). The listed values are encoded once to the form stored in redo log,
+    // so rows are matched by comparing raw column data, before any value is formatted.
+    class DbFilter final {
+    public:
+        std::string column;
+        bool negate;
+        bool matchNull{false};
+        std::vector<std::string> values;
+        typeCol col{-1};
+        std::vector<std::string> encoded;
+        // CHAR values are blank padded to the column length
+        std::string pad;
+
+        DbFilter(std::string newColumn, bool newNegate);
+
+        void encode(const Ctx* ctx, const std::string& table, const DbColumn* dbColumn, const CharacterSet* characterSet);
+        [[nodiscard]] bool matches(const uint8_t* data, uint64_t size) const;
+
+        static void parseJson(const std::string& fileName, const rapidjson::Value& filterArrayJson, std::vector<DbFilter>& filters);
+        [[nodiscard]] static bool encodeNumber(const std::string& value, std::string& out);
+    };
+}
+
+#endif
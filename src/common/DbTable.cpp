@@ -26,6 +26,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "DbTable.h"
 #include "exception/RuntimeException.h"
 #include "expression/BoolValue.h"
+#include "expression/ConditionProgram.h"
 #include "expression/Token.h"
 
 namespace OpenLogReplicator {
@@ -111,6 +112,9 @@ namespace OpenLogReplicator {
 
         delete conditionValue;
         conditionValue = nullptr;
+
+        delete conditionProgram;
+        conditionProgram = nullptr;
     }
 
     void DbTable::addColumn(DbColumn* column) {
@@ -141,10 +145,48 @@ namespace OpenLogReplicator {
         tablePartitions.push_back(objx);
     }
 
+    void DbTable::buildOutputPlan(const Ctx* ctx, const std::vector<std::string>& columnList) {
+        outputPlan.clear();
+        outputPlan.reserve(columns.size());
+        for (typeCol col = 0; col < static_cast<typeCol>(columns.size()); ++col) {
+            const DbColumn* column = columns[col];
+            OutputColumn outputColumn{column->type, true, true};
+
+            // Primary key and tag columns are always present
+            if (!columnList.empty() && column->numPk == 0 &&
+                    std::find(columnList.begin(), columnList.end(), column->name) == columnList.end() &&
+                    std::find(tagCols.begin(), tagCols.end(), col + 1) == tagCols.end()) {
+                outputColumn.visible = false;
+                outputColumn.projected = false;
+            }
+
+            if (ctx->isFlagSet(Ctx::REDO_FLAGS::RAW_COLUMN_DATA)) {
+                outputColumn.type = SysCol::COLTYPE::RAW;
+                outputPlan.push_back(outputColumn);
+                continue;
+            }
+
+            if (column->storedAsLob) {
+                if (column->type == SysCol::COLTYPE::VARCHAR)
+                    outputColumn.type = SysCol::COLTYPE::CLOB;
+                else if (column->type == SysCol::COLTYPE::RAW)
+                    outputColumn.type = SysCol::COLTYPE::BLOB;
+            }
+
+            if ((column->guard && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_GUARD_COLUMNS)) ||
+                    (column->nested && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_NESTED_COLUMNS)) ||
+                    (column->hidden && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_HIDDEN_COLUMNS)) ||
+                    (column->unused && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_UNUSED_COLUMNS)))
+                outputColumn.visible = false;
+
+            outputPlan.push_back(outputColumn);
+        }
+    }
+
     bool DbTable::matchesCondition(const Ctx* ctx, char op, const AttributeMap* attributes) const {
         bool result = true;
-        if (conditionValue != nullptr)
-            result = conditionValue->evaluateToBool(op, attributes);
+        if (conditionProgram != nullptr)
+            result = conditionProgram->evaluate(op, attributes);
 
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::CONDITION)))
             ctx->logTrace(Ctx::TRACE::CONDITION, "matchesCondition: table: " + owner + "." + name + ", condition: " + condition + ", result: " +
@@ -159,6 +201,10 @@ namespace OpenLogReplicator {
 
         Expression::buildTokens(newCondition, tokens);
         conditionValue = Expression::buildCondition(newCondition, tokens, stack);
+
+        conditionProgram = new ConditionProgram();
+        conditionValue->compile(*conditionProgram);
+        conditionProgram->finish(newCondition);
     }
 
     std::ostream& operator<<(std::ostream& os, const DbTable& table) {
@@ -23,11 +23,14 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <unordered_map>
 #include <vector>
 
+#include "DbFilter.h"
 #include "expression/Token.h"
+#include "table/SysCol.h"
 #include "types/Types.h"
 
 namespace OpenLogReplicator {
     class BoolValue;
+    class ConditionProgram;
     class Ctx;
     class DbColumn;
     class DbLob;
@@ -66,6 +69,17 @@ namespace OpenLogReplicator {
             XDB_XQN
         };
 
+        // Output of a column resolved once for the table, so the values of every row are formatted without checking the column flags
+        class OutputColumn final {
+        public:
+            // VARCHAR and RAW stored as LOB are output as CLOB and BLOB, RAW for all columns with raw column data
+            SysCol::COLTYPE type;
+            // Not hidden by the column flags and included in the configured output columns
+            bool visible;
+            // Included in the configured output columns
+            bool projected;
+        };
+
         static constexpr uint VCONTEXT_LENGTH{30};
         static constexpr uint VPARAMETER_LENGTH{4000};
         static constexpr uint VPROPERTY_LENGTH{4000};
@@ -84,7 +98,10 @@ namespace OpenLogReplicator {
         std::string tokSuf;
         std::string condition;
         BoolValue* conditionValue{nullptr};
+        ConditionProgram* conditionProgram{nullptr};
         std::vector<DbColumn*> columns;
+        std::vector<DbFilter> filters;
+        std::vector<OutputColumn> outputPlan;
         std::vector<DbLob*> lobs;
         std::vector<typeObj2> tablePartitions;
         std::vector<typeCol> pk;
@@ -101,6 +118,7 @@ namespace OpenLogReplicator {
         void addColumn(DbColumn* column);
         void addLob(DbLob* lob);
         void addTablePartition(typeObj newObj, typeDataObj newDataObj);
+        void buildOutputPlan(const Ctx* ctx, const std::vector<std::string>& columnList);
         bool matchesCondition(const Ctx* ctx, char op, const AttributeMap* attributes) const;
         void setCondition(const std::string& newCondition);
 
@@ -80,7 +80,8 @@ namespace OpenLogReplicator {
             // JSON only:
             SKIP_BEGIN  = 1 << 2,
             SKIP_COMMIT = 1 << 3,
-            ADD_OFFSET  = 1 << 4
+            ADD_OFFSET  = 1 << 4,
+            BATCH       = 1 << 5
         };
 
         enum class RID_FORMAT : unsigned char {
@@ -315,6 +316,10 @@ namespace OpenLogReplicator {
             return (static_cast<unsigned char>(messageFormat) & static_cast<unsigned char>(MESSAGE_FORMAT::ADD_OFFSET)) != 0;
         }
 
+        [[nodiscard]] bool isMessageFormatBatch() const {
+            return (static_cast<unsigned char>(messageFormat) & static_cast<unsigned char>(MESSAGE_FORMAT::BATCH)) != 0;
+        }
+
         [[nodiscard]] bool isTimestampTypeCommitValue() const {
             return (static_cast<unsigned char>(timestampType) & static_cast<unsigned char>(TIMESTAMP_TYPE::COMMIT_VALUE)) != 0;
         }
@@ -20,10 +20,23 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "Ctx.h"
 #include "Thread.h"
 
+#include <ctime>
 #include <utility>
 #include "exception/RuntimeException.h"
 
 namespace OpenLogReplicator {
+    const char* Thread::contextNames[static_cast<uint>(CONTEXT::NUM)] {
+        "none",
+        "cpu",
+        "os",
+        "mtx",
+        "wait",
+        "sleep",
+        "mem",
+        "tran",
+        "chkpt"
+    };
+
     Thread::Thread(Ctx* newCtx, std::string newAlias):
             ctx(newCtx),
             alias(std::move(newAlias)) {}
@@ -39,6 +52,10 @@ namespace OpenLogReplicator {
     void* Thread::runStatic(void* voidThread) {
         auto* thread = static_cast<Thread*>(voidThread);
         thread->contextRun();
+
+        timespec cpuTime{};
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) == 0)
+            thread->cpuUs = (static_cast<uint64_t>(cpuTime.tv_sec) * 1000000) + (static_cast<uint64_t>(cpuTime.tv_nsec) / 1000);
         thread->finished = true;
         return nullptr;
     }
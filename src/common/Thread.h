@@ -23,7 +23,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <atomic>
 #include <sys/time.h>
 
-#include "Clock.h"
+#include "ClockHW.h"
 #include "Ctx.h"
 #include "types/Types.h"
 
@@ -116,6 +116,10 @@ namespace OpenLogReplicator {
             WRITER_CONFIRM,
             WRITER_DONE,
             // 50
+            CATCH_UP_DONE,
+            REDO_THREAD_EVENT,
+            READER_READ_TIME,
+            COMPRESSOR_FRAME,
             // SLEEP
             CHECKPOINT_NO_WORK,
             MEMORY_EXHAUSTED,
@@ -131,7 +135,12 @@ namespace OpenLogReplicator {
             // 60
             WRITER_NO_WORK,
             MEMORY_BLOCKED,
+            CATCH_UP_WAIT,
             // 65
+            METADATA_WAIT_WRITERS,
+            REDO_THREAD_WAIT,
+            COMPRESSOR_NO_WORK,
+            COMPRESSOR_WAIT,
             // OTHER
             OS,
             MEM,
@@ -146,6 +155,7 @@ namespace OpenLogReplicator {
         pthread_t pthread{0};
         std::string alias;
         std::atomic<bool> finished{false};
+        uint64_t cpuUs{0};
 
         explicit Thread(Ctx* newCtx, std::string newAlias);
         virtual ~Thread() = default;
@@ -158,13 +168,18 @@ namespace OpenLogReplicator {
 #else
         static constexpr bool contextCompiled = false;
 #endif
-        time_ut contextTimeLast{0};
-        time_ut contextTime[static_cast<uint>(CONTEXT::NUM)]{};
-        time_ut contextCnt[static_cast<uint>(CONTEXT::NUM)]{};
-        uint64_t reasonCnt[static_cast<uint>(REASON::NUM)]{};
+        static constexpr uint CACHE_LINE_SIZE{64};
+        static const char* contextNames[static_cast<uint>(CONTEXT::NUM)];
+
+        // Written only by the owning thread, read by the metrics export, kept on own cache lines to avoid false sharing
+        bool contextEnabled{false};
+        uint64_t contextTicksLast{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> contextTicks[static_cast<uint>(CONTEXT::NUM)]{};
+        std::atomic<uint64_t> contextCnt[static_cast<uint>(CONTEXT::NUM)]{};
+        std::atomic<uint64_t> contextSwitches{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> reasonCnt[static_cast<uint>(REASON::NUM)]{};
         REASON curReason{REASON::NONE};
         CONTEXT curContext{CONTEXT::NONE};
-        uint64_t contextSwitches{0};
 
         virtual std::string getName() const = 0;
 
@@ -174,59 +189,56 @@ namespace OpenLogReplicator {
             contextStop();
         }
 
+        static void contextAdd(std::atomic<uint64_t>& stat, uint64_t value) {
+            stat.store(stat.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
         void contextStart() {
-            if constexpr (contextCompiled) {
-                contextTimeLast = ctx->clock->getTimeUt();
-            }
+            contextEnabled = contextCompiled || ctx->threadStats;
+            if (contextEnabled)
+                contextTicksLast = ClockHW::getTicks();
         }
 
         void contextSet(CONTEXT context, REASON reason = REASON::NONE) {
-            if constexpr (contextCompiled) {
-                ++contextSwitches;
-                const time_ut contextTimeNow = ctx->clock->getTimeUt();
-                contextTime[static_cast<uint>(curContext)] += contextTimeNow - contextTimeLast;
-                ++contextCnt[static_cast<uint>(curContext)];
-                ++reasonCnt[static_cast<uint>(reason)];
-                curReason = reason;
-                curContext = context;
-                contextTimeLast = contextTimeNow;
-            }
+            if (likely(!contextEnabled))
+                return;
+
+            contextAdd(contextSwitches, 1);
+            const uint64_t contextTicksNow = ClockHW::getTicks();
+            contextAdd(contextTicks[static_cast<uint>(curContext)], contextTicksNow - contextTicksLast);
+            contextAdd(contextCnt[static_cast<uint>(curContext)], 1);
+            contextAdd(reasonCnt[static_cast<uint>(reason)], 1);
+            curReason = reason;
+            curContext = context;
+            contextTicksLast = contextTicksNow;
+        }
+
+        [[nodiscard]] uint64_t getContextUt(CONTEXT context) const {
+            return ClockHW::ticksToUt(contextTicks[static_cast<uint>(context)].load(std::memory_order_relaxed), ctx->ticksPerMs);
         }
 
         void contextStop() {
-            if constexpr (contextCompiled) {
-                ++contextSwitches;
-                const time_ut contextTimeNow = ctx->clock->getTimeUt();
-                contextTime[static_cast<uint>(curContext)] += contextTimeNow - contextTimeLast;
-                ++contextCnt[static_cast<uint>(curContext)];
-
-                std::string msg =
-                        "thread: " + alias +
-                        " cpu: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::CPU)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::CPU)]) +
-                        " os: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::OS)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::OS)]) +
-                        " mtx: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::MUTEX)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::MUTEX)]) +
-                        " wait: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::WAIT)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::WAIT)]) +
-                        " sleep: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::SLEEP)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::SLEEP)]) +
-                        " mem: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::MEM)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::MEM)]) +
-                        " tran: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::TRAN)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::TRAN)]) +
-                        " chkpt: " + std::to_string(contextTime[static_cast<uint>(CONTEXT::CHKPT)]) +
-                        "/" + std::to_string(contextCnt[static_cast<uint>(CONTEXT::CHKPT)]) +
-                        " switches: " + std::to_string(contextSwitches) + " reasons:";
-                for (uint reason = static_cast<uint>(REASON::NONE); reason < static_cast<int>(REASON::NUM); ++reason) {
-                    if (reasonCnt[reason] == 0)
-                        continue;
-
-                    msg += " " + std::to_string(reason) + "/" + std::to_string(reasonCnt[reason]);
-                }
-                ctx->info(0, msg);
+            if (!contextEnabled)
+                return;
+
+            contextAdd(contextSwitches, 1);
+            const uint64_t contextTicksNow = ClockHW::getTicks();
+            contextAdd(contextTicks[static_cast<uint>(curContext)], contextTicksNow - contextTicksLast);
+            contextAdd(contextCnt[static_cast<uint>(curContext)], 1);
+            contextTicksLast = contextTicksNow;
+
+            std::string msg = "thread: " + alias;
+            for (uint context = static_cast<uint>(CONTEXT::CPU); context < static_cast<uint>(CONTEXT::NUM); ++context)
+                msg += " " + std::string(contextNames[context]) + ": " + std::to_string(getContextUt(static_cast<CONTEXT>(context))) +
+                        "/" + std::to_string(contextCnt[context].load(std::memory_order_relaxed));
+            msg += " switches: " + std::to_string(contextSwitches.load(std::memory_order_relaxed)) + " reasons:";
+            for (uint reason = static_cast<uint>(REASON::NONE); reason < static_cast<uint>(REASON::NUM); ++reason) {
+                if (reasonCnt[reason] == 0)
+                    continue;
+
+                msg += " " + std::to_string(reason) + "/" + std::to_string(reasonCnt[reason].load(std::memory_order_relaxed));
             }
+            ctx->info(0, msg);
         }
     };
 }
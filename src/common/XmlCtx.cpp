@@ -19,8 +19,11 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 #include "XmlCtx.h"
 
+#include <cstdlib>
 #include <utility>
 
+#include "types/Data.h"
+
 namespace OpenLogReplicator {
     XmlCtx::XmlCtx(Ctx* newCtx, std::string newTokSuf, uint64_t newFlags):
             ctx(newCtx),
@@ -35,5 +38,52 @@ namespace OpenLogReplicator {
         xdbXNmPack.clear(ctx);
         xdbXQnPack.clear(ctx);
         xdbXPtPack.clear(ctx);
+        invalidateTokens();
+    }
+
+    void XmlCtx::invalidateTokens() noexcept {
+        tokens.clear();
+        nmSpcUris.clear();
+    }
+
+    std::string XmlCtx::idToString(uint64_t id) {
+        // Ids of the dictionaries are stored as hex strings of 2, 4, 6 or 8 digits
+        uint digits = 2;
+        while (digits < 8 && (id >> (digits * 4)) != 0)
+            digits += 2;
+
+        std::string str(digits, '0');
+        for (uint i = 0; i < digits; ++i)
+            str[digits - 1 - i] = Data::map16U((id >> (i * 4)) & 0x0F);
+        return str;
+    }
+
+    const XmlCtx::Token* XmlCtx::getToken(uint64_t code) const {
+        const auto it = tokens.find(code);
+        if (it != tokens.end())
+            return &it->second;
+
+        const auto xdbXQnIt = xdbXQnPack.unorderedMapKey.find(XdbXQnKey(idToString(code)));
+        if (xdbXQnIt == xdbXQnPack.unorderedMapKey.end() || xdbXQnIt->second->flags.empty())
+            return nullptr;
+
+        const XdbXQn* xdbXQn = xdbXQnIt->second;
+        Token token;
+        token.localName = xdbXQn->localName;
+        token.nmSpc = strtoull(xdbXQn->nmSpcId.c_str(), nullptr, 16);
+        token.isAttribute = (((xdbXQn->flags.back() - '0') & XdbXQn::FLAG_ISATTRIBUTE) != 0);
+        return &tokens.insert_or_assign(code, std::move(token)).first->second;
+    }
+
+    const std::string* XmlCtx::getNmSpcUri(uint64_t nmSpc) const {
+        const auto it = nmSpcUris.find(nmSpc);
+        if (it != nmSpcUris.end())
+            return &it->second;
+
+        const auto xdbXNmIt = xdbXNmPack.unorderedMapKey.find(XdbXNmKey(idToString(nmSpc)));
+        if (xdbXNmIt == xdbXNmPack.unorderedMapKey.end())
+            return nullptr;
+
+        return &nmSpcUris.insert_or_assign(nmSpc, xdbXNmIt->second->nmSpcUri).first->second;
     }
 }
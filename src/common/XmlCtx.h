@@ -21,6 +21,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define XML_CTX_H_
 
 #include <map>
+#include <string>
 #include <unordered_map>
 
 #include "../common/Ctx.h"
@@ -33,6 +34,22 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 namespace OpenLogReplicator {
     class XmlCtx final {
+    public:
+        // Qualified name of XDB.X$QN decoded for binary XML
+        class Token final {
+        public:
+            std::string localName;
+            uint64_t nmSpc;
+            bool isAttribute;
+        };
+
+    protected:
+        // Decoded dictionary entries by numeric id, filled on first use and dropped when the dictionaries change
+        mutable std::unordered_map<uint64_t, Token> tokens;
+        mutable std::unordered_map<uint64_t, std::string> nmSpcUris;
+
+        [[nodiscard]] static std::string idToString(uint64_t id);
+
     public:
         TablePack<XdbXNm, TabRowIdKeyDefault, XdbXNmKey> xdbXNmPack;
         TablePack<XdbXQn, TabRowIdKeyDefault, XdbXQnKey> xdbXQnPack;
@@ -46,6 +63,9 @@ namespace OpenLogReplicator {
         ~XmlCtx();
 
         void purgeDicts() noexcept;
+        void invalidateTokens() noexcept;
+        [[nodiscard]] const Token* getToken(uint64_t code) const;
+        [[nodiscard]] const std::string* getNmSpcUri(uint64_t nmSpc) const;
     };
 }
 #endif
@@ -20,6 +20,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../Ctx.h"
 #include "../exception/RuntimeException.h"
 #include "BoolValue.h"
+#include "ConditionProgram.h"
 #include "StringValue.h"
 
 namespace OpenLogReplicator {
@@ -70,6 +71,52 @@ namespace OpenLogReplicator {
         throw RuntimeException(50066, "invalid expression evaluation: invalid bool type");
     }
 
+    void BoolValue::compile(ConditionProgram& program) const {
+        switch (boolType) {
+            case VALUE::FALSE:
+                program.emit(ConditionProgram::OPCODE::PUSH_FALSE);
+                return;
+
+            case VALUE::TRUE:
+                program.emit(ConditionProgram::OPCODE::PUSH_TRUE);
+                return;
+
+            case VALUE::OPERATOR_AND: {
+                left->compile(program);
+                const uint64_t jump = program.emit(ConditionProgram::OPCODE::JUMP_IF_FALSE);
+                right->compile(program);
+                program.setTarget(jump);
+                return;
+            }
+
+            case VALUE::OPERATOR_OR: {
+                left->compile(program);
+                const uint64_t jump = program.emit(ConditionProgram::OPCODE::JUMP_IF_TRUE);
+                right->compile(program);
+                program.setTarget(jump);
+                return;
+            }
+
+            case VALUE::OPERATOR_NOT:
+                left->compile(program);
+                program.emit(ConditionProgram::OPCODE::NOT);
+                return;
+
+            case VALUE::OPERATOR_EQUAL:
+                left->compile(program);
+                right->compile(program);
+                program.emit(ConditionProgram::OPCODE::EQUAL);
+                return;
+
+            case VALUE::OPERATOR_NOT_EQUAL:
+                left->compile(program);
+                right->compile(program);
+                program.emit(ConditionProgram::OPCODE::NOT_EQUAL);
+                return;
+        }
+        throw RuntimeException(50066, "invalid expression evaluation: invalid bool type");
+    }
+
     std::string BoolValue::evaluateToString(char op __attribute__((unused)), const AttributeMap* attributes __attribute__((unused))) {
         throw RuntimeException(50066, "invalid expression evaluation: bool to string");
     }
@@ -48,6 +48,7 @@ namespace OpenLogReplicator {
 
         bool evaluateToBool(char op, const AttributeMap* attributes) override;
         std::string evaluateToString(char op, const AttributeMap* attributes) override;
+        void compile(ConditionProgram& program) const override;
     };
 }
 
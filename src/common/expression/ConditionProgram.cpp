@@ -0,0 +1,153 @@
+/* Table condition compiled to a flat program
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <string_view>
+
+#include "../exception/RuntimeException.h"
+#include "ConditionProgram.h"
+
+namespace OpenLogReplicator {
+    uint64_t ConditionProgram::emit(OPCODE opCode, uint16_t arg) {
+        code.push_back({opCode, arg});
+        return code.size() - 1;
+    }
+
+    uint16_t ConditionProgram::addConstant(const std::string& value) {
+        for (uint16_t i = 0; i < constants.size(); ++i)
+            if (constants[i] == value)
+                return i;
+
+        constants.push_back(value);
+        return constants.size() - 1;
+    }
+
+    void ConditionProgram::setTarget(uint64_t pos) {
+        // Jump to the next instruction to be emitted
+        code[pos].arg = code.size();
+    }
+
+    void ConditionProgram::finish(const std::string& condition) const {
+        // The stacks are deepest on the path without jumps
+        uint strings = 0;
+        uint bools = 0;
+        for (const Instruction& instruction: code) {
+            switch (instruction.opCode) {
+                case OPCODE::PUSH_FALSE:
+                case OPCODE::PUSH_TRUE:
+                    ++bools;
+                    break;
+
+                case OPCODE::PUSH_ATTRIBUTE:
+                case OPCODE::PUSH_OP:
+                case OPCODE::PUSH_CONSTANT:
+                    ++strings;
+                    break;
+
+                case OPCODE::EQUAL:
+                case OPCODE::NOT_EQUAL:
+                    strings -= 2;
+                    ++bools;
+                    break;
+
+                case OPCODE::NOT:
+                    break;
+
+                case OPCODE::JUMP_IF_FALSE:
+                case OPCODE::JUMP_IF_TRUE:
+                    --bools;
+                    break;
+            }
+
+            if (strings > STACK_MAX || bools > STACK_MAX)
+                throw RuntimeException(50067, "invalid condition: " + condition + " is too complex, stack size exceeds: " + std::to_string(STACK_MAX));
+        }
+
+        if (code.empty() || code.size() > 65535 || strings != 0 || bools != 1)
+            throw RuntimeException(50067, "invalid condition: " + condition + " is not evaluated to bool");
+    }
+
+    bool ConditionProgram::evaluate(char op, const AttributeMap* attributes) const {
+        std::string_view strings[STACK_MAX];
+        bool bools[STACK_MAX];
+        uint stringsSize = 0;
+        uint boolsSize = 0;
+
+        for (uint64_t pc = 0; pc < code.size(); ++pc) {
+            const Instruction& instruction = code[pc];
+            switch (instruction.opCode) {
+                case OPCODE::PUSH_FALSE:
+                    bools[boolsSize++] = false;
+                    break;
+
+                case OPCODE::PUSH_TRUE:
+                    bools[boolsSize++] = true;
+                    break;
+
+                case OPCODE::PUSH_ATTRIBUTE: {
+                    strings[stringsSize] = std::string_view();
+                    if (attributes != nullptr) {
+                        const auto attributesIt = attributes->find(static_cast<Attribute::KEY>(instruction.arg));
+                        if (attributesIt != attributes->end())
+                            strings[stringsSize] = attributesIt->second;
+                    }
+                    ++stringsSize;
+                    break;
+                }
+
+                case OPCODE::PUSH_OP:
+                    strings[stringsSize++] = std::string_view(&op, 1);
+                    break;
+
+                case OPCODE::PUSH_CONSTANT:
+                    strings[stringsSize++] = constants[instruction.arg];
+                    break;
+
+                case OPCODE::EQUAL:
+                    stringsSize -= 2;
+                    bools[boolsSize++] = (strings[stringsSize] == strings[stringsSize + 1]);
+                    break;
+
+                case OPCODE::NOT_EQUAL:
+                    stringsSize -= 2;
+                    bools[boolsSize++] = (strings[stringsSize] != strings[stringsSize + 1]);
+                    break;
+
+                case OPCODE::NOT:
+                    bools[boolsSize - 1] = !bools[boolsSize - 1];
+                    break;
+
+                case OPCODE::JUMP_IF_FALSE:
+                    if (!bools[boolsSize - 1])
+                        pc = instruction.arg - 1;
+                    else
+                        --boolsSize;
+                    break;
+
+                case OPCODE::JUMP_IF_TRUE:
+                    if (bools[boolsSize - 1])
+                        pc = instruction.arg - 1;
+                    else
+                        --boolsSize;
+                    break;
+            }
+        }
+
+        return bools[0];
+    }
+}
@@ -0,0 +1,70 @@
+/* Header for ConditionProgram class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+
+#ifndef CONDITION_PROGRAM_H_
+#define CONDITION_PROGRAM_H_
+
+#include <string>
+#include <vector>
+
+#include "../types/Types.h"
+#include "../Attribute.h"
+
+namespace OpenLogReplicator {
+    // Table condition compiled to a flat list of instructions, evaluated on fixed size stacks without allocations. Attribute names are resolved
+    // to keys and string constants are stored once at compile time.
+    class ConditionProgram final {
+    public:
+        static constexpr uint STACK_MAX{32};
+
+        enum class OPCODE : unsigned char {
+            PUSH_FALSE,
+            PUSH_TRUE,
+            PUSH_ATTRIBUTE,
+            PUSH_OP,
+            PUSH_CONSTANT,
+            EQUAL,
+            NOT_EQUAL,
+            NOT,
+            // Jumps keep the value on the stack when taken, drop it otherwise
+            JUMP_IF_FALSE,
+            JUMP_IF_TRUE
+        };
+
+        class Instruction final {
+        public:
+            OPCODE opCode;
+            uint16_t arg;
+        };
+
+    protected:
+        std::vector<Instruction> code;
+        std::vector<std::string> constants;
+
+    public:
+        uint64_t emit(OPCODE opCode, uint16_t arg = 0);
+        uint16_t addConstant(const std::string& value);
+        void setTarget(uint64_t pos);
+        void finish(const std::string& condition) const;
+        [[nodiscard]] bool evaluate(char op, const AttributeMap* attributes) const;
+    };
+}
+
+#endif
@@ -28,6 +28,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 
 namespace OpenLogReplicator {
     class BoolValue;
+    class ConditionProgram;
     class Token;
 
     class Expression {
@@ -46,6 +47,7 @@ namespace OpenLogReplicator {
 
         virtual bool evaluateToBool(char op, const AttributeMap* attributes) = 0;
         virtual std::string evaluateToString(char op, const AttributeMap* attributes) = 0;
+        virtual void compile(ConditionProgram& program) const = 0;
     };
 }
 
@@ -20,6 +20,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <utility>
 
 #include "../exception/RuntimeException.h"
+#include "ConditionProgram.h"
 #include "StringValue.h"
 #include "../Attribute.h"
 
@@ -56,4 +57,28 @@ namespace OpenLogReplicator {
 
         throw RuntimeException(50066, "invalid expression evaluation: invalid string type");
     }
+
+    void StringValue::compile(ConditionProgram& program) const {
+        switch (stringType) {
+            case TYPE::SESSION_ATTRIBUTE: {
+                // Unknown attributes are always empty
+                const auto enumIt = Attribute::fromString().find(stringValue);
+                if (enumIt == Attribute::fromString().end())
+                    program.emit(ConditionProgram::OPCODE::PUSH_CONSTANT, program.addConstant(""));
+                else
+                    program.emit(ConditionProgram::OPCODE::PUSH_ATTRIBUTE, static_cast<uint16_t>(enumIt->second));
+                return;
+            }
+
+            case TYPE::OP:
+                program.emit(ConditionProgram::OPCODE::PUSH_OP);
+                return;
+
+            case TYPE::VALUE:
+                program.emit(ConditionProgram::OPCODE::PUSH_CONSTANT, program.addConstant(stringValue));
+                return;
+        }
+
+        throw RuntimeException(50066, "invalid expression evaluation: invalid string type");
+    }
 }
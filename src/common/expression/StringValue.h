@@ -40,6 +40,7 @@ namespace OpenLogReplicator {
 
         bool evaluateToBool(char op, const AttributeMap* attributes) override;
         std::string evaluateToString(char op, const AttributeMap* attributes) override;
+        void compile(ConditionProgram& program) const override;
     };
 }
 
@@ -20,6 +20,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <utility>
 
 #include "../exception/RuntimeException.h"
+#include "ConditionProgram.h"
 #include "Token.h"
 
 namespace OpenLogReplicator {
@@ -34,4 +35,8 @@ namespace OpenLogReplicator {
     std::string Token::evaluateToString(char op __attribute__((unused)), const AttributeMap* attributes __attribute__((unused))) {
         throw RuntimeException(50066, "invalid expression evaluation: token to string");
     }
+
+    void Token::compile(ConditionProgram& program __attribute__((unused))) const {
+        throw RuntimeException(50066, "invalid expression evaluation: token compile");
+    }
 }
@@ -21,6 +21,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define METRICS_H_
 
 #include <mutex>
+#include <string>
 
 namespace OpenLogReplicator {
     class Ctx;
@@ -42,6 +43,8 @@ namespace OpenLogReplicator {
 
         virtual void initialize(const Ctx* ctx) = 0;
         virtual void shutdown() = 0;
+        // Metrics of one of many sources, labeled with the source alias
+        [[nodiscard]] virtual Metrics* addSource(const std::string& source) = 0;
         bool isTagNamesFilter();
         bool isTagNamesSys();
 
@@ -64,6 +67,16 @@ namespace OpenLogReplicator {
         // checkpoint_lag
         virtual void emitCheckpointLag(int64_t gauge) = 0;
 
+        // checkpoint_lock_us
+        virtual void emitCheckpointLockUs(int64_t gauge) = 0;
+
+        // compression_bytes
+        virtual void emitCompressionBytesIn(uint64_t counter) = 0;
+        virtual void emitCompressionBytesOut(uint64_t counter) = 0;
+
+        // compression_time_us
+        virtual void emitCompressionTimeUs(uint64_t counter) = 0;
+
         // ddl_ops
         virtual void emitDdlOpsAlter(uint64_t counter) = 0;
         virtual void emitDdlOpsCreate(uint64_t counter) = 0;
@@ -114,6 +127,12 @@ namespace OpenLogReplicator {
         // messages sent
         virtual void emitMessagesSent(uint64_t counter) = 0;
 
+        // redo_latency_us
+        virtual void emitRedoLatencyUs(int64_t value) = 0;
+
+        // redo_thread_lag
+        virtual void emitRedoThreadLag(int64_t gauge, uint16_t thread) = 0;
+
         // service_state
         virtual void emitServiceStateInitializing(int64_t gauge) = 0;
         virtual void emitServiceStateReady(int64_t gauge) = 0;
@@ -130,6 +149,12 @@ namespace OpenLogReplicator {
         // swap_usage_mb
         virtual void emitSwapUsageMb(int64_t gauge) = 0;
 
+        // thread_context_us
+        virtual void emitThreadContextUs(int64_t gauge, const std::string& thread, const std::string& context) = 0;
+
+        // thread_context_switches
+        virtual void emitThreadContextSwitches(int64_t gauge, const std::string& thread) = 0;
+
         // transactions
         virtual void emitTransactionsCommitOut(uint64_t counter) = 0;
         virtual void emitTransactionsRollbackOut(uint64_t counter) = 0;
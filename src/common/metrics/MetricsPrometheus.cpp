@@ -36,39 +36,52 @@ namespace OpenLogReplicator {
         ctx->info(0, "starting Prometheus metrics, listening on: " + bind);
         exposer = new prometheus::Exposer(bind);
         registry = std::make_shared<prometheus::Registry>();
+        registerFamilies();
+        exposer->RegisterCollectable(registry);
+    }
+
+    // Families of the metrics are shared by all sources, series of each source differ by the "source" label
+    Metrics* MetricsPrometheus::addSource(const std::string& newSource) {
+        auto* sourceMetrics = new MetricsPrometheus(tagNames, bind);
+        sourceMetrics->source = newSource;
+        sourceMetrics->registry = registry;
+        sourceMetrics->registerFamilies();
+        return sourceMetrics;
+    }
 
+    void MetricsPrometheus::registerFamilies() {
         // bytes_confirmed
         bytesConfirmed = &prometheus::BuildCounter().Name("bytes_confirmed")
                                                     .Help("Number of bytes confirmed by output")
                                                     .Register(*registry);
-        bytesConfirmedCounter = &bytesConfirmed->Add({});
+        bytesConfirmedCounter = &add(bytesConfirmed, {});
 
         // bytes_parsed
         bytesParsed = &prometheus::BuildCounter().Name("bytes_parsed")
                                                  .Help("Number of bytes parsed containing redo log data")
                                                  .Register(*registry);
-        bytesParsedCounter = &bytesParsed->Add({});
+        bytesParsedCounter = &add(bytesParsed, {});
 
         // bytes_read
         bytesRead = &prometheus::BuildCounter().Name("bytes_read")
                                                .Help("Number of bytes read from redo log files")
                                                .Register(*registry);
-        bytesReadCounter = &bytesRead->Add({});
+        bytesReadCounter = &add(bytesRead, {});
 
         // bytes_sent
         bytesSent = &prometheus::BuildCounter().Name("bytes_sent")
                                                .Help("Number of bytes sent to output (for example to Kafka or network writer)")
                                                .Register(*registry);
-        bytesSentCounter = &bytesSent->Add({});
+        bytesSentCounter = &add(bytesSent, {});
 
         // checkpoints
         checkpoints = &prometheus::BuildCounter().Name("checkpoints")
                                                  .Help("Number of checkpoint records")
                                                  .Register(*registry);
-        checkpointsOutCounter = &checkpoints->Add({
+        checkpointsOutCounter = &add(checkpoints, {
             {"filter", "out"}
         });
-        checkpointsSkipCounter = &checkpoints->Add({
+        checkpointsSkipCounter = &add(checkpoints, {
             {"filter", "skip"}
         });
 
@@ -76,28 +89,51 @@ namespace OpenLogReplicator {
         checkpointLag = &prometheus::BuildGauge().Name("checkpoint_lag")
                                                  .Help("Checkpoint processing lag in seconds")
                                                  .Register(*registry);
-        checkpointLagGauge = &checkpointLag->Add({});
+        checkpointLagGauge = &add(checkpointLag, {});
+
+        // checkpoint_lock_us
+        checkpointLockUs = &prometheus::BuildGauge().Name("checkpoint_lock_us")
+                                                    .Help("Time the checkpoint data was locked while writing the last checkpoint in microseconds")
+                                                    .Register(*registry);
+        checkpointLockUsGauge = &add(checkpointLockUs, {});
+
+        // compression_bytes
+        compressionBytes = &prometheus::BuildCounter().Name("compression_bytes")
+                                                      .Help("Number of bytes compressed by the file writer")
+                                                      .Register(*registry);
+        compressionBytesInCounter = &add(compressionBytes, {
+            {"type", "in"}
+        });
+        compressionBytesOutCounter = &add(compressionBytes, {
+            {"type", "out"}
+        });
+
+        // compression_time_us
+        compressionTimeUs = &prometheus::BuildCounter().Name("compression_time_us")
+                                                       .Help("Time spent by compression threads of the file writer in microseconds")
+                                                       .Register(*registry);
+        compressionTimeUsCounter = &add(compressionTimeUs, {});
 
         // ddl_ops
         ddlOps = &prometheus::BuildCounter().Name("ddl_ops")
                                             .Help("Number of DDL operations")
                                             .Register(*registry);
-        ddlOpsAlterCounter = &ddlOps->Add({
+        ddlOpsAlterCounter = &add(ddlOps, {
             {"type", "alter"}
         });
-        ddlOpsCreateCounter = &ddlOps->Add({
+        ddlOpsCreateCounter = &add(ddlOps, {
             {"type", "create"}
         });
-        ddlOpsDropCounter = &ddlOps->Add({
+        ddlOpsDropCounter = &add(ddlOps, {
             {"type", "drop"}
         });
-        ddlOpsOtherCounter = &ddlOps->Add({
+        ddlOpsOtherCounter = &add(ddlOps, {
             {"type", "other"}
         });
-        ddlOpsPurgeCounter = &ddlOps->Add({
+        ddlOpsPurgeCounter = &add(ddlOps, {
             {"type", "purge"}
         });
-        ddlOpsTruncateCounter = &ddlOps->Add({
+        ddlOpsTruncateCounter = &add(ddlOps, {
             {"type", "truncate"}
         });
 
@@ -105,27 +141,27 @@ namespace OpenLogReplicator {
         dmlOps = &prometheus::BuildCounter().Name("dml_ops")
                                             .Help("Number of DML operations")
                                             .Register(*registry);
-        dmlOpsDeleteOutCounter = &dmlOps->Add({
+        dmlOpsDeleteOutCounter = &add(dmlOps, {
             {"type", "delete"},
             {"filter", "out"}
         });
-        dmlOpsInsertOutCounter = &dmlOps->Add({
+        dmlOpsInsertOutCounter = &add(dmlOps, {
             {"type", "insert"},
             {"filter", "out"}
         });
-        dmlOpsUpdateOutCounter = &dmlOps->Add({
+        dmlOpsUpdateOutCounter = &add(dmlOps, {
             {"type", "update"},
             {"filter", "out"}
         });
-        dmlOpsDeleteSkipCounter = &dmlOps->Add({
+        dmlOpsDeleteSkipCounter = &add(dmlOps, {
             {"type", "delete"},
             {"filter", "skip"}
         });
-        dmlOpsInsertSkipCounter = &dmlOps->Add({
+        dmlOpsInsertSkipCounter = &add(dmlOps, {
             {"type", "insert"},
             {"filter", "skip"}
         });
-        dmlOpsUpdateSkipCounter = &dmlOps->Add({
+        dmlOpsUpdateSkipCounter = &add(dmlOps, {
             {"type", "update"},
             {"filter", "skip"}
         });
@@ -134,10 +170,10 @@ namespace OpenLogReplicator {
         logSwitches = &prometheus::BuildCounter().Name("log_switches")
                                                  .Help("Number of redo log switches")
                                                  .Register(*registry);
-        logSwitchesOnlineCounter = &logSwitches->Add({
+        logSwitchesOnlineCounter = &add(logSwitches, {
             {"type", "online"}
         });
-        logSwitchesArchivedCounter = &logSwitches->Add({
+        logSwitchesArchivedCounter = &add(logSwitches, {
             {"type", "archived"}
         });
 
@@ -145,10 +181,10 @@ namespace OpenLogReplicator {
         logSwitchesLag = &prometheus::BuildGauge().Name("log_switches_lag")
                                                   .Help("Redo log file processing lag in seconds")
                                                   .Register(*registry);
-        logSwitchesLagOnlineGauge = &logSwitchesLag->Add({
+        logSwitchesLagOnlineGauge = &add(logSwitchesLag, {
             {"type", "online"}
         });
-        logSwitchesLagArchivedGauge = &logSwitchesLag->Add({
+        logSwitchesLagArchivedGauge = &add(logSwitchesLag, {
             {"type", "archived"}
         });
 
@@ -156,40 +192,40 @@ namespace OpenLogReplicator {
         messagesConfirmed = &prometheus::BuildCounter().Name("messages_confirmed")
                                                        .Help("Number of messages confirmed by output")
                                                        .Register(*registry);
-        messagesConfirmedCounter = &messagesConfirmed->Add({});
+        messagesConfirmedCounter = &add(messagesConfirmed, {});
 
         // memory_allocated_mb
         memoryAllocatedMb = &prometheus::BuildGauge().Name("memory_allocated_mb")
                                                      .Help("Amount of allocated memory in MB")
                                                      .Register(*registry);
-        memoryAllocatedMbGauge = &memoryAllocatedMb->Add({});
+        memoryAllocatedMbGauge = &add(memoryAllocatedMb, {});
 
         // memory_used_total_mb
         memoryUsedTotalMb = &prometheus::BuildGauge().Name("memory_used_total_mb")
                                                      .Help("Total used memory")
                                                      .Register(*registry);
-        memoryUsedTotalMbGauge = &memoryUsedTotalMb->Add({});
+        memoryUsedTotalMbGauge = &add(memoryUsedTotalMb, {});
 
         // memory_used_mb
         memoryUsedMb = &prometheus::BuildGauge().Name("memory_used_mb")
                                                  .Help("Memory used by module: builder")
                                                  .Register(*registry);
-        memoryUsedMbBuilderGauge = &memoryUsedMb->Add({
+        memoryUsedMbBuilderGauge = &add(memoryUsedMb, {
             {"type", "builder"}
         });
-        memoryUsedMbMiscGauge = &memoryUsedMb->Add({
+        memoryUsedMbMiscGauge = &add(memoryUsedMb, {
             {"type", "misc"}
         });
-        memoryUsedMbParserGauge = &memoryUsedMb->Add({
+        memoryUsedMbParserGauge = &add(memoryUsedMb, {
             {"type", "parser"}
         });
-        memoryUsedMbReaderGauge = &memoryUsedMb->Add({
+        memoryUsedMbReaderGauge = &add(memoryUsedMb, {
             {"type", "reader"}
         });
-        memoryUsedMbTransactionsGauge = &memoryUsedMb->Add({
+        memoryUsedMbTransactionsGauge = &add(memoryUsedMb, {
             {"type", "transactions"}
         });
-        memoryUsedMbWriterGauge = &memoryUsedMb->Add({
+        memoryUsedMbWriterGauge = &add(memoryUsedMb, {
             {"type", "writer"}
         });
 
@@ -197,28 +233,40 @@ namespace OpenLogReplicator {
         messagesSent = &prometheus::BuildCounter().Name("messages_sent")
                                                   .Help("Number of messages sent to output (for example to Kafka or network writer)")
                                                   .Register(*registry);
-        messagesSentCounter = &messagesSent->Add({});
+        messagesSentCounter = &add(messagesSent, {});
+
+        // redo_latency_us
+        redoLatencyUs = &prometheus::BuildHistogram().Name("redo_latency_us")
+                                                     .Help("Time from reading an online redo log block to sending the message to output in microseconds")
+                                                     .Register(*registry);
+        redoLatencyUsHistogram = &add(redoLatencyUs, {}, {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000,
+                                                          1000000});
+
+        // redo_thread_lag
+        redoThreadLag = &prometheus::BuildGauge().Name("redo_thread_lag")
+                                                 .Help("Lag of the last merged checkpoint of the redo thread in seconds")
+                                                 .Register(*registry);
 
         // service_state
         serviceState = &prometheus::BuildGauge().Name("service_state")
                                                   .Help("Service state")
                                                   .Register(*registry);
-        serviceStateInitializingGauge = &serviceState->Add({
+        serviceStateInitializingGauge = &add(serviceState, {
             {"state", "initializing"}
         });
-        serviceStateStartingGauge = &serviceState->Add({
+        serviceStateStartingGauge = &add(serviceState, {
             {"state", "starting"}
         });
-        serviceStateReadyGauge = &serviceState->Add({
+        serviceStateReadyGauge = &add(serviceState, {
             {"state", "ready"}
         });
-        serviceStateReplicatingGauge = &serviceState->Add({
+        serviceStateReplicatingGauge = &add(serviceState, {
             {"state", "replicating"}
         });
-        serviceStateFinishingGauge = &serviceState->Add({
+        serviceStateFinishingGauge = &add(serviceState, {
             {"state", "finishing"}
         });
-        serviceStateAbortingGauge = &serviceState->Add({
+        serviceStateAbortingGauge = &add(serviceState, {
             {"state", "aborting"}
         });
 
@@ -226,13 +274,13 @@ namespace OpenLogReplicator {
         swapOperationsMb = &prometheus::BuildCounter().Name("swap_operations_mb")
                                                       .Help("Operations on swap space in MB")
                                                       .Register(*registry);
-        swapOperationsMbDiscardCounter = &swapOperationsMb->Add({
+        swapOperationsMbDiscardCounter = &add(swapOperationsMb, {
             {"type", "discard"}
         });
-        swapOperationsMbReadCounter = &swapOperationsMb->Add({
+        swapOperationsMbReadCounter = &add(swapOperationsMb, {
             {"type", "read"}
         });
-        swapOperationsMbWriteCounter = &swapOperationsMb->Add({
+        swapOperationsMbWriteCounter = &add(swapOperationsMb, {
             {"type", "write"}
         });
 
@@ -240,43 +288,51 @@ namespace OpenLogReplicator {
         swapUsageMb = &prometheus::BuildGauge().Name("swap_usage_mb")
                                                .Help("Swap usage in MB")
                                                .Register(*registry);
-        swapUsageMbGauge = &swapUsageMb->Add({});
+        swapUsageMbGauge = &add(swapUsageMb, {});
+
+        // thread_context_switches
+        threadContextSwitches = &prometheus::BuildGauge().Name("thread_context_switches")
+                                                         .Help("Number of thread context switches")
+                                                         .Register(*registry);
+
+        // thread_context_us
+        threadContextUs = &prometheus::BuildGauge().Name("thread_context_us")
+                                                   .Help("Time spent by thread in context in microseconds")
+                                                   .Register(*registry);
 
         memoryUsedTotalMb = &prometheus::BuildGauge().Name("memory_used_total_mb")
                                                      .Help("Total used memory")
                                                      .Register(*registry);
-        memoryUsedTotalMbGauge = &memoryUsedTotalMb->Add({});
+        memoryUsedTotalMbGauge = &add(memoryUsedTotalMb, {});
 
         // transactions
         transactions = &prometheus::BuildCounter().Name("dml_ops")
                                                   .Help("Number of transactions")
                                                   .Register(*registry);
-        transactionsCommitOutCounter = &transactions->Add({
+        transactionsCommitOutCounter = &add(transactions, {
             {"type", "commit"},
             {"filter", "out"}
         });
-        transactionsRollbackOutCounter = &transactions->Add({
+        transactionsRollbackOutCounter = &add(transactions, {
             {"type", "rollback"},
             {"filter", "out"}
         });
-        transactionsCommitPartialCounter = &transactions->Add({
+        transactionsCommitPartialCounter = &add(transactions, {
             {"type", "commit"},
             {"filter", "partial"}
         });
-        transactionsRollbackPartialCounter = &transactions->Add({
+        transactionsRollbackPartialCounter = &add(transactions, {
             {"type", "rollback"},
             {"filter", "partial"}
         });
-        transactionsCommitSkipCounter = &transactions->Add({
+        transactionsCommitSkipCounter = &add(transactions, {
             {"type", "commit"},
             {"filter", "skip"}
         });
-        transactionsRollbackSkipCounter = &transactions->Add({
+        transactionsRollbackSkipCounter = &add(transactions, {
             {"type", "rollback"},
             {"filter", "skip"}
         });
-
-        exposer->RegisterCollectable(registry);
     }
 
     void MetricsPrometheus::shutdown() {}
@@ -315,6 +371,25 @@ namespace OpenLogReplicator {
         checkpointLagGauge->Set(gauge);
     }
 
+    // checkpoint_lock_us
+    void MetricsPrometheus::emitCheckpointLockUs(int64_t gauge) {
+        checkpointLockUsGauge->Set(gauge);
+    }
+
+    // compression_bytes
+    void MetricsPrometheus::emitCompressionBytesIn(uint64_t counter) {
+        compressionBytesInCounter->Increment(counter);
+    }
+
+    void MetricsPrometheus::emitCompressionBytesOut(uint64_t counter) {
+        compressionBytesOutCounter->Increment(counter);
+    }
+
+    // compression_time_us
+    void MetricsPrometheus::emitCompressionTimeUs(uint64_t counter) {
+        compressionTimeUsCounter->Increment(counter);
+    }
+
     // ddl_ops
     void MetricsPrometheus::emitDdlOpsAlter(uint64_t counter) {
         ddlOpsAlterCounter->Increment(counter);
@@ -373,7 +448,7 @@ namespace OpenLogReplicator {
         if (it != dmlOpsDeleteOutCounterMap.end())
             cnt = it->second;
         else
-            cnt = &dmlOps->Add({
+            cnt = &add(dmlOps, {
                 {"type", "delete"},
                 {"filter", "out"},
                 {"owner", owner},
@@ -391,7 +466,7 @@ namespace OpenLogReplicator {
         if (it != dmlOpsInsertOutCounterMap.end())
             cnt = it->second;
         else
-            cnt = &dmlOps->Add({
+            cnt = &add(dmlOps, {
                 {"type", "insert"},
                 {"filter", "out"},
                 {"owner", owner},
@@ -409,7 +484,7 @@ namespace OpenLogReplicator {
         if (it != dmlOpsUpdateOutCounterMap.end())
             cnt = it->second;
         else
-            cnt = &dmlOps->Add({
+            cnt = &add(dmlOps, {
                 {"type", "update"},
                 {"filter", "out"},
                 {"owner", owner},
@@ -427,7 +502,7 @@ namespace OpenLogReplicator {
         if (it != dmlOpsDeleteSkipCounterMap.end())
             cnt = it->second;
         else
-            cnt = &dmlOps->Add({
+            cnt = &add(dmlOps, {
                 {"type", "delete"},
                 {"filter", "skip"},
                 {"owner", owner},
@@ -445,7 +520,7 @@ namespace OpenLogReplicator {
         if (it != dmlOpsInsertSkipCounterMap.end())
             cnt = it->second;
         else
-            cnt = &dmlOps->Add({
+            cnt = &add(dmlOps, {
                 {"type", "insert"},
                 {"filter", "skip"},
                 {"owner", owner},
@@ -463,7 +538,7 @@ namespace OpenLogReplicator {
         if (it != dmlOpsUpdateSkipCounterMap.end())
             cnt = it->second;
         else
-            cnt = &dmlOps->Add({
+            cnt = &add(dmlOps, {
                 {"type", "update"},
                 {"filter", "skip"},
                 {"owner", owner},
@@ -536,6 +611,28 @@ namespace OpenLogReplicator {
         messagesSentCounter->Increment(counter);
     }
 
+    // redo_latency_us
+    void MetricsPrometheus::emitRedoLatencyUs(int64_t value) {
+        redoLatencyUsHistogram->Observe(static_cast<double>(value));
+    }
+
+    // redo_thread_lag
+    void MetricsPrometheus::emitRedoThreadLag(int64_t gauge, uint16_t thread) {
+        prometheus::Gauge* gau;
+        const auto& it = redoThreadLagGaugeMap.find(thread);
+
+        if (it != redoThreadLagGaugeMap.end())
+            gau = it->second;
+        else {
+            gau = &add(redoThreadLag, {
+                {"thread", std::to_string(thread)}
+            });
+            redoThreadLagGaugeMap.insert_or_assign(thread, gau);
+        }
+
+        gau->Set(gauge);
+    }
+
     // service_state
     void MetricsPrometheus::emitServiceStateInitializing(int64_t gauge) {
         serviceStateInitializingGauge->Set(gauge);
@@ -579,6 +676,42 @@ namespace OpenLogReplicator {
         swapUsageMbGauge->Set(gauge);
     }
 
+    // thread_context_us
+    void MetricsPrometheus::emitThreadContextUs(int64_t gauge, const std::string& thread, const std::string& context) {
+        const std::string key(thread + "." + context);
+        prometheus::Gauge* gau;
+        const auto& it = threadContextUsGaugeMap.find(key);
+
+        if (it != threadContextUsGaugeMap.end())
+            gau = it->second;
+        else {
+            gau = &add(threadContextUs, {
+                {"thread", thread},
+                {"context", context}
+            });
+            threadContextUsGaugeMap.insert_or_assign(key, gau);
+        }
+
+        gau->Set(gauge);
+    }
+
+    // thread_context_switches
+    void MetricsPrometheus::emitThreadContextSwitches(int64_t gauge, const std::string& thread) {
+        prometheus::Gauge* gau;
+        const auto& it = threadContextSwitchesGaugeMap.find(thread);
+
+        if (it != threadContextSwitchesGaugeMap.end())
+            gau = it->second;
+        else {
+            gau = &add(threadContextSwitches, {
+                {"thread", thread}
+            });
+            threadContextSwitchesGaugeMap.insert_or_assign(thread, gau);
+        }
+
+        gau->Set(gauge);
+    }
+
     // transactions
     void MetricsPrometheus::emitTransactionsCommitOut(uint64_t counter) {
         transactionsCommitOutCounter->Increment(counter);
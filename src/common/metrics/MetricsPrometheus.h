@@ -23,6 +23,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <map>
 #include <prometheus/counter.h>
 #include <prometheus/exposer.h>
+#include <prometheus/histogram.h>
 #include <prometheus/registry.h>
 
 #include "Metrics.h"
@@ -31,6 +32,7 @@ namespace OpenLogReplicator {
     class MetricsPrometheus final : public Metrics {
     protected:
         std::string bind;
+        std::string source;
         prometheus::Exposer* exposer{nullptr};
         std::shared_ptr<prometheus::Registry> registry;
 
@@ -59,6 +61,19 @@ namespace OpenLogReplicator {
         prometheus::Family<prometheus::Gauge>* checkpointLag{nullptr};
         prometheus::Gauge* checkpointLagGauge{nullptr};
 
+        // checkpoint_lock_us
+        prometheus::Family<prometheus::Gauge>* checkpointLockUs{nullptr};
+        prometheus::Gauge* checkpointLockUsGauge{nullptr};
+
+        // compression_bytes
+        prometheus::Family<prometheus::Counter>* compressionBytes{nullptr};
+        prometheus::Counter* compressionBytesInCounter{nullptr};
+        prometheus::Counter* compressionBytesOutCounter{nullptr};
+
+        // compression_time_us
+        prometheus::Family<prometheus::Counter>* compressionTimeUs{nullptr};
+        prometheus::Counter* compressionTimeUsCounter{nullptr};
+
         // ddl_ops
         prometheus::Family<prometheus::Counter>* ddlOps{nullptr};
         prometheus::Counter* ddlOpsAlterCounter{nullptr};
@@ -118,6 +133,14 @@ namespace OpenLogReplicator {
         prometheus::Family<prometheus::Counter>* messagesSent{nullptr};
         prometheus::Counter* messagesSentCounter{nullptr};
 
+        // redo_latency_us
+        prometheus::Family<prometheus::Histogram>* redoLatencyUs{nullptr};
+        prometheus::Histogram* redoLatencyUsHistogram{nullptr};
+
+        // redo_thread_lag
+        prometheus::Family<prometheus::Gauge>* redoThreadLag{nullptr};
+        std::unordered_map<uint16_t, prometheus::Gauge*> redoThreadLagGaugeMap;
+
         // swap_operations
         prometheus::Family<prometheus::Counter>* swapOperationsMb{nullptr};
         prometheus::Counter* swapOperationsMbDiscardCounter{nullptr};
@@ -128,6 +151,14 @@ namespace OpenLogReplicator {
         prometheus::Family<prometheus::Gauge>* swapUsageMb{nullptr};
         prometheus::Gauge* swapUsageMbGauge{nullptr};
 
+        // thread_context_us
+        prometheus::Family<prometheus::Gauge>* threadContextUs{nullptr};
+        std::unordered_map<std::string, prometheus::Gauge*> threadContextUsGaugeMap;
+
+        // thread_context_switches
+        prometheus::Family<prometheus::Gauge>* threadContextSwitches{nullptr};
+        std::unordered_map<std::string, prometheus::Gauge*> threadContextSwitchesGaugeMap;
+
         // transactions
         prometheus::Family<prometheus::Counter>* transactions{nullptr};
         prometheus::Counter* transactionsCommitOutCounter{nullptr};
@@ -146,12 +177,29 @@ namespace OpenLogReplicator {
         prometheus::Gauge* serviceStateFinishingGauge{nullptr};
         prometheus::Gauge* serviceStateAbortingGauge{nullptr};
 
+        void registerFamilies();
+
+        template<class T>
+        T& add(prometheus::Family<T>* family, std::map<std::string, std::string> labels) {
+            if (!source.empty())
+                labels.emplace("source", source);
+            return family->Add(labels);
+        }
+
+        prometheus::Histogram& add(prometheus::Family<prometheus::Histogram>* family, std::map<std::string, std::string> labels,
+                                   const prometheus::Histogram::BucketBoundaries& buckets) {
+            if (!source.empty())
+                labels.emplace("source", source);
+            return family->Add(labels, buckets);
+        }
+
     public:
         MetricsPrometheus(TAG_NAMES newTagNames, std::string newBind);
         ~MetricsPrometheus() override;
 
         void initialize(const Ctx* ctx) override;
         void shutdown() override;
+        [[nodiscard]] Metrics* addSource(const std::string& newSource) override;
 
         // bytes_confirmed
         void emitBytesConfirmed(uint64_t counter) override;
@@ -171,6 +219,14 @@ namespace OpenLogReplicator {
 
         // checkpoint_lag
         void emitCheckpointLag(int64_t gauge) override;
+        void emitCheckpointLockUs(int64_t gauge) override;
+
+        // compression_bytes
+        void emitCompressionBytesIn(uint64_t counter) override;
+        void emitCompressionBytesOut(uint64_t counter) override;
+
+        // compression_time_us
+        void emitCompressionTimeUs(uint64_t counter) override;
 
         // ddl_ops
         void emitDdlOpsAlter(uint64_t counter) override;
@@ -222,6 +278,12 @@ namespace OpenLogReplicator {
         // messages sent
         void emitMessagesSent(uint64_t counter) override;
 
+        // redo_latency_us
+        void emitRedoLatencyUs(int64_t value) override;
+
+        // redo_thread_lag
+        void emitRedoThreadLag(int64_t gauge, uint16_t thread) override;
+
         // swap_operations
         void emitSwapOperationsMbDiscard(uint64_t counter) override;
         void emitSwapOperationsMbRead(uint64_t counter) override;
@@ -230,6 +292,12 @@ namespace OpenLogReplicator {
         // swap_usage_mb
         void emitSwapUsageMb(int64_t gauge) override;
 
+        // thread_context_us
+        void emitThreadContextUs(int64_t gauge, const std::string& thread, const std::string& context) override;
+
+        // thread_context_switches
+        void emitThreadContextSwitches(int64_t gauge, const std::string& thread) override;
+
         // transactions
         void emitTransactionsCommitOut(uint64_t counter) override;
         void emitTransactionsRollbackOut(uint64_t counter) override;
@@ -24,6 +24,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "../exception/RuntimeException.h"
 #include "../types/FileOffset.h"
@@ -38,12 +39,21 @@ namespace OpenLogReplicator {
         std::map<KeyMap, Data*> mapKey;
         std::unordered_map<KeyUnorderedMap, Data*> unorderedMapKey;
         std::set<Data*> setTouched;
+        // Rows inserted, updated or deleted since the last schema image written to a checkpoint file
+        std::set<RowId> setChanged;
+        // Rows of the schema image being written by the checkpoint thread, they are not modified until the snapshot is released,
+        // updated and deleted rows are replaced by copies and the originals retired
+        std::vector<Data*> snapshotRows;
+        std::vector<RowId> snapshotDropped;
+        std::vector<Data*> snapshotRetired;
+        bool snapshotActive{false};
 
         [[nodiscard]] Data* forUpdate(const Ctx* ctx, RowId rowId, FileOffset fileOffset) {
             auto mapRowIdIt = mapRowId.find(rowId);
             if (likely(mapRowIdIt != mapRowId.end())) {
                 dropKeys(mapRowIdIt->second);
-                return mapRowIdIt->second;
+                setChanged.insert(rowId);
+                return detach(mapRowIdIt);
             }
 
             if (likely(!ctx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA))) {
@@ -54,6 +64,7 @@ namespace OpenLogReplicator {
             }
             auto data = new Data(rowId);
             mapRowId.insert_or_assign(rowId, data);
+            setChanged.insert(rowId);
             return data;
         }
 
@@ -77,9 +88,13 @@ namespace OpenLogReplicator {
                         unorderedMapKey.erase(it);
                 }
 
-                delete data;
+                if (snapshotActive)
+                    snapshotRetired.push_back(data);
+                else
+                    delete data;
             }
             mapRowId.clear();
+            setChanged.clear();
 
             if constexpr (!std::is_same_v<KeyMap, TabRowIdKeyDefault>) {
                 if (!mapKey.empty())
@@ -116,11 +131,69 @@ namespace OpenLogReplicator {
             return true;
         }
 
+        // Rows stored in a schema image: all rows or, for a delta image, only the changed ones
+        [[nodiscard]] std::vector<Data*> image(bool delta) const {
+            std::vector<Data*> rows;
+            if (!delta) {
+                rows.reserve(mapRowId.size());
+                for (const auto& [_, data]: mapRowId)
+                    rows.push_back(data);
+                return rows;
+            }
+
+            for (const RowId rowId: setChanged) {
+                const auto& it = mapRowId.find(rowId);
+                if (it != mapRowId.end())
+                    rows.push_back(it->second);
+            }
+            return rows;
+        }
+
+        // Rows deleted since the last schema image
+        [[nodiscard]] std::vector<RowId> imageDropped() const {
+            std::vector<RowId> rowIds;
+            for (const RowId rowId: setChanged) {
+                if (mapRowId.find(rowId) == mapRowId.end())
+                    rowIds.push_back(rowId);
+            }
+            return rowIds;
+        }
+
+        void snapshot(bool delta) {
+            snapshotRows = image(delta);
+            if (delta)
+                snapshotDropped = imageDropped();
+            setChanged.clear();
+            snapshotActive = true;
+        }
+
+        void releaseSnapshot() {
+            for (Data* data: snapshotRetired)
+                delete data;
+            snapshotRetired.clear();
+            snapshotRows.clear();
+            snapshotDropped.clear();
+            snapshotActive = false;
+        }
+
+        // Row is about to be modified, the version referenced by the snapshot is kept unchanged
+        Data* detach(typename std::map<RowId, Data*>::iterator it) {
+            if (likely(!snapshotActive))
+                return it->second;
+
+            auto* data = new Data(*it->second);
+            if (setTouched.erase(it->second) > 0)
+                setTouched.insert(data);
+            snapshotRetired.push_back(it->second);
+            it->second = data;
+            return data;
+        }
+
         Data* forInsert(const Ctx* ctx, RowId rowId, FileOffset fileOffset) {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::SYSTEM)))
                 ctx->logTrace(Ctx::TRACE::SYSTEM, "forInsert " + Data::tableName() + " ('" + rowId.toString() + "')");
 
-            const auto& it = mapRowId.find(rowId);
+            auto it = mapRowId.find(rowId);
             Data* data;
             if (unlikely(it != mapRowId.end())) {
                 // Duplicate
@@ -129,11 +202,13 @@ namespace OpenLogReplicator {
                     throw RuntimeException(50022, "duplicate " + Data::tableName() + " (" + data->toString() + ") for insert at offset: " +
                                            fileOffset.toString());
                 dropKeys(data);
+                data = detach(it);
             } else {
                 data = new Data(rowId);
                 mapRowId.insert_or_assign(rowId, data);
             }
             setTouched.insert(data);
+            setChanged.insert(rowId);
             return data;
         }
 
@@ -165,8 +240,12 @@ namespace OpenLogReplicator {
 
             if (deleteTouched)
                 setTouched.erase(it->second);
+            setChanged.insert(rowId);
             dropKeys(it->second);
-            delete it->second;
+            if (snapshotActive)
+                snapshotRetired.push_back(it->second);
+            else
+                delete it->second;
             mapRowId.erase(it);
         }
 
@@ -18,6 +18,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <cctype>
+#include <cstring>
 #include <string>
 
 #include "Data.h"
@@ -187,6 +188,17 @@ namespace OpenLogReplicator {
         return result - UNIX_BC1970_01_01 - tz; // adjust to 1970 epoch, 718,798 days (year 0 does not exist)
     }
 
+    bool Data::epochDayToIso8601(time_t day, char* buffer) {
+        // YYYY-MM-DD of a day since 1970, BC dates use a different layout and are not formatted
+        if ((day * 24 * 60 * 60) + UNIX_AD1970_01_01 < 365 * 24 * 60 * 60)
+            return false;
+
+        char dateTime[22];
+        epochToIso8601(day * 24 * 60 * 60, dateTime, false, false);
+        memcpy(buffer, dateTime, 10);
+        return true;
+    }
+
     uint64_t Data::epochToIso8601(time_t timestamp, char* buffer, bool addT, bool addZ) {
         // (-)YYYY-MM-DD hh:mm:ss or (-)YYYY-MM-DDThh:mm:ssZ
 
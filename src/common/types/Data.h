@@ -79,6 +79,7 @@ namespace OpenLogReplicator {
         static std::string timezoneToString(int64_t tz);
         static time_t valuesToEpoch(int year, int month, int day, int hour, int minute, int second, int tz);
         static uint64_t epochToIso8601(time_t timestamp, char* buffer, bool addT, bool addZ);
+        static bool epochDayToIso8601(time_t day, char* buffer);
         static std::ostringstream& writeEscapeValue(std::ostringstream& ss, const std::string& str);
         static void checkName(const std::string& name);
     };
@@ -140,6 +140,10 @@ namespace OpenLogReplicator {
             return data[0];
         }
 
+        [[nodiscard]] uint64_t getData(uint index) const {
+            return data[index];
+        }
+
         [[nodiscard]] bool isSet64(uint64_t mask) const {
             return (data[0] & mask) != 0;
         }
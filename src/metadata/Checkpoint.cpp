@@ -226,6 +226,15 @@ namespace OpenLogReplicator {
                             element->condition = Ctx::getJsonFieldS(configFileName, Ctx::JSON_CONDITION_LENGTH, tableElementJson,
                                                                     "condition");
 
+                        if (tableElementJson.HasMember("columns")) {
+                            element->columns = Ctx::getJsonFieldS(configFileName, Ctx::JSON_KEY_LENGTH, tableElementJson, "columns");
+                            element->parseColumns(element->columns, separator);
+                        }
+
+                        if (tableElementJson.HasMember("column-filter"))
+                            DbFilter::parseJson(configFileName, Ctx::getJsonFieldA(configFileName, tableElementJson, "column-filter"),
+                                                element->filters);
+
                         if (tableElementJson.HasMember("tag")) {
                             element->tag = Ctx::getJsonFieldS(configFileName, Ctx::JSON_TAG_LENGTH, tableElementJson, "tag");
                             element->parseTag(element->tag, separator);
@@ -281,6 +290,7 @@ namespace OpenLogReplicator {
             while (!ctx->hardShutdown) {
                 metadata->writeCheckpoint(this, false);
                 metadata->deleteOldCheckpoints(this);
+                metadata->stateCompact();
 
                 if (ctx->hardShutdown)
                     break;
@@ -0,0 +1,146 @@
+/* Summary of transactions in LWNs for parsing redo log again
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+#include <cstring>
+
+#include "../common/Ctx.h"
+#include "LwnSummary.h"
+#include "Serializer.h"
+
+namespace OpenLogReplicator {
+    void LwnSummary::add(uint64_t* bloom, XidMap xidMap) {
+        // Two bits out of 256 for every transaction
+        const uint64_t hash = xidMap * 0x9E3779B97F4A7C15;
+        const uint64_t bit1 = hash >> 56;
+        const uint64_t bit2 = (hash >> 48) & 0xFF;
+        bloom[bit1 >> 6] |= 1ULL << (bit1 & 63);
+        bloom[bit2 >> 6] |= 1ULL << (bit2 & 63);
+    }
+
+    bool LwnSummary::contains(const uint64_t* bloom, XidMap xidMap) {
+        const uint64_t hash = xidMap * 0x9E3779B97F4A7C15;
+        const uint64_t bit1 = hash >> 56;
+        const uint64_t bit2 = (hash >> 48) & 0xFF;
+        return (bloom[bit1 >> 6] & (1ULL << (bit1 & 63))) != 0 && (bloom[bit2 >> 6] & (1ULL << (bit2 & 63))) != 0;
+    }
+
+    void LwnSummary::add(const Entry& entry) {
+        std::unique_lock const lck(mtx);
+        if (entries.size() >= ENTRIES_MAX)
+            entries.erase(entries.begin(), entries.begin() + static_cast<int64_t>(ENTRIES_MAX / 2));
+        entries.push_back(entry);
+    }
+
+    void LwnSummary::serialize(typeResetlogs resetlogs, Scn scn, const std::vector<XidMap>* openXids, std::ostringstream& ss) {
+        std::unique_lock const lck(mtx);
+        // Without the transactions open at the checkpoint the file only holds the LWNs
+        const bool open = openXids != nullptr;
+        const uint64_t openCount = open ? openXids->size() : 0;
+
+        std::string out(HEADER_SIZE + (openCount * sizeof(XidMap)) + (entries.size() * ENTRY_SIZE), '\0');
+        auto* data = reinterpret_cast<uint8_t*>(out.data());
+        memcpy(data, Serializer::BINARY_MAGIC, sizeof(Serializer::BINARY_MAGIC));
+        Ctx::write32Little(data + 8, VERSION);
+        Ctx::write32Little(data + 12, resetlogs);
+        Ctx::write64Little(data + 16, open ? scn.getData() : Scn::none().getData());
+        Ctx::write64Little(data + 24, openCount);
+        Ctx::write64Little(data + 32, entries.size());
+
+        uint8_t* pos = data + HEADER_SIZE;
+        for (uint64_t i = 0; i < openCount; ++i) {
+            Ctx::write64Little(pos, (*openXids)[i]);
+            pos += sizeof(XidMap);
+        }
+        for (const Entry& e: entries) {
+            Ctx::write64Little(pos, e.scn.getData());
+            Ctx::write32Little(pos + 8, e.sequence.getData());
+            Ctx::write32Little(pos + 12, e.block);
+            for (uint64_t j = 0; j < BLOOM_WORDS; ++j)
+                Ctx::write64Little(pos + 16 + (j * 8), e.bloom[j]);
+            pos += ENTRY_SIZE;
+        }
+        entries.clear();
+
+        ss.write(out.data(), static_cast<std::streamsize>(out.length()));
+    }
+
+    bool LwnSummary::deserialize(typeResetlogs resetlogs, Scn scn, std::string_view ss) {
+        if (ss.length() < HEADER_SIZE || memcmp(ss.data(), Serializer::BINARY_MAGIC, sizeof(Serializer::BINARY_MAGIC)) != 0)
+            return false;
+
+        const auto* data = reinterpret_cast<const uint8_t*>(ss.data());
+        if (Ctx::read32Little(data + 8) != VERSION)
+            return false;
+        const uint64_t openCount = Ctx::read64Little(data + 24);
+        const uint64_t count = Ctx::read64Little(data + 32);
+        if (openCount > (ss.length() - HEADER_SIZE) / sizeof(XidMap) ||
+            count > (ss.length() - HEADER_SIZE - (openCount * sizeof(XidMap))) / ENTRY_SIZE)
+            return false;
+
+        // Summaries of another incarnation never match
+        if (Ctx::read32Little(data + 12) != resetlogs)
+            return true;
+
+        const uint8_t* pos = data + HEADER_SIZE;
+        if (Scn(Ctx::read64Little(data + 16)) == scn) {
+            skipXids.clear();
+            for (uint64_t i = 0; i < openCount; ++i)
+                skipXids.insert(Ctx::read64Little(pos + (i * sizeof(XidMap))));
+            skipScn = scn;
+        }
+        pos += openCount * sizeof(XidMap);
+
+        skipEntries.reserve(skipEntries.size() + count);
+        for (uint64_t i = 0; i < count; ++i) {
+            Entry e{Scn(Ctx::read64Little(pos)), Seq(Ctx::read32Little(pos + 8)), Ctx::read32Little(pos + 12), {}};
+            for (uint64_t j = 0; j < BLOOM_WORDS; ++j)
+                e.bloom[j] = Ctx::read64Little(pos + 16 + (j * 8));
+            skipEntries.push_back(e);
+            pos += ENTRY_SIZE;
+        }
+        return true;
+    }
+
+    void LwnSummary::activate() {
+        if (skipScn == Scn::none() || skipEntries.empty()) {
+            release();
+            return;
+        }
+        std::sort(skipEntries.begin(), skipEntries.end());
+    }
+
+    void LwnSummary::release() {
+        skipScn = Scn::none();
+        std::vector<Entry>().swap(skipEntries);
+        std::unordered_set<XidMap>().swap(skipXids);
+    }
+
+    bool LwnSummary::skip(Scn scn, Seq sequence, typeBlk block) const {
+        const Entry key{scn, sequence, block, {}};
+        const auto it = std::lower_bound(skipEntries.cbegin(), skipEntries.cend(), key);
+        if (it == skipEntries.cend() || key < *it)
+            return false;
+
+        for (const XidMap xidMap: skipXids)
+            if (contains(it->bloom, xidMap))
+                return false;
+        return true;
+    }
+}
@@ -0,0 +1,101 @@
+/* Header for LwnSummary class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef LWN_SUMMARY_H_
+#define LWN_SUMMARY_H_
+
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "../common/types/Scn.h"
+#include "../common/types/Seq.h"
+#include "../common/types/Types.h"
+
+namespace OpenLogReplicator {
+    // Bloom filter of the transactions changed in every LWN, recorded by the parser and stored with the checkpoints together with the list of
+    // transactions open at the checkpoint. After a restart the redo log is parsed again from the begin of the oldest open transaction, LWNs up
+    // to the checkpoint with no change of an open transaction are read and checked but not analyzed.
+    // File layout, all numbers are little endian: magic (8), version (4), resetlogs (4), checkpoint scn (8), number of open transactions (8),
+    // number of LWNs (8), then the open transactions (8 each) and for every LWN: scn (8), sequence (4), block (4), bloom filter (32).
+    class LwnSummary final {
+    public:
+        static constexpr uint64_t FILE_MAX_SIZE{33554432};
+        static constexpr uint64_t BLOOM_WORDS{4};
+
+        class Entry final {
+        public:
+            Scn scn;
+            Seq sequence;
+            typeBlk block;
+            uint64_t bloom[BLOOM_WORDS];
+
+            bool operator<(const Entry& other) const {
+                if (scn != other.scn)
+                    return scn < other.scn;
+                if (sequence != other.sequence)
+                    return sequence < other.sequence;
+                return block < other.block;
+            }
+        };
+
+    protected:
+        static constexpr uint32_t VERSION{1};
+        static constexpr uint64_t HEADER_SIZE{40};
+        static constexpr uint64_t ENTRY_SIZE{48};
+        // The older half of the entries is dropped when full, the LWNs are then analyzed
+        static constexpr uint64_t ENTRIES_MAX{262144};
+
+        // Recorded by the parser since the last write
+        std::mutex mtx;
+        std::vector<Entry> entries;
+
+        // Loaded at start, used by the parser thread only
+        std::vector<Entry> skipEntries;
+        std::unordered_set<XidMap> skipXids;
+        Scn skipScn{Scn::none()};
+
+    public:
+        static void add(uint64_t* bloom, XidMap xidMap);
+        [[nodiscard]] static bool contains(const uint64_t* bloom, XidMap xidMap);
+
+        void add(const Entry& entry);
+        void serialize(typeResetlogs resetlogs, Scn scn, const std::vector<XidMap>* openXids, std::ostringstream& ss);
+        [[nodiscard]] bool deserialize(typeResetlogs resetlogs, Scn scn, std::string_view ss);
+        void activate();
+        void release();
+        [[nodiscard]] bool skip(Scn scn, Seq sequence, typeBlk block) const;
+
+        [[nodiscard]] bool isActive() const {
+            return skipScn != Scn::none();
+        }
+
+        [[nodiscard]] Scn getScn() const {
+            return skipScn;
+        }
+
+        [[nodiscard]] const std::unordered_set<XidMap>& getOpenXids() const {
+            return skipXids;
+        }
+    };
+}
+
+#endif
@@ -35,8 +35,10 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
  * production may lead to silent data corruption.
  */
 
+#include <chrono>
 #include <vector>
 
+#include "../common/Clock.h"
 #include "../common/Ctx.h"
 #include "../common/DbIncarnation.h"
 #include "../common/DbTable.h"
@@ -58,11 +60,14 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../locales/CharacterSet.h"
 #include "../locales/Locales.h"
 #include "../state/StateDisk.h"
+#include "LwnSummary.h"
+#include "RedoIndex.h"
 #include "RedoLog.h"
 #include "Metadata.h"
 #include "Schema.h"
 #include "SchemaElement.h"
-#include "Serializer.h"
+#include "SerializerBinary.h"
+#include "SerializerJson.h"
 
 namespace OpenLogReplicator {
     Metadata::Metadata(Ctx* newCtx, Locales* newLocales, std::string newDatabase, Scn newStartScn,
@@ -74,7 +79,9 @@ namespace OpenLogReplicator {
             startScn(newStartScn),
             startSequence(newStartSequence),
             startTime(std::move(newStartTime)),
-            startTimeRel(newStartTimeRel) {}
+            startTimeRel(newStartTimeRel),
+            redoIndex(new RedoIndex()),
+            lwnSummary(new LwnSummary()) {}
 
     Metadata::~Metadata() {
         if (schema != nullptr) {
@@ -87,6 +94,16 @@ namespace OpenLogReplicator {
             serializer = nullptr;
         }
 
+        if (redoIndex != nullptr) {
+            delete redoIndex;
+            redoIndex = nullptr;
+        }
+
+        if (lwnSummary != nullptr) {
+            delete lwnSummary;
+            lwnSummary = nullptr;
+        }
+
         if (state != nullptr) {
             delete state;
             state = nullptr;
@@ -194,6 +211,15 @@ namespace OpenLogReplicator {
         return false;
     }
 
+    bool Metadata::stateMap(const std::string& name, uint64_t maxSize, StateMap& in) const {
+        try {
+            return state->map(name, maxSize, in);
+        } catch (RuntimeException& ex) {
+            ctx->error(ex.code, ex.msg);
+        }
+        return false;
+    }
+
     bool Metadata::stateWrite(const std::string& name, Scn scn, const std::ostringstream& out) const {
         try {
             state->write(name, scn, out);
@@ -214,6 +240,14 @@ namespace OpenLogReplicator {
         return false;
     }
 
+    void Metadata::stateCompact() const {
+        try {
+            state->compact();
+        } catch (RuntimeException& ex) {
+            ctx->error(ex.code, ex.msg);
+        }
+    }
+
     SchemaElement* Metadata::addElement(const std::string& owner, const std::string& table, DbTable::OPTIONS options1, DbTable::OPTIONS options2) {
         return addElement(owner, table, static_cast<DbTable::OPTIONS>(static_cast<uint>(options1) | static_cast<uint>(options2)));
     }
@@ -285,8 +319,8 @@ namespace OpenLogReplicator {
                         std::to_string(static_cast<uint>(element->options)));
 
             schema->buildMaps(element->owner, element->table, element->keyList, element->key, element->tagType, element->tagList, element->tag,
-                              element->condition, element->options, tablesUpdated, suppLogDbPrimary, suppLogDbAll, defaultCharacterMapId,
-                              defaultCharacterNcharMapId);
+                              element->condition, element->filters, element->columnList, element->options, tablesUpdated, suppLogDbPrimary,
+                              suppLogDbAll, defaultCharacterMapId, defaultCharacterNcharMapId);
         }
     }
 
@@ -320,6 +354,46 @@ namespace OpenLogReplicator {
         t->contextSet(Thread::CONTEXT::CPU);
     }
 
+    void Metadata::waitForWriters(Thread* t, Scn scn, typeIdx idx) {
+        bool replicate = false;
+        {
+            t->contextSet(Thread::CONTEXT::CHKPT, Thread::REASON::CHKPT);
+            std::unique_lock lck(mtxCheckpoint);
+
+            if (scn != Scn::none() && (writersScn == Scn::none() || scn < writersScn || (scn == writersScn && idx < writersIdx))) {
+                writersScn = scn;
+                writersIdx = idx;
+            }
+
+            if (++writersStarted >= writers) {
+                // Started earlier - continue work and ignore default startup parameters
+                if (writersScn != Scn::none()) {
+                    clientScn = writersScn;
+                    clientIdx = writersIdx;
+                    startScn = writersScn;
+                    startSequence = Seq::none();
+                    startTime.clear();
+                    startTimeRel = 0;
+                    replicate = true;
+                }
+                condWriters.notify_all();
+            } else {
+                if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
+                    ctx->logTrace(Ctx::TRACE::SLEEP, "Metadata:waitForWriters");
+                t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::METADATA_WAIT_WRITERS);
+                while (writersStarted < writers && !ctx->hardShutdown)
+                    condWriters.wait_for(lck, std::chrono::milliseconds(100));
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+
+        if (replicate) {
+            if (writers > 1)
+                ctx->info(0, "starting from the oldest writer checkpoint, scn: " + writersScn.toString() + ", idx: " + std::to_string(writersIdx));
+            setStatusReplicating(t);
+        }
+    }
+
     void Metadata::setStatusReady(Thread* t) {
         {
             t->contextSet(Thread::CONTEXT::CHKPT, Thread::REASON::CHKPT);
@@ -388,7 +462,8 @@ namespace OpenLogReplicator {
     }
 
     void Metadata::checkpoint(Thread* t, Scn newCheckpointScn, Time newCheckpointTime, Seq newCheckpointSequence, FileOffset newCheckpointFileOffset,
-                              uint64_t newCheckpointBytes, Seq newMinSequence, FileOffset newMinFileOffset, Xid newMinXid) {
+                              uint64_t newCheckpointBytes, Seq newMinSequence, FileOffset newMinFileOffset, Xid newMinXid,
+                              uint16_t newCheckpointThread, std::vector<XidMap>* newCheckpointXids) {
         {
             t->contextSet(Thread::CONTEXT::CHKPT, Thread::REASON::CHKPT);
             std::unique_lock const lck(mtxCheckpoint);
@@ -401,16 +476,36 @@ namespace OpenLogReplicator {
             minSequence = newMinSequence;
             minFileOffset = newMinFileOffset;
             minXid = newMinXid;
+            if (newCheckpointXids != nullptr) {
+                checkpointXids.swap(*newCheckpointXids);
+                checkpointXidsScn = newCheckpointScn;
+            }
+
+            if (newCheckpointThread != 0) {
+                RedoThreadPosition& position = redoThreadPositions[newCheckpointThread];
+                if (newMinSequence != Seq::none()) {
+                    position.sequence = newMinSequence;
+                    position.fileOffset = newMinFileOffset;
+                } else {
+                    position.sequence = newCheckpointSequence;
+                    position.fileOffset = newCheckpointFileOffset;
+                }
+            }
         }
         t->contextSet(Thread::CONTEXT::CPU);
     }
 
     void Metadata::writeCheckpoint(Thread* t, bool force) {
         std::ostringstream ss;
+        bool storeSchema = true;
+        bool storeDelta = false;
+        std::vector<XidMap> summaryXids;
+        bool summaryOpen = false;
 
         {
             t->contextSet(Thread::CONTEXT::CHKPT, Thread::REASON::CHKPT);
-            std::unique_lock const lck(mtxCheckpoint);
+            std::unique_lock lck(mtxCheckpoint);
+            checkpointLockTime = ctx->clock->getTimeUt();
             if (!allowedCheckpoints)
                 return;
 
@@ -423,18 +518,38 @@ namespace OpenLogReplicator {
                 (checkpointBytes - lastCheckpointBytes) / 1024 / 1024 < ctx->checkpointIntervalMb)
                 return;
 
-            // Schema did not change
-            bool storeSchema = true;
-            if (schema->refScn != Scn::none() && schema->refScn >= schema->scn) {
-                if (schemaInterval < ctx->schemaForceInterval) {
-                    storeSchema = false;
-                    ++schemaInterval;
-                } else
+            {
+                std::unique_lock const lckSchema(mtxSchema);
+
+                // The schema already contains a transaction committed after the checkpoint position, retry with the next checkpoint
+                if (schema->scn != Scn::none() && schema->scn > checkpointScn && !force)
+                    return;
+
+                // Schema did not change
+                if (schema->refScn != Scn::none() && schema->refScn >= schema->scn) {
+                    if (schemaInterval < ctx->schemaForceInterval) {
+                        storeSchema = false;
+                        ++schemaInterval;
+                    } else
+                        schemaInterval = 0;
+                } else {
                     schemaInterval = 0;
-            } else
-                schemaInterval = 0;
 
-            serializer->serialize(this, ss, storeSchema);
+                    // Only rows changed since the previous schema image, a full image is written after every schema-delta-max deltas
+                    if (schema->refScn != Scn::none() && schemaDeltas < ctx->schemaDeltaMax && schema->deltaAllowed())
+                        storeDelta = true;
+                }
+
+                if (storeSchema) {
+                    if (storeDelta)
+                        ++schemaDeltas;
+                    else
+                        schemaDeltas = 0;
+                }
+
+                // Rows modified by the parser from now on are copied, the snapshot stays consistent at the schema scn
+                schema->snapshot(storeSchema, storeDelta, checkpointScn);
+            }
 
             lastCheckpointScn = checkpointScn;
             lastSequence = sequence;
@@ -443,10 +558,22 @@ namespace OpenLogReplicator {
             lastCheckpointBytes = checkpointBytes;
             ++checkpoints;
             checkpointScnList.insert(checkpointScn);
-            checkpointSchemaMap.insert_or_assign(checkpointScn, storeSchema);
+            checkpointSchemaMap.insert_or_assign(checkpointScn, storeSchema && !storeDelta);
+            if (checkpointXidsScn == checkpointScn) {
+                summaryXids = checkpointXids;
+                summaryOpen = true;
+            }
+
+            // Releases the lock after the checkpoint position is written
+            serializer->serialize(this, ss, storeSchema, storeDelta, &lck);
         }
         t->contextSet(Thread::CONTEXT::CPU);
 
+        {
+            std::unique_lock const lckSchema(mtxSchema);
+            schema->releaseSnapshot();
+        }
+
         const std::string checkpointName = database + "-chkpt-" + lastCheckpointScn.toString();
 
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
@@ -454,8 +581,39 @@ namespace OpenLogReplicator {
                           std::to_string(lastCheckpointTime.getVal()) + " seq: " + lastSequence.toString() + " offset: " +
                           lastCheckpointFileOffset.toString() + " name: " + checkpointName);
 
-        if (!stateWrite(checkpointName, lastCheckpointScn, ss))
+        if (!stateWrite(checkpointName, lastCheckpointScn, ss)) {
             ctx->warning(60018, "file: " + checkpointName + " - couldn't write checkpoint");
+
+            // Changes of the lost schema image are not tracked anymore, the next image is a full one
+            if (storeSchema) {
+                std::unique_lock const lckSchema(mtxSchema);
+                schema->refScn = Scn::none();
+            }
+        }
+
+        std::ostringstream ssIndex;
+        if (redoIndex->serialize(ssIndex) && !stateWrite(database + "-index", lastCheckpointScn, ssIndex))
+            ctx->warning(60018, "file: " + database + "-index - couldn't write checkpoint");
+
+        if (ctx->isFlagSet(Ctx::REDO_FLAGS::LWN_SUMMARY)) {
+            const std::string summaryName = database + "-lwn-" + lastCheckpointScn.toString();
+            std::ostringstream ssSummary;
+            lwnSummary->serialize(resetlogs, lastCheckpointScn, summaryOpen ? &summaryXids : nullptr, ssSummary);
+            if (stateWrite(summaryName, lastCheckpointScn, ssSummary)) {
+                std::unique_lock const lck(mtxCheckpoint);
+                lwnSummaryScnList.insert(lastCheckpointScn);
+            } else
+                ctx->warning(60018, "file: " + summaryName + " - couldn't write checkpoint");
+        }
+    }
+
+    void Metadata::releaseCheckpointLock(std::unique_lock<std::mutex>* lck) const {
+        if (lck == nullptr || !lck->owns_lock())
+            return;
+
+        lck->unlock();
+        if (ctx->metrics != nullptr)
+            ctx->metrics->emitCheckpointLockUs(ctx->clock->getTimeUt() - checkpointLockTime);
     }
 
     void Metadata::readCheckpoints() {
@@ -465,7 +623,13 @@ namespace OpenLogReplicator {
         std::set<std::string> namesList;
         state->list(namesList);
 
+        const std::string summaryPrefix(database + "-lwn-");
         for (const std::string& name: namesList) {
+            if (name.length() > summaryPrefix.length() && name.substr(0, summaryPrefix.length()) == summaryPrefix) {
+                lwnSummaryScnList.insert(Scn(strtoull(name.c_str() + summaryPrefix.length(), nullptr, 10)));
+                continue;
+            }
+
             const std::string prefix(database + "-chkpt-");
             if (name.length() < prefix.length() || name.substr(0, prefix.length()) != prefix)
                 continue;
@@ -482,10 +646,20 @@ namespace OpenLogReplicator {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
                 ctx->logTrace(Ctx::TRACE::CHECKPOINT, "found: " + name + " scn: " + scn.toString());
 
+            if (serializer->format == Serializer::FORMAT::BINARY)
+                convertCheckpoint(name);
+
             checkpointScnList.insert(scn);
             checkpointSchemaMap.insert_or_assign(scn, true);
         }
 
+        const std::string indexName(database + "-index");
+        if (namesList.find(indexName) != namesList.end()) {
+            std::string index;
+            if (stateRead(indexName, RedoIndex::FILE_MAX_SIZE, index) && !redoIndex->deserialize(index))
+                ctx->warning(60043, "file: " + indexName + " - invalid redo index, ignoring");
+        }
+
         if (startScn != Scn::none())
             firstDataScn = startScn;
         else
@@ -495,31 +669,71 @@ namespace OpenLogReplicator {
             ctx->logTrace(Ctx::TRACE::CHECKPOINT, "scn: " + firstDataScn.toString());
 
         if (firstDataScn != Scn::none() && firstDataScn.getData() != 0) {
-            auto it = checkpointScnList.cend();
+            // With the start SCN in the redo index the schema comes from the last checkpoint before the indexed LWN and parsing starts
+            // from the indexed position when it is later than the checkpoint position
+            RedoIndex::Entry entry;
+            const bool indexed = redoIndex->findScn(redoIndex->getResetlogs(), firstDataScn, Seq::none(), entry);
+            if (indexed)
+                readCheckpointBefore(entry.scn, entry.sequence, entry.fileOffset);
+            if (sequence == Seq::none() || sequence == Seq::zero())
+                readCheckpointBefore(firstDataScn, Seq::none(), FileOffset());
+        }
+    }
 
-            while (it != checkpointScnList.cbegin()) {
-                --it;
-                if (*it <= firstDataScn && (sequence == Seq::none() || sequence == Seq::zero()))
-                    readCheckpoint(*it);
-            }
+    void Metadata::readCheckpointBefore(Scn scn, Seq indexSequence, FileOffset indexFileOffset) {
+        auto it = checkpointScnList.cend();
+
+        while (it != checkpointScnList.cbegin()) {
+            --it;
+            if (*it > scn || (sequence != Seq::none() && sequence != Seq::zero()))
+                continue;
+
+            readCheckpoint(*it);
+            if (sequence == Seq::none() || sequence == Seq::zero())
+                continue;
+
+            if (indexSequence != Seq::none() && redoThreadPositions.empty() && resetlogs == redoIndex->getResetlogs() &&
+                    (indexSequence > sequence || (indexSequence == sequence && indexFileOffset > fileOffset))) {
+                ctx->info(0, "redo index position for scn: " + firstDataScn.toString() + " is seq: " + indexSequence.toString() + ", offset: " +
+                          indexFileOffset.toString() + ", indexed scn: " + scn.toString() + ", schema from checkpoint scn: " + it->toString());
+                setSeqFileOffset(indexSequence, indexFileOffset);
+            } else if (ctx->isFlagSet(Ctx::REDO_FLAGS::LWN_SUMMARY) && redoThreadPositions.empty())
+                readLwnSummaries(*it);
         }
     }
 
+    void Metadata::readLwnSummaries(Scn scn) {
+        for (const Scn summaryScn: lwnSummaryScnList) {
+            if (summaryScn > scn)
+                break;
+
+            const std::string summaryName(database + "-lwn-" + summaryScn.toString());
+            std::string summary;
+            if (stateRead(summaryName, LwnSummary::FILE_MAX_SIZE, summary) && !lwnSummary->deserialize(resetlogs, scn, summary))
+                ctx->warning(60044, "file: " + summaryName + " - invalid LWN summary, ignoring");
+        }
+
+        lwnSummary->activate();
+        if (lwnSummary->isActive())
+            ctx->info(0, "LWN summary loaded, redo log up to scn: " + scn.toString() + " is analyzed only for " +
+                      std::to_string(lwnSummary->getOpenXids().size()) + " open transactions");
+    }
+
     void Metadata::readCheckpoint(Scn scn) {
         std::vector<std::string> msgs;
         std::unordered_map<typeObj, std::string> tablesUpdated;
         ctx->info(0, "reading metadata for " + database + " for scn: " + scn.toString());
-        std::string ss;
+        StateMap ss;
 
         const std::string name1(database + "-chkpt-" + scn.toString());
-        if (!stateRead(name1, CHECKPOINT_SCHEMA_FILE_MAX_SIZE, ss)) {
+        if (!stateMap(name1, CHECKPOINT_SCHEMA_FILE_MAX_SIZE, ss)) {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
                 ctx->logTrace(Ctx::TRACE::CHECKPOINT, "no checkpoint file found, setting unknown sequence");
 
             sequence = Seq::none();
             return;
         }
-        if (!serializer->deserialize(this, ss, name1, msgs, tablesUpdated, true, true)) {
+        if (!deserialize(ss.data(), name1, msgs, tablesUpdated, true, true)) {
             for (const auto& [_, tableName]: tablesUpdated) {
                 ctx->info(0, tableName);
             }
@@ -533,21 +747,26 @@ namespace OpenLogReplicator {
         }
         tablesUpdated.clear();
 
-        // Schema missing
-        if (schema->scn == Scn::none()) {
-            if (schema->refScn == Scn::none()) {
+        // Schema missing or stored as a delta, follow the references back to the last full schema image
+        std::vector<Scn> deltaScns;
+        if (schema->deltaPending)
+            deltaScns.push_back(scn);
+        Scn prevScn = scn;
+        while (schema->scn == Scn::none()) {
+            if (schema->refScn == Scn::none() || schema->refScn >= prevScn) {
                 ctx->warning(60019, "file: " + name1 + " - load checkpoint failed, reference SCN missing");
                 return;
             }
+            prevScn = schema->refScn;
 
-            ss.clear();
-            const std::string name2(database + "-chkpt-" + schema->refScn.toString());
-            ctx->info(0, "reading schema for " + database + " for scn: " + schema->refScn.toString());
+            ss.release();
+            const std::string name2(database + "-chkpt-" + prevScn.toString());
+            ctx->info(0, "reading schema for " + database + " for scn: " + prevScn.toString());
 
-            if (!stateRead(name2, CHECKPOINT_SCHEMA_FILE_MAX_SIZE, ss))
+            if (!stateMap(name2, CHECKPOINT_SCHEMA_FILE_MAX_SIZE, ss))
                 return;
 
-            if (!serializer->deserialize(this, ss, name2, msgs, tablesUpdated, false, true)) {
+            if (!deserialize(ss.data(), name2, msgs, tablesUpdated, false, true)) {
                 for (const auto& msg: msgs) {
                     ctx->info(0, msg);
                 }
@@ -560,12 +779,93 @@ namespace OpenLogReplicator {
             for (const auto& [_, tableName]: tablesUpdated) {
                 ctx->info(0, "- found: " + tableName);
             }
+            msgs.clear();
+            tablesUpdated.clear();
+
+            if (schema->deltaPending)
+                deltaScns.push_back(prevScn);
+        }
+
+        // Apply the delta images, oldest first
+        while (!deltaScns.empty()) {
+            ss.release();
+            const std::string name3(database + "-chkpt-" + deltaScns.back().toString());
+            deltaScns.pop_back();
+            ctx->info(0, "reading schema delta for " + database + " from: " + name3);
+
+            if (!stateMap(name3, CHECKPOINT_SCHEMA_FILE_MAX_SIZE, ss) || !deserialize(ss.data(), name3, msgs, tablesUpdated, false, true) ||
+                schema->deltaPending) {
+                ctx->warning(60041, "file: " + name3 + " - load checkpoint failed, schema delta can't be applied");
+                schema->scn = Scn::none();
+                return;
+            }
+
+            for (const auto& msg: msgs) {
+                ctx->info(0, msg);
+            }
+            for (const auto& [_, tableName]: tablesUpdated) {
+                ctx->info(0, "- found: " + tableName);
+            }
+            msgs.clear();
+            tablesUpdated.clear();
         }
 
         if (schema->scn != Scn::none())
             firstSchemaScn = schema->scn;
     }
 
+    bool Metadata::deserialize(std::string_view ss, const std::string& name, std::vector<std::string>& msgs,
+                               std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool loadSchema) {
+        // Files of both formats are accepted, regardless of the format used for writing
+        const Serializer::FORMAT format = Serializer::detect(ss);
+        if (format == serializer->format)
+            return serializer->deserialize(this, ss, name, msgs, tablesUpdated, loadMetadata, loadSchema);
+
+        if (format == Serializer::FORMAT::BINARY) {
+            SerializerBinary serializerBinary;
+            return serializerBinary.deserialize(this, ss, name, msgs, tablesUpdated, loadMetadata, loadSchema);
+        }
+        SerializerJson serializerJson;
+        return serializerJson.deserialize(this, ss, name, msgs, tablesUpdated, loadMetadata, loadSchema);
+    }
+
+    void Metadata::convertCheckpoint(const std::string& name) {
+        std::vector<std::string> msgs;
+        std::unordered_map<typeObj, std::string> tablesUpdated;
+        StateMap in;
+        if (!stateMap(name, CHECKPOINT_SCHEMA_FILE_MAX_SIZE, in) || Serializer::detect(in.data()) == serializer->format)
+            return;
+
+        // The file is loaded to a separate copy, this metadata is not initialized yet
+        Metadata converted(ctx, locales, database, startScn, startSequence, startTime, startTimeRel);
+        converted.users = users;
+        SerializerJson serializerJson;
+        if (!serializerJson.deserialize(&converted, in.data(), name, msgs, tablesUpdated, true, true)) {
+            ctx->warning(60040, "file: " + name + " - checkpoint conversion failed, leaving the file unchanged");
+            return;
+        }
+        in.release();
+
+        // Delta schema images depend on the previous images and are read in both formats
+        if (converted.schema->deltaPending)
+            return;
+
+        // The restart position is stored as the checkpoint position
+        converted.checkpointSequence = converted.sequence;
+        converted.checkpointFileOffset = converted.fileOffset;
+
+        std::ostringstream ss;
+        const bool storeSchema = converted.schema->scn != Scn::none();
+        converted.schema->snapshot(storeSchema, false, converted.checkpointScn);
+        serializer->serialize(&converted, ss, storeSchema, false, nullptr);
+        converted.schema->releaseSnapshot();
+        if (!stateWrite(name, converted.checkpointScn, ss)) {
+            ctx->warning(60040, "file: " + name + " - checkpoint conversion failed, leaving the file unchanged");
+            return;
+        }
+        ctx->info(0, "converted checkpoint file: " + name);
+    }
+
     void Metadata::deleteOldCheckpoints(Thread* t) {
         std::set<Scn> scnToDrop;
 
@@ -612,6 +912,8 @@ namespace OpenLogReplicator {
                 break;
         }
 
+        // LWN summaries are needed only as long as the checkpoints they were written with
+        std::vector<Scn> summaryScnToDrop;
         {
             std::unique_lock const lck(mtxCheckpoint);
 
@@ -619,6 +921,18 @@ namespace OpenLogReplicator {
                 checkpointScnList.erase(scn);
                 checkpointSchemaMap.erase(scn);
             }
+
+            if (!scnToDrop.empty()) {
+                for (auto it = lwnSummaryScnList.begin(); it != lwnSummaryScnList.end() && *it <= *scnToDrop.rbegin();) {
+                    summaryScnToDrop.push_back(*it);
+                    it = lwnSummaryScnList.erase(it);
+                }
+            }
+        }
+
+        for (auto scn: summaryScnToDrop) {
+            if (!stateDrop(database + "-lwn-" + scn.toString()))
+                break;
         }
         t->contextSet(Thread::CONTEXT::CPU);
     }
@@ -639,7 +953,7 @@ namespace OpenLogReplicator {
             return;
         }
 
-        if (!serializer->deserialize(this, ss, name, msgs, tablesUpdated, false, true)) {
+        if (!deserialize(ss, name, msgs, tablesUpdated, false, true)) {
             for (const auto& msg: msgs) {
                 ctx->info(0, msg);
             }
@@ -23,10 +23,12 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <map>
 #include <mutex>
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 #include <set>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -41,18 +43,29 @@ namespace OpenLogReplicator {
     class Ctx;
     class DbIncarnation;
     class Locales;
+    class LwnSummary;
+    class RedoIndex;
     class RedoLog;
     class Schema;
     class SchemaElement;
     class Serializer;
     class State;
     class StateDisk;
+    class StateMap;
     class Thread;
 
+    // Position to restart parsing of one redo thread from (reader: redo-threads)
+    class RedoThreadPosition final {
+    public:
+        Seq sequence{Seq::none()};
+        FileOffset fileOffset;
+    };
+
     class Metadata final {
     protected:
         std::condition_variable condReplicator;
         std::condition_variable condWriter;
+        std::condition_variable condWriters;
         static constexpr uint64_t CHECKPOINT_SCHEMA_FILE_MAX_SIZE = 2147483648;
 
     public:
@@ -118,6 +131,11 @@ namespace OpenLogReplicator {
         Scn nextScn{Scn::none()};
         Scn clientScn{Scn::none()};
         typeIdx clientIdx{0};
+        // All writers of the source read own checkpoints before replication starts from the oldest one
+        uint64_t writers{1};
+        uint64_t writersStarted{0};
+        Scn writersScn{Scn::none()};
+        typeIdx writersIdx{0};
         uint64_t checkpoints{0};
         Scn checkpointScn{Scn::none()};
         Scn lastCheckpointScn{Scn::none()};
@@ -131,9 +149,18 @@ namespace OpenLogReplicator {
         Seq minSequence{Seq::none()};
         FileOffset minFileOffset;
         Xid minXid;
+        std::map<uint16_t, RedoThreadPosition> redoThreadPositions;
+        RedoIndex* redoIndex;
+        LwnSummary* lwnSummary;
+        // Transactions open at checkpointScn, when known
+        std::vector<XidMap> checkpointXids;
+        Scn checkpointXidsScn{Scn::none()};
         uint64_t schemaInterval{0};
+        uint64_t schemaDeltas{0};
+        time_ut checkpointLockTime{0};
         std::set<Scn> checkpointScnList;
         std::unordered_map<Scn, bool> checkpointSchemaMap;
+        std::set<Scn> lwnSummaryScnList;
 
         std::vector<SchemaElement*> newSchemaElements;
 
@@ -155,8 +182,10 @@ namespace OpenLogReplicator {
         void setNextSequence();
         [[nodiscard]] bool stateRead(const std::string& name, uint64_t maxSize, std::string& in) const;
         [[nodiscard]] bool stateDiskRead(const std::string& name, uint64_t maxSize, std::string& in) const;
+        [[nodiscard]] bool stateMap(const std::string& name, uint64_t maxSize, StateMap& in) const;
         [[nodiscard]] bool stateWrite(const std::string& name, Scn scn, const std::ostringstream& out) const;
         [[nodiscard]] bool stateDrop(const std::string& name) const;
+        void stateCompact() const;
         SchemaElement* addElement(const std::string& owner, const std::string& table, DbTable::OPTIONS options1, DbTable::OPTIONS options2);
         SchemaElement* addElement(const std::string& owner, const std::string& table, DbTable::OPTIONS options);
         void resetElements();
@@ -165,15 +194,23 @@ namespace OpenLogReplicator {
 
         void waitForWriter(Thread* t);
         void waitForReplicator(Thread* t);
+        void waitForWriters(Thread* t, Scn scn, typeIdx idx);
         void setStatusReady(Thread* t);
         void setStatusStarting(Thread* t);
         void setStatusReplicating(Thread* t);
         void wakeUp(Thread* t);
         void checkpoint(Thread* t, Scn newCheckpointScn, Time newCheckpointTime, Seq newCheckpointSequence, FileOffset newCheckpointFileOffset,
-                        uint64_t newCheckpointBytes, Seq newMinSequence, FileOffset newMinFileOffset, Xid newMinXid);
+                        uint64_t newCheckpointBytes, Seq newMinSequence, FileOffset newMinFileOffset, Xid newMinXid,
+                        uint16_t newCheckpointThread = 0, std::vector<XidMap>* newCheckpointXids = nullptr);
         void writeCheckpoint(Thread* t, bool force);
+        void releaseCheckpointLock(std::unique_lock<std::mutex>* lck) const;
         void readCheckpoints();
+        void readCheckpointBefore(Scn scn, Seq indexSequence, FileOffset indexFileOffset);
         void readCheckpoint(Scn scn);
+        void readLwnSummaries(Scn scn);
+        [[nodiscard]] bool deserialize(std::string_view ss, const std::string& name, std::vector<std::string>& msgs,
+                                       std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool loadSchema);
+        void convertCheckpoint(const std::string& name);
         void deleteOldCheckpoints(Thread* t);
         void loadAdaptiveSchema();
         void allowCheckpoints();
@@ -0,0 +1,166 @@
+/* Sparse index of redo log positions
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <algorithm>
+#include <cstring>
+
+#include "../common/Ctx.h"
+#include "RedoIndex.h"
+#include "Serializer.h"
+
+namespace OpenLogReplicator {
+    bool RedoIndex::isContinuous(uint64_t i) const {
+        // The position is used only when the next entry proves that no redo log file is missing from the index after it
+        if (i + 1 >= entries.size())
+            return false;
+        Seq nextSequence = entries[i].sequence;
+        ++nextSequence;
+        return entries[i + 1].sequence <= nextSequence;
+    }
+
+    bool RedoIndex::sample(Seq sequence, uint64_t newBytes) {
+        bytes += newBytes;
+        return sequence != lastSequence || bytes >= INTERVAL_BYTES;
+    }
+
+    void RedoIndex::add(typeResetlogs newResetlogs, Scn scn, Time time, Seq sequence, FileOffset fileOffset) {
+        bytes = 0;
+        lastSequence = sequence;
+
+        std::unique_lock const lck(mtx);
+        // Only the current incarnation is indexed
+        if (resetlogs != newResetlogs) {
+            entries.clear();
+            resetlogs = newResetlogs;
+        }
+
+        // Parsing again from an earlier position replaces the entries
+        while (!entries.empty() && entries.back().scn >= scn)
+            entries.pop_back();
+
+        if (entries.size() >= ENTRIES_MAX) {
+            uint64_t j = 0;
+            for (uint64_t i = 0; i < entries.size(); i += 2)
+                entries[j++] = entries[i];
+            entries.resize(j);
+        }
+
+        entries.push_back({scn, time, sequence, fileOffset});
+        changed = true;
+    }
+
+    bool RedoIndex::findScn(typeResetlogs findResetlogs, Scn scn, Seq sequence, Entry& entry) {
+        std::unique_lock const lck(mtx);
+        if (findResetlogs != resetlogs || entries.empty())
+            return false;
+
+        const auto it = std::upper_bound(entries.cbegin(), entries.cend(), scn, [](Scn value, const Entry& e) {
+            return value < e.scn;
+        });
+        if (it == entries.cbegin())
+            return false;
+
+        const uint64_t i = it - entries.cbegin() - 1;
+        // With the sequence known from the database, the entry just moves the start inside of the redo log file
+        if (sequence != Seq::none()) {
+            if (entries[i].sequence != sequence)
+                return false;
+        } else if (!isContinuous(i))
+            return false;
+
+        entry = entries[i];
+        return true;
+    }
+
+    bool RedoIndex::findTime(typeResetlogs findResetlogs, time_t time, int64_t hostTimezone, Entry& entry) {
+        std::unique_lock const lck(mtx);
+        if (findResetlogs != resetlogs)
+            return false;
+
+        for (uint64_t i = entries.size(); i > 0; --i) {
+            if (entries[i - 1].time.toEpoch(hostTimezone) > time)
+                continue;
+
+            if (!isContinuous(i - 1))
+                return false;
+            entry = entries[i - 1];
+            return true;
+        }
+        return false;
+    }
+
+    bool RedoIndex::serialize(std::ostringstream& ss) {
+        std::unique_lock const lck(mtx);
+        if (!changed)
+            return false;
+
+        // The binary checkpoint magic keeps the file in binary format in the state storage
+        std::string out(HEADER_SIZE + (entries.size() * ENTRY_SIZE), '\0');
+        auto* data = reinterpret_cast<uint8_t*>(out.data());
+        memcpy(data, Serializer::BINARY_MAGIC, sizeof(Serializer::BINARY_MAGIC));
+        Ctx::write32Little(data + 8, VERSION);
+        Ctx::write32Little(data + 12, resetlogs);
+        Ctx::write64Little(data + 16, entries.size());
+
+        uint8_t* pos = data + HEADER_SIZE;
+        for (const Entry& e: entries) {
+            Ctx::write64Little(pos, e.scn.getData());
+            Ctx::write32Little(pos + 8, e.time.getVal());
+            Ctx::write32Little(pos + 12, e.sequence.getData());
+            Ctx::write64Little(pos + 16, e.fileOffset.getData());
+            pos += ENTRY_SIZE;
+        }
+
+        ss.write(out.data(), static_cast<std::streamsize>(out.length()));
+        changed = false;
+        return true;
+    }
+
+    bool RedoIndex::deserialize(std::string_view ss) {
+        if (ss.length() < HEADER_SIZE || memcmp(ss.data(), Serializer::BINARY_MAGIC, sizeof(Serializer::BINARY_MAGIC)) != 0)
+            return false;
+
+        const auto* data = reinterpret_cast<const uint8_t*>(ss.data());
+        if (Ctx::read32Little(data + 8) != VERSION)
+            return false;
+        const uint64_t count = Ctx::read64Little(data + 16);
+        if (count > (ss.length() - HEADER_SIZE) / ENTRY_SIZE)
+            return false;
+
+        std::unique_lock const lck(mtx);
+        resetlogs = Ctx::read32Little(data + 12);
+        entries.clear();
+        entries.reserve(count);
+
+        const uint8_t* pos = data + HEADER_SIZE;
+        for (uint64_t i = 0; i < count; ++i) {
+            Entry e{Scn(Ctx::read64Little(pos)), Time(Ctx::read32Little(pos + 8)), Seq(Ctx::read32Little(pos + 12)),
+                    FileOffset(Ctx::read64Little(pos + 16))};
+            // Entries are kept in SCN order
+            if (!entries.empty() && e.scn <= entries.back().scn) {
+                entries.clear();
+                return false;
+            }
+            entries.push_back(e);
+            pos += ENTRY_SIZE;
+        }
+        changed = false;
+        return true;
+    }
+}
@@ -0,0 +1,85 @@
+/* Header for RedoIndex class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef REDO_INDEX_H_
+#define REDO_INDEX_H_
+
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+#include "../common/types/FileOffset.h"
+#include "../common/types/Scn.h"
+#include "../common/types/Seq.h"
+#include "../common/types/Time.h"
+#include "../common/types/Types.h"
+
+namespace OpenLogReplicator {
+    // Sparse map of SCN and time to the redo log position to start parsing from, sampled at LWN boundaries by the parser and stored with
+    // the checkpoints. Starting from a given SCN or time begins at the nearest sampled LWN instead of the beginning of the redo log file.
+    // File layout, all numbers are little endian: magic (8), version (4), resetlogs (4), number of entries (8), then for every entry:
+    // scn (8), timestamp (4), sequence (4), offset (8).
+    class RedoIndex final {
+    public:
+        static constexpr uint64_t FILE_MAX_SIZE{16777216};
+        // Redo bytes parsed between two entries
+        static constexpr uint64_t INTERVAL_BYTES{16777216};
+        // The index is thinned to every second entry when full
+        static constexpr uint64_t ENTRIES_MAX{65536};
+
+        class Entry final {
+        public:
+            Scn scn;
+            Time time;
+            Seq sequence;
+            FileOffset fileOffset;
+        };
+
+    protected:
+        static constexpr uint32_t VERSION{1};
+        static constexpr uint64_t HEADER_SIZE{24};
+        static constexpr uint64_t ENTRY_SIZE{24};
+
+        std::mutex mtx;
+        std::vector<Entry> entries;
+        typeResetlogs resetlogs{0};
+        bool changed{false};
+        // Used by the parser thread only
+        uint64_t bytes{0};
+        Seq lastSequence{Seq::none()};
+
+        [[nodiscard]] bool isContinuous(uint64_t i) const;
+
+    public:
+        [[nodiscard]] bool sample(Seq sequence, uint64_t newBytes);
+        void add(typeResetlogs newResetlogs, Scn scn, Time time, Seq sequence, FileOffset fileOffset);
+        [[nodiscard]] bool findScn(typeResetlogs findResetlogs, Scn scn, Seq sequence, Entry& entry);
+        [[nodiscard]] bool findTime(typeResetlogs findResetlogs, time_t time, int64_t hostTimezone, Entry& entry);
+        [[nodiscard]] bool serialize(std::ostringstream& ss);
+        [[nodiscard]] bool deserialize(std::string_view ss);
+
+        [[nodiscard]] typeResetlogs getResetlogs() {
+            std::unique_lock const lck(mtx);
+            return resetlogs;
+        }
+    };
+}
+
+#endif
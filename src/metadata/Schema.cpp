@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <algorithm>
 #include <cstring>
 #include <vector>
 #include <regex>
@@ -483,6 +484,174 @@ namespace OpenLogReplicator {
         touched = false;
     }
 
+    void Schema::resetChanged() {
+        sysCColPack.setChanged.clear();
+        sysCDefPack.setChanged.clear();
+        sysColPack.setChanged.clear();
+        sysDeferredStgPack.setChanged.clear();
+        sysEColPack.setChanged.clear();
+        sysLobPack.setChanged.clear();
+        sysLobCompPartPack.setChanged.clear();
+        sysLobFragPack.setChanged.clear();
+        sysObjPack.setChanged.clear();
+        sysTabPack.setChanged.clear();
+        sysTabComPartPack.setChanged.clear();
+        sysTabPartPack.setChanged.clear();
+        sysTabSubPartPack.setChanged.clear();
+        sysTsPack.setChanged.clear();
+        sysUserPack.setChanged.clear();
+        xdbTtSetPack.setChanged.clear();
+        for (const auto& [_, xmlCtx]: schemaXmlMap) {
+            xmlCtx->xdbXNmPack.setChanged.clear();
+            xmlCtx->xdbXPtPack.setChanged.clear();
+            xmlCtx->xdbXQnPack.setChanged.clear();
+        }
+    }
+
+    bool Schema::deltaAllowed() const {
+        // XML dictionaries are created together with XDB.XDB$TTSET rows, changes are always stored as a full schema image
+        if (!xdbTtSetPack.setChanged.empty())
+            return false;
+        for (const auto& [_, xmlCtx]: schemaXmlMap) {
+            if (!xmlCtx->xdbXNmPack.setChanged.empty() || !xmlCtx->xdbXPtPack.setChanged.empty() || !xmlCtx->xdbXQnPack.setChanged.empty())
+                return false;
+        }
+        return true;
+    }
+
+    void Schema::snapshot(bool storeSchema, bool delta, Scn checkpointScn) {
+        snapshotScn = scn;
+        snapshotRefScn = refScn;
+        snapshotBaseScn = baseScn;
+        snapshotXmlCtx.clear();
+        if (!storeSchema)
+            return;
+
+        if (!delta)
+            baseScn = checkpointScn;
+        refScn = checkpointScn;
+
+        sysCColPack.snapshot(delta);
+        sysCDefPack.snapshot(delta);
+        sysColPack.snapshot(delta);
+        sysDeferredStgPack.snapshot(delta);
+        sysEColPack.snapshot(delta);
+        sysLobPack.snapshot(delta);
+        sysLobCompPartPack.snapshot(delta);
+        sysLobFragPack.snapshot(delta);
+        sysObjPack.snapshot(delta);
+        sysTabPack.snapshot(delta);
+        sysTabComPartPack.snapshot(delta);
+        sysTabPartPack.snapshot(delta);
+        sysTabSubPartPack.snapshot(delta);
+        sysTsPack.snapshot(delta);
+        sysUserPack.snapshot(delta);
+        xdbTtSetPack.snapshot(delta);
+
+        // XML dictionaries are stored only in a full schema image
+        if (delta)
+            return;
+        for (const auto& [_, xmlCtx]: schemaXmlMap) {
+            xmlCtx->xdbXNmPack.snapshot(false);
+            xmlCtx->xdbXPtPack.snapshot(false);
+            xmlCtx->xdbXQnPack.snapshot(false);
+            snapshotXmlCtx.push_back(xmlCtx);
+        }
+    }
+
+    void Schema::releaseSnapshot() {
+        sysCColPack.releaseSnapshot();
+        sysCDefPack.releaseSnapshot();
+        sysColPack.releaseSnapshot();
+        sysDeferredStgPack.releaseSnapshot();
+        sysEColPack.releaseSnapshot();
+        sysLobPack.releaseSnapshot();
+        sysLobCompPartPack.releaseSnapshot();
+        sysLobFragPack.releaseSnapshot();
+        sysObjPack.releaseSnapshot();
+        sysTabPack.releaseSnapshot();
+        sysTabComPartPack.releaseSnapshot();
+        sysTabPartPack.releaseSnapshot();
+        sysTabSubPartPack.releaseSnapshot();
+        sysTsPack.releaseSnapshot();
+        sysUserPack.releaseSnapshot();
+        xdbTtSetPack.releaseSnapshot();
+        for (const auto& [_, xmlCtx]: schemaXmlMap) {
+            xmlCtx->xdbXNmPack.releaseSnapshot();
+            xmlCtx->xdbXPtPack.releaseSnapshot();
+            xmlCtx->xdbXQnPack.releaseSnapshot();
+        }
+        snapshotXmlCtx.clear();
+    }
+
+    bool Schema::dropDeltaRow(DbTable::TABLE table, RowId rowId) {
+        switch (table) {
+            case DbTable::TABLE::SYS_CCOL:
+                dropRow(sysCColPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_CDEF:
+                dropRow(sysCDefPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_COL:
+                dropRow(sysColPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_DEFERRED_STG:
+                dropRow(sysDeferredStgPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_ECOL:
+                dropRow(sysEColPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_LOB:
+                dropRow(sysLobPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_LOB_COMP_PART:
+                dropRow(sysLobCompPartPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_LOB_FRAG:
+                dropRow(sysLobFragPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_OBJ:
+                dropRow(sysObjPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_TAB:
+                dropRow(sysTabPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_TABPART:
+                dropRow(sysTabPartPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_TABCOMPART:
+                dropRow(sysTabComPartPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_TABSUBPART:
+                dropRow(sysTabSubPartPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_TS:
+                dropRow(sysTsPack, rowId);
+                break;
+
+            case DbTable::TABLE::SYS_USER:
+                dropRow(sysUserPack, rowId);
+                break;
+
+            default:
+                return false;
+        }
+        return true;
+    }
+
     void Schema::updateXmlCtx() {
         if (ctx->isFlagSet(Ctx::REDO_FLAGS::EXPERIMENTAL_XMLTYPE)) {
             xmlCtxDefault = nullptr;
@@ -501,8 +670,9 @@ namespace OpenLogReplicator {
 
     void Schema::buildMaps(const std::string& owner, const std::string& table, const std::vector<std::string>& keyList, const std::string& key,
                            SchemaElement::TAG_TYPE tagType, const std::vector<std::string>& tagList, const std::string& tag __attribute__((unused)),
-                           const std::string& condition, DbTable::OPTIONS options, std::unordered_map<typeObj, std::string>& tablesUpdated,
-                           bool suppLogDbPrimary, bool suppLogDbAll, uint64_t defaultCharacterMapId, uint64_t defaultCharacterNcharMapId) {
+                           const std::string& condition, const std::vector<DbFilter>& filters, const std::vector<std::string>& columnList,
+                           DbTable::OPTIONS options, std::unordered_map<typeObj, std::string>& tablesUpdated, bool suppLogDbPrimary,
+                           bool suppLogDbAll, uint64_t defaultCharacterMapId, uint64_t defaultCharacterNcharMapId) {
         const std::regex regexOwner(owner);
         const std::regex regexTable(table);
         char sysLobConstraintName[26]{"SYS_LOB0000000000C00000$$"};
@@ -976,6 +1146,35 @@ namespace OpenLogReplicator {
             tablesUpdated[sysObj->obj] = ss.str();
 
             tableTmp->setCondition(condition);
+
+            for (DbFilter filter: filters) {
+                for (typeCol i = 0; i < static_cast<typeCol>(tableTmp->columns.size()); ++i) {
+                    if (tableTmp->columns[i]->name == filter.column) {
+                        filter.col = i;
+                        break;
+                    }
+                }
+                if (unlikely(filter.col == -1))
+                    throw DataException(10082, "table " + std::string(sysUser->name) + "." + sysObj->name + " - column: " + filter.column +
+                                               " of column filter not found");
+
+                const DbColumn* column = tableTmp->columns[filter.col];
+                const CharacterSet* characterSet = nullptr;
+                auto characterMapIt = locales->characterMap.find(column->charsetId);
+                if (characterMapIt != locales->characterMap.end())
+                    characterSet = characterMapIt->second;
+                filter.encode(ctx, std::string(sysUser->name) + "." + sysObj->name, column, characterSet);
+                tableTmp->filters.push_back(std::move(filter));
+            }
+
+            for (const std::string& columnName: columnList) {
+                if (unlikely(std::none_of(tableTmp->columns.begin(), tableTmp->columns.end(),
+                                          [&columnName](const DbColumn* column) { return column->name == columnName; })))
+                    throw DataException(10041, "table " + std::string(sysUser->name) + "." + sysObj->name +
+                                               " - couldn't find all output column sets (" + columnName + ")");
+            }
+            tableTmp->buildOutputPlan(ctx, columnList);
+
             addTableToDict(tableTmp);
             tableTmp = nullptr;
         }
@@ -68,6 +68,24 @@ namespace OpenLogReplicator {
         RowId sysUserRowId;
         SysUser sysUserAdaptive;
 
+        template<class Data, class KeyMap, class KeyUnorderedMap>
+        void dropRow(TablePack<Data, KeyMap, KeyUnorderedMap>& pack, RowId rowId) {
+            const auto& it = pack.mapRowId.find(rowId);
+            if (it == pack.mapRowId.end())
+                return;
+
+            if constexpr (Data::dependentTable())
+                touchTable(it->second->getDependentTable());
+            if constexpr (Data::dependentTableLob())
+                touchTableLob(it->second->getDependentTableLob());
+            if constexpr (Data::dependentTableLobFrag())
+                touchTableLobFrag(it->second->getDependentTableLobFrag());
+            if constexpr (Data::dependentTablePart())
+                touchTablePart(it->second->getDependentTablePart());
+            pack.drop(ctx, rowId);
+            touched = true;
+        }
+
         void addTableToDict(DbTable* table);
         void removeTableFromDict(const DbTable* table);
         [[nodiscard]] uint16_t getLobBlockSize(typeTs ts) const;
@@ -75,7 +93,18 @@ namespace OpenLogReplicator {
     public:
         Scn scn{Scn::none()};
         Scn refScn{Scn::none()};
+        // Checkpoint holding the last full schema image, referenced by delta images
+        Scn baseScn{Scn::none()};
+        // Checkpoint of the last schema image applied while loading
+        Scn imageScn{Scn::none()};
+        // The loaded delta image requires the previous schema image to be loaded first
+        bool deltaPending{false};
         bool loaded{false};
+        // Consistent view written by the checkpoint thread, rows are taken from the snapshots of the packs
+        Scn snapshotScn{Scn::none()};
+        Scn snapshotRefScn{Scn::none()};
+        Scn snapshotBaseScn{Scn::none()};
+        std::vector<XmlCtx*> snapshotXmlCtx;
 
         std::unordered_map<typeDataObj, DbLob*> lobPartitionMap;
         std::unordered_map<typeDataObj, DbLob*> lobIndexMap;
@@ -128,9 +157,15 @@ namespace OpenLogReplicator {
                                 std::string>& tablesDropped);
         void buildMaps(const std::string& owner, const std::string& table, const std::vector<std::string>& keyList, const std::string& key,
                        SchemaElement::TAG_TYPE tagType, const std::vector<std::string>& tagList, const std::string& tag, const std::string& condition,
-                       DbTable::OPTIONS options, std::unordered_map<typeObj, std::string>& tablesUpdated, bool suppLogDbPrimary, bool suppLogDbAll,
+                       const std::vector<DbFilter>& filters, const std::vector<std::string>& columnList, DbTable::OPTIONS options,
+                       std::unordered_map<typeObj, std::string>& tablesUpdated, bool suppLogDbPrimary, bool suppLogDbAll,
                        uint64_t defaultCharacterMapId, uint64_t defaultCharacterNcharMapId);
         void resetTouched();
+        void resetChanged();
+        [[nodiscard]] bool deltaAllowed() const;
+        void snapshot(bool storeSchema, bool delta, Scn checkpointScn);
+        void releaseSnapshot();
+        [[nodiscard]] bool dropDeltaRow(DbTable::TABLE table, RowId rowId);
         void updateXmlCtx();
     };
 }
@@ -24,6 +24,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <locale>
 #include <vector>
 
+#include "../common/DbFilter.h"
 #include "../common/DbTable.h"
 #include "../common/types/Types.h"
 
@@ -37,6 +38,7 @@ namespace OpenLogReplicator {
             LIST
         };
 
+        std::string columns;
         std::string condition;
         std::string key;
         std::string owner;
@@ -44,6 +46,8 @@ namespace OpenLogReplicator {
         std::string tag;
         DbTable::OPTIONS options;
         TAG_TYPE tagType{TAG_TYPE::NONE};
+        std::vector<std::string> columnList;
+        std::vector<DbFilter> filters;
         std::vector<std::string> keyList;
         std::vector<std::string> tagList;
 
@@ -52,6 +56,16 @@ namespace OpenLogReplicator {
             table(std::move(newTable)),
             options(newOptions) {}
 
+        void parseColumns(std::string value, const std::string& separator) {
+            size_t pos = 0;
+            while ((pos = value.find(separator)) != std::string::npos) {
+                const std::string val = value.substr(0, pos);
+                columnList.push_back(val);
+                value.erase(0, pos + separator.length());
+            }
+            columnList.push_back(value);
+        }
+
         void parseKey(std::string value, const std::string& separator) {
             size_t pos = 0;
             while ((pos = value.find(separator)) != std::string::npos) {
@@ -17,8 +17,17 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <cstring>
+
 #include "Serializer.h"
 
 namespace OpenLogReplicator {
-    Serializer::Serializer() = default;
+    Serializer::Serializer(FORMAT newFormat):
+            format(newFormat) {}
+
+    Serializer::FORMAT Serializer::detect(std::string_view ss) {
+        if (ss.length() >= sizeof(BINARY_MAGIC) && memcmp(ss.data(), BINARY_MAGIC, sizeof(BINARY_MAGIC)) == 0)
+            return FORMAT::BINARY;
+        return FORMAT::JSON;
+    }
 }
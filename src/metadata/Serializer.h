@@ -21,7 +21,9 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define SERIALIZER_H_
 
 #include <rapidjson/document.h>
+#include <mutex>
 #include <rapidjson/error/en.h>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -32,12 +34,25 @@ namespace OpenLogReplicator {
 
     class Serializer {
     public:
-        Serializer();
+        enum class FORMAT : unsigned char {
+            JSON,
+            BINARY
+        };
+
+        // First bytes of every binary checkpoint file, JSON files always start with '{'
+        static constexpr char BINARY_MAGIC[8]{'O', 'L', 'R', 'C', 'H', 'K', 'P', 'T'};
+
+        const FORMAT format;
+
+        explicit Serializer(FORMAT newFormat);
         virtual ~Serializer() = default;
 
-        [[nodiscard]] virtual bool deserialize(Metadata* metadata, const std::string& ss, const std::string& fileName, std::vector<std::string>& msgs,
+        [[nodiscard]] static FORMAT detect(std::string_view ss);
+
+        [[nodiscard]] virtual bool deserialize(Metadata* metadata, std::string_view ss, const std::string& fileName, std::vector<std::string>& msgs,
                                                std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool storeSchema) = 0;
-        virtual void serialize(Metadata* metadata, std::ostringstream& ss, bool noSchema) = 0;
+        // The checkpoint lock is released before the schema snapshot is written, it is null when no other thread uses the metadata
+        virtual void serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema, bool storeDelta, std::unique_lock<std::mutex>* lckCheckpoint) = 0;
     };
 }
 
@@ -0,0 +1,977 @@
+/* Base class for serialization of metadata to binary files
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <set>
+
+#include "../common/Ctx.h"
+#include "../common/DbIncarnation.h"
+#include "../common/XmlCtx.h"
+#include "../common/exception/DataException.h"
+#include "../common/table/SysCCol.h"
+#include "../common/table/SysCDef.h"
+#include "../common/table/SysCol.h"
+#include "../common/table/SysDeferredStg.h"
+#include "../common/table/SysECol.h"
+#include "../common/table/SysLob.h"
+#include "../common/table/SysLobCompPart.h"
+#include "../common/table/SysLobFrag.h"
+#include "../common/table/SysObj.h"
+#include "../common/table/SysTab.h"
+#include "../common/table/SysTabComPart.h"
+#include "../common/table/SysTabPart.h"
+#include "../common/table/SysTabSubPart.h"
+#include "../common/table/SysTs.h"
+#include "../common/table/SysUser.h"
+#include "../common/table/XdbTtSet.h"
+#include "../common/table/XdbXNm.h"
+#include "../common/table/XdbXQn.h"
+#include "../common/table/XdbXPt.h"
+#include "../common/types/IntX.h"
+#include "RedoLog.h"
+#include "Metadata.h"
+#include "Schema.h"
+#include "SerializerBinary.h"
+
+namespace OpenLogReplicator {
+    std::string& SerializerBinary::Output::add(SECTION section) {
+        ++counts[static_cast<uint>(section)];
+        return sections[static_cast<uint>(section)];
+    }
+
+    void SerializerBinary::Output::put8(std::string& out, uint8_t value) {
+        out.push_back(static_cast<char>(value));
+    }
+
+    void SerializerBinary::Output::put16(std::string& out, uint16_t value) {
+        const char data[2]{static_cast<char>(value & 0xFF), static_cast<char>(value >> 8)};
+        out.append(data, sizeof(data));
+    }
+
+    void SerializerBinary::Output::put32(std::string& out, uint32_t value) {
+        const char data[4]{static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF), static_cast<char>((value >> 16) & 0xFF),
+                           static_cast<char>(value >> 24)};
+        out.append(data, sizeof(data));
+    }
+
+    void SerializerBinary::Output::put64(std::string& out, uint64_t value) {
+        put32(out, static_cast<uint32_t>(value & 0xFFFFFFFF));
+        put32(out, static_cast<uint32_t>(value >> 32));
+    }
+
+    void SerializerBinary::Output::putIntX(std::string& out, const IntX& value) {
+        put64(out, value.getData(0));
+        put64(out, value.getData(1));
+    }
+
+    void SerializerBinary::Output::putRowId(std::string& out, RowId rowId) {
+        put32(out, rowId.dataObj);
+        put32(out, rowId.dba);
+        put16(out, rowId.slot);
+    }
+
+    void SerializerBinary::Output::putString(std::string& out, const std::string& value) {
+        // Identical strings (column names, owners, etc.) are stored once
+        uint32_t offset;
+        auto it = stringMap.find(value);
+        if (it != stringMap.end()) {
+            offset = it->second;
+        } else {
+            offset = static_cast<uint32_t>(strings.length());
+            strings.append(value);
+            stringMap.insert_or_assign(value, offset);
+        }
+        put32(out, offset);
+        put32(out, static_cast<uint32_t>(value.length()));
+    }
+
+    const uint8_t* SerializerBinary::Input::record(SECTION section, uint64_t i) const {
+        return sections[static_cast<uint>(section)] + (i * recordSizes[static_cast<uint>(section)]);
+    }
+
+    uint8_t SerializerBinary::Input::get8(const uint8_t*& data) {
+        return *(data++);
+    }
+
+    uint16_t SerializerBinary::Input::get16(const uint8_t*& data) {
+        const uint16_t value = static_cast<uint16_t>(data[0]) | (static_cast<uint16_t>(data[1]) << 8);
+        data += 2;
+        return value;
+    }
+
+    uint32_t SerializerBinary::Input::get32(const uint8_t*& data) {
+        const uint32_t value = static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) |
+                (static_cast<uint32_t>(data[3]) << 24);
+        data += 4;
+        return value;
+    }
+
+    uint64_t SerializerBinary::Input::get64(const uint8_t*& data) {
+        const uint64_t low = get32(data);
+        const uint64_t high = get32(data);
+        return low | (high << 32);
+    }
+
+    RowId SerializerBinary::Input::getRowId(const uint8_t*& data) {
+        const typeDataObj dataObj = get32(data);
+        const typeDba dba = get32(data);
+        const typeSlot slot = get16(data);
+        return {dataObj, dba, slot};
+    }
+
+    std::string SerializerBinary::Input::getString(const uint8_t*& data) const {
+        const uint64_t offset = get32(data);
+        const uint64_t length = get32(data);
+        if (unlikely(offset + length > strings.length()))
+            throw DataException(20001, "file: " + fileName + " - string at offset: " + std::to_string(offset) + ", length: " +
+                                std::to_string(length) + " is outside of the string table");
+        return std::string(strings.substr(offset, length));
+    }
+
+    void SerializerBinary::serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema, bool storeDelta,
+                                     std::unique_lock<std::mutex>* lckCheckpoint) {
+        // Assuming the caller holds the checkpoint lock and has taken the schema snapshot
+        Output output;
+
+        std::string& header = output.add(SECTION::HEADER);
+        Output::put64(header, metadata->checkpointScn.getData());
+        Output::put32(header, metadata->resetlogs);
+        Output::put32(header, metadata->activation);
+        Output::put32(header, metadata->checkpointTime.getVal());
+        Output::put32(header, metadata->checkpointSequence.getData());
+        Output::put64(header, metadata->checkpointFileOffset.getData());
+        Output::put32(header, metadata->minSequence.getData());
+        Output::put64(header, metadata->minFileOffset.getData());
+        Output::put64(header, metadata->minXid.getData());
+        Output::put8(header, metadata->ctx->isBigEndian() ? 1 : 0);
+        Output::put8(header, metadata->suppLogDbPrimary ? 1 : 0);
+        Output::put8(header, metadata->suppLogDbAll ? 1 : 0);
+        Output::put16(header, static_cast<uint16_t>(metadata->conId));
+        output.putString(header, metadata->database);
+        output.putString(header, metadata->context);
+        output.putString(header, metadata->conName);
+        output.putString(header, metadata->dbTimezoneStr);
+        output.putString(header, metadata->dbRecoveryFileDest);
+        output.putString(header, metadata->dbBlockChecksum);
+        output.putString(header, metadata->logArchiveDest);
+        output.putString(header, metadata->logArchiveFormat);
+        output.putString(header, metadata->nlsCharacterSet);
+        output.putString(header, metadata->nlsNcharCharacterSet);
+        Output::put8(header, storeSchema ? 1 : 0);
+        if (storeSchema) {
+            // Only rows changed since the previous schema image
+            if (storeDelta) {
+                std::string& delta = output.add(SECTION::SCHEMA_DELTA);
+                Output::put64(delta, metadata->schema->snapshotBaseScn.getData());
+                Output::put64(delta, metadata->schema->snapshotRefScn.getData());
+            }
+        }
+        Output::put64(header, metadata->schema->snapshotScn.getData());
+        Output::put64(header, storeSchema ? metadata->checkpointScn.getData() : metadata->schema->snapshotRefScn.getData());
+
+        for (const RedoLog* redoLog: metadata->redoLogs) {
+            if (redoLog->group == 0)
+                continue;
+
+            std::string& out = output.add(SECTION::ONLINE_REDO);
+            Output::put32(out, static_cast<uint32_t>(redoLog->group));
+            output.putString(out, redoLog->path);
+        }
+
+        for (const DbIncarnation* oi: metadata->dbIncarnations) {
+            std::string& out = output.add(SECTION::INCARNATION);
+            Output::put32(out, oi->incarnation);
+            Output::put64(out, oi->resetlogsScn.getData());
+            Output::put64(out, oi->priorResetlogsScn.getData());
+            output.putString(out, oi->status);
+            Output::put32(out, oi->resetlogs);
+            Output::put32(out, oi->priorIncarnation);
+        }
+
+        for (const std::string& user: metadata->users)
+            output.putString(output.add(SECTION::USER), user);
+
+        for (const auto& [thread, position]: metadata->redoThreadPositions) {
+            std::string& out = output.add(SECTION::REDO_THREAD);
+            Output::put16(out, thread);
+            Output::put32(out, position.sequence.getData());
+            Output::put64(out, position.fileOffset.getData());
+        }
+
+        // The schema is written from the snapshot, parsing may continue
+        metadata->releaseCheckpointLock(lckCheckpoint);
+
+        if (storeSchema) {
+            // SYS.CCOL$
+            for (const auto* sysCCol: metadata->schema->sysCColPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_CCOL);
+                Output::putRowId(out, sysCCol->rowId);
+                Output::put32(out, sysCCol->con);
+                Output::put16(out, static_cast<uint16_t>(sysCCol->intCol));
+                Output::put32(out, sysCCol->obj);
+                Output::putIntX(out, sysCCol->spare1);
+            }
+
+            // SYS.CDEF$
+            for (const auto* sysCDef: metadata->schema->sysCDefPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_CDEF);
+                Output::putRowId(out, sysCDef->rowId);
+                Output::put32(out, sysCDef->con);
+                Output::put32(out, sysCDef->obj);
+                Output::put16(out, static_cast<uint16_t>(sysCDef->type));
+            }
+
+            // SYS.COL$
+            for (const auto* sysCol: metadata->schema->sysColPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_COL);
+                Output::putRowId(out, sysCol->rowId);
+                Output::put32(out, sysCol->obj);
+                Output::put16(out, static_cast<uint16_t>(sysCol->col));
+                Output::put16(out, static_cast<uint16_t>(sysCol->segCol));
+                Output::put16(out, static_cast<uint16_t>(sysCol->intCol));
+                output.putString(out, sysCol->name);
+                Output::put16(out, static_cast<uint16_t>(sysCol->type));
+                Output::put32(out, sysCol->length);
+                Output::put32(out, static_cast<uint32_t>(sysCol->precision));
+                Output::put32(out, static_cast<uint32_t>(sysCol->scale));
+                Output::put32(out, sysCol->charsetForm);
+                Output::put32(out, sysCol->charsetId);
+                Output::put32(out, static_cast<uint32_t>(sysCol->null_));
+                Output::putIntX(out, sysCol->property);
+            }
+
+            // SYS.DEFERRED_STG$
+            for (const auto* sysDeferredStg: metadata->schema->sysDeferredStgPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_DEFERRED_STG);
+                Output::putRowId(out, sysDeferredStg->rowId);
+                Output::put32(out, sysDeferredStg->obj);
+                Output::putIntX(out, sysDeferredStg->flagsStg);
+            }
+
+            // SYS.ECOL$
+            for (const auto* sysECol: metadata->schema->sysEColPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_ECOL);
+                Output::putRowId(out, sysECol->rowId);
+                Output::put32(out, sysECol->tabObj);
+                Output::put16(out, static_cast<uint16_t>(sysECol->colNum));
+                Output::put16(out, static_cast<uint16_t>(sysECol->guardId));
+            }
+
+            // SYS.LOB$
+            for (const auto* sysLob: metadata->schema->sysLobPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_LOB);
+                Output::putRowId(out, sysLob->rowId);
+                Output::put32(out, sysLob->obj);
+                Output::put16(out, static_cast<uint16_t>(sysLob->col));
+                Output::put16(out, static_cast<uint16_t>(sysLob->intCol));
+                Output::put32(out, sysLob->lObj);
+                Output::put32(out, sysLob->ts);
+            }
+
+            // SYS.LOBCOMPPART$
+            for (const auto* sysLobCompPart: metadata->schema->sysLobCompPartPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_LOB_COMP_PART);
+                Output::putRowId(out, sysLobCompPart->rowId);
+                Output::put32(out, sysLobCompPart->partObj);
+                Output::put32(out, sysLobCompPart->lObj);
+            }
+
+            // SYS.LOBFRAG$
+            for (const auto* sysLobFrag: metadata->schema->sysLobFragPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_LOB_FRAG);
+                Output::putRowId(out, sysLobFrag->rowId);
+                Output::put32(out, sysLobFrag->fragObj);
+                Output::put32(out, sysLobFrag->parentObj);
+                Output::put32(out, sysLobFrag->ts);
+            }
+
+            // SYS.OBJ$
+            for (const auto* sysObj: metadata->schema->sysObjPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_OBJ);
+                Output::putRowId(out, sysObj->rowId);
+                Output::put32(out, sysObj->owner);
+                Output::put32(out, sysObj->obj);
+                Output::put32(out, sysObj->dataObj);
+                Output::put16(out, static_cast<uint16_t>(sysObj->type));
+                output.putString(out, sysObj->name);
+                Output::putIntX(out, sysObj->flags);
+                Output::put8(out, sysObj->single ? 1 : 0);
+            }
+
+            // SYS.TAB$
+            for (const auto* sysTab: metadata->schema->sysTabPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_TAB);
+                Output::putRowId(out, sysTab->rowId);
+                Output::put32(out, sysTab->obj);
+                Output::put32(out, sysTab->dataObj);
+                Output::put32(out, sysTab->ts);
+                Output::put16(out, static_cast<uint16_t>(sysTab->cluCols));
+                Output::putIntX(out, sysTab->flags);
+                Output::putIntX(out, sysTab->property);
+            }
+
+            // SYS.TABCOMPART$
+            for (const auto* sysTabComPart: metadata->schema->sysTabComPartPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_TABCOMPART);
+                Output::putRowId(out, sysTabComPart->rowId);
+                Output::put32(out, sysTabComPart->obj);
+                Output::put32(out, sysTabComPart->dataObj);
+                Output::put32(out, sysTabComPart->bo);
+            }
+
+            // SYS.TABPART$
+            for (const auto* sysTabPart: metadata->schema->sysTabPartPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_TABPART);
+                Output::putRowId(out, sysTabPart->rowId);
+                Output::put32(out, sysTabPart->obj);
+                Output::put32(out, sysTabPart->dataObj);
+                Output::put32(out, sysTabPart->bo);
+            }
+
+            // SYS.TABSUBPART$
+            for (const auto* sysTabSubPart: metadata->schema->sysTabSubPartPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_TABSUBPART);
+                Output::putRowId(out, sysTabSubPart->rowId);
+                Output::put32(out, sysTabSubPart->obj);
+                Output::put32(out, sysTabSubPart->dataObj);
+                Output::put32(out, sysTabSubPart->pObj);
+            }
+
+            // SYS.TS$
+            for (const auto* sysTs: metadata->schema->sysTsPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_TS);
+                Output::putRowId(out, sysTs->rowId);
+                Output::put32(out, sysTs->ts);
+                output.putString(out, sysTs->name);
+                Output::put32(out, sysTs->blockSize);
+            }
+
+            // SYS.USER$
+            for (const auto* sysUser: metadata->schema->sysUserPack.snapshotRows) {
+                std::string& out = output.add(SECTION::SYS_USER);
+                Output::putRowId(out, sysUser->rowId);
+                Output::put32(out, sysUser->user);
+                output.putString(out, sysUser->name);
+                Output::putIntX(out, sysUser->spare1);
+                Output::put8(out, sysUser->single ? 1 : 0);
+            }
+
+            // XDB.XDB$TTSET
+            for (const auto* xdbTtSet: metadata->schema->xdbTtSetPack.snapshotRows) {
+                std::string& out = output.add(SECTION::XDB_TTSET);
+                Output::putRowId(out, xdbTtSet->rowId);
+                output.putString(out, xdbTtSet->guid);
+                output.putString(out, xdbTtSet->tokSuf);
+                Output::put64(out, xdbTtSet->flags);
+                Output::put32(out, xdbTtSet->obj);
+            }
+
+            if (storeDelta) {
+                // Rows deleted since the previous schema image
+                serializeDropped(output, DbTable::TABLE::SYS_CCOL, metadata->schema->sysCColPack);
+                serializeDropped(output, DbTable::TABLE::SYS_CDEF, metadata->schema->sysCDefPack);
+                serializeDropped(output, DbTable::TABLE::SYS_COL, metadata->schema->sysColPack);
+                serializeDropped(output, DbTable::TABLE::SYS_DEFERRED_STG, metadata->schema->sysDeferredStgPack);
+                serializeDropped(output, DbTable::TABLE::SYS_ECOL, metadata->schema->sysEColPack);
+                serializeDropped(output, DbTable::TABLE::SYS_LOB, metadata->schema->sysLobPack);
+                serializeDropped(output, DbTable::TABLE::SYS_LOB_COMP_PART, metadata->schema->sysLobCompPartPack);
+                serializeDropped(output, DbTable::TABLE::SYS_LOB_FRAG, metadata->schema->sysLobFragPack);
+                serializeDropped(output, DbTable::TABLE::SYS_OBJ, metadata->schema->sysObjPack);
+                serializeDropped(output, DbTable::TABLE::SYS_TAB, metadata->schema->sysTabPack);
+                serializeDropped(output, DbTable::TABLE::SYS_TABCOMPART, metadata->schema->sysTabComPartPack);
+                serializeDropped(output, DbTable::TABLE::SYS_TABPART, metadata->schema->sysTabPartPack);
+                serializeDropped(output, DbTable::TABLE::SYS_TABSUBPART, metadata->schema->sysTabSubPartPack);
+                serializeDropped(output, DbTable::TABLE::SYS_TS, metadata->schema->sysTsPack);
+                serializeDropped(output, DbTable::TABLE::SYS_USER, metadata->schema->sysUserPack);
+            } else {
+                for (const XmlCtx* xmlCtx: metadata->schema->snapshotXmlCtx) {
+                    // XDB.X$NMxxx
+                    for (const auto* xdbXNm: xmlCtx->xdbXNmPack.snapshotRows) {
+                        std::string& out = output.add(SECTION::XDB_XNM);
+                        output.putString(out, xmlCtx->tokSuf);
+                        Output::putRowId(out, xdbXNm->rowId);
+                        output.putString(out, xdbXNm->nmSpcUri);
+                        output.putString(out, xdbXNm->id);
+                    }
+
+                    // XDB.X$PTxxx
+                    for (const auto* xdbXPt: xmlCtx->xdbXPtPack.snapshotRows) {
+                        std::string& out = output.add(SECTION::XDB_XPT);
+                        output.putString(out, xmlCtx->tokSuf);
+                        Output::putRowId(out, xdbXPt->rowId);
+                        output.putString(out, xdbXPt->path);
+                        output.putString(out, xdbXPt->id);
+                    }
+
+                    // XDB.X$QNxxx
+                    for (const auto* xdbXQn: xmlCtx->xdbXQnPack.snapshotRows) {
+                        std::string& out = output.add(SECTION::XDB_XQN);
+                        output.putString(out, xmlCtx->tokSuf);
+                        Output::putRowId(out, xdbXQn->rowId);
+                        output.putString(out, xdbXQn->nmSpcId);
+                        output.putString(out, xdbXQn->localName);
+                        output.putString(out, xdbXQn->flags);
+                        output.putString(out, xdbXQn->id);
+                    }
+                }
+            }
+        }
+
+        // Layout: header, section directory, sections, string table
+        constexpr uint sectionsNum = static_cast<uint>(SECTION::NUM);
+        uint64_t offset = HEADER_SIZE + (SECTION_SIZE * sectionsNum);
+        std::string directory;
+        for (uint i = 0; i < sectionsNum; ++i) {
+            Output::put32(directory, i);
+            Output::put32(directory, RECORD_SIZE[i]);
+            Output::put64(directory, output.counts[i]);
+            Output::put64(directory, offset);
+            offset += output.sections[i].length();
+        }
+
+        std::string head(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+        Output::put32(head, VERSION);
+        Output::put32(head, sectionsNum);
+        Output::put64(head, offset + output.strings.length());
+        Output::put64(head, offset);
+        Output::put64(head, output.strings.length());
+        Output::put64(head, 0);
+
+        ss.write(head.data(), static_cast<std::streamsize>(head.length()));
+        ss.write(directory.data(), static_cast<std::streamsize>(directory.length()));
+        for (const std::string& section: output.sections)
+            ss.write(section.data(), static_cast<std::streamsize>(section.length()));
+        ss.write(output.strings.data(), static_cast<std::streamsize>(output.strings.length()));
+    }
+
+    bool SerializerBinary::deserialize(Metadata* metadata, std::string_view ss, const std::string& fileName, std::vector<std::string>& msgs,
+                                       std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool loadSchema) {
+        try {
+            if (unlikely(ss.length() < HEADER_SIZE || Serializer::detect(ss) != FORMAT::BINARY))
+                throw DataException(20001, "file: " + fileName + " - missing binary checkpoint header");
+
+            const auto* data = reinterpret_cast<const uint8_t*>(ss.data());
+            const uint8_t* pos = data + sizeof(BINARY_MAGIC);
+            const uint32_t version = Input::get32(pos);
+            if (unlikely(version == 0 || version > VERSION))
+                throw DataException(20001, "file: " + fileName + " - unsupported binary checkpoint version: " + std::to_string(version) +
+                                    ", expected: at most " + std::to_string(VERSION));
+            const uint64_t sectionsNum = Input::get32(pos);
+            const uint64_t fileSize = Input::get64(pos);
+            const uint64_t stringsOffset = Input::get64(pos);
+            const uint64_t stringsSize = Input::get64(pos);
+            if (unlikely(fileSize != ss.length()))
+                throw DataException(20001, "file: " + fileName + " - invalid size: " + std::to_string(ss.length()) + ", expected: " +
+                                    std::to_string(fileSize));
+            if (unlikely(stringsOffset > fileSize || stringsSize > fileSize - stringsOffset ||
+                         HEADER_SIZE + (sectionsNum * SECTION_SIZE) > stringsOffset))
+                throw DataException(20001, "file: " + fileName + " - invalid section directory");
+
+            Input input(fileName);
+            input.strings = ss.substr(stringsOffset, stringsSize);
+            pos = data + HEADER_SIZE;
+            for (uint64_t i = 0; i < sectionsNum; ++i) {
+                const uint32_t id = Input::get32(pos);
+                const uint32_t recordSize = Input::get32(pos);
+                const uint64_t count = Input::get64(pos);
+                const uint64_t offset = Input::get64(pos);
+
+                // Sections added by newer versions
+                if (id >= static_cast<uint>(SECTION::NUM))
+                    continue;
+
+                if (unlikely(recordSize < RECORD_SIZE[id] || offset > stringsOffset ||
+                             (count > 0 && count > (stringsOffset - offset) / recordSize)))
+                    throw DataException(20001, "file: " + fileName + " - invalid section: " + std::to_string(id) + ", record size: " +
+                                        std::to_string(recordSize) + ", count: " + std::to_string(count) + ", offset: " + std::to_string(offset));
+
+                input.sections[id] = data + offset;
+                input.recordSizes[id] = recordSize;
+                input.counts[id] = count;
+            }
+            if (unlikely(input.counts[static_cast<uint>(SECTION::HEADER)] != 1))
+                throw DataException(20001, "file: " + fileName + " - missing header section");
+
+            std::unique_lock const lckCheckpoint(metadata->mtxCheckpoint);
+            std::unique_lock const lckSchema(metadata->mtxSchema);
+
+            readHeader(metadata, input, loadMetadata, loadSchema);
+
+            if (loadSchema) {
+                if (metadata->schema->scn != Scn::none()) {
+                    // Changed rows replace the loaded ones
+                    if (input.counts[static_cast<uint>(SECTION::SCHEMA_DELTA)] > 0)
+                        readDelta(metadata, input);
+                    readSchema(metadata, input);
+                    metadata->schema->touched = true;
+                }
+
+                // Loading schema from configuration file
+                metadata->buildMaps(msgs, tablesUpdated);
+                metadata->schema->resetTouched();
+                metadata->schema->resetChanged();
+                metadata->schema->loaded = true;
+            }
+        } catch (DataException& ex) {
+            metadata->ctx->error(ex.code, ex.msg);
+            return false;
+        }
+        return true;
+    }
+
+    void SerializerBinary::readHeader(Metadata* metadata, const Input& input, bool loadMetadata, bool loadSchema) {
+        const uint8_t* pos = input.record(SECTION::HEADER, 0);
+        const Scn scn(Input::get64(pos));
+        const typeResetlogs resetlogs = Input::get32(pos);
+        const typeActivation activation = Input::get32(pos);
+        pos += 4; // time, not read
+        const Seq sequence(Input::get32(pos));
+        const FileOffset fileOffset(Input::get64(pos));
+        const Seq minSequence(Input::get32(pos));
+        const FileOffset minFileOffset(Input::get64(pos));
+        pos += 8; // min-tran xid, not read
+        const bool bigEndian = Input::get8(pos) != 0;
+        const bool suppLogDbPrimary = Input::get8(pos) != 0;
+        const bool suppLogDbAll = Input::get8(pos) != 0;
+        const auto conId = static_cast<typeConId>(Input::get16(pos));
+        const std::string database = input.getString(pos);
+        const std::string context = input.getString(pos);
+        const std::string conName = input.getString(pos);
+        const std::string dbTimezoneStr = input.getString(pos);
+        const std::string dbRecoveryFileDest = input.getString(pos);
+        const std::string dbBlockChecksum = input.getString(pos);
+        const std::string logArchiveDest = input.getString(pos);
+        const std::string logArchiveFormat = input.getString(pos);
+        const std::string nlsCharacterSet = input.getString(pos);
+        const std::string nlsNcharCharacterSet = input.getString(pos);
+        const bool storeSchema = Input::get8(pos) != 0;
+        const Scn schemaScn(Input::get64(pos));
+        const Scn schemaRefScn(Input::get64(pos));
+
+        if (loadMetadata) {
+            metadata->checkpointScn = scn;
+            if (minSequence != Seq::none()) {
+                metadata->sequence = minSequence;
+                metadata->fileOffset = minFileOffset;
+            } else {
+                metadata->sequence = sequence;
+                metadata->fileOffset = fileOffset;
+            }
+
+            if (unlikely(!metadata->fileOffset.matchesBlockSize(Ctx::MIN_BLOCK_SIZE)))
+                throw DataException(20006, "file: " + input.fileName + " - invalid offset: " + metadata->fileOffset.toString() +
+                                    " is not a multiplication of " + std::to_string(Ctx::MIN_BLOCK_SIZE));
+
+            metadata->minSequence = Seq::none();
+            metadata->minFileOffset = FileOffset::zero();
+            metadata->minXid = Xid::zero();
+            metadata->lastCheckpointScn = Scn::none();
+            metadata->lastSequence = Seq::none();
+            metadata->lastCheckpointFileOffset = FileOffset::zero();
+            metadata->lastCheckpointTime = 0;
+            metadata->lastCheckpointBytes = 0;
+
+            metadata->redoThreadPositions.clear();
+            for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::REDO_THREAD)]; ++i) {
+                const uint8_t* rec = input.record(SECTION::REDO_THREAD, i);
+                RedoThreadPosition& position = metadata->redoThreadPositions[Input::get16(rec)];
+                position.sequence = Seq(Input::get32(rec));
+                position.fileOffset = FileOffset(Input::get64(rec));
+                if (unlikely(!position.fileOffset.matchesBlockSize(Ctx::MIN_BLOCK_SIZE)))
+                    throw DataException(20006, "file: " + input.fileName + " - invalid offset: " + position.fileOffset.toString() +
+                                        " is not a multiplication of " + std::to_string(Ctx::MIN_BLOCK_SIZE));
+            }
+
+            if (!metadata->onlineData) {
+                // Database metadata
+                if (metadata->database.empty()) {
+                    metadata->database = database;
+                } else if (metadata->database != database) {
+                    throw DataException(20001, "file: " + input.fileName + " - parse error of field \"database\", invalid value: " + database +
+                                        ", expected value: " + metadata->database);
+                }
+                metadata->resetlogs = resetlogs;
+                metadata->activation = activation;
+                if (bigEndian)
+                    metadata->ctx->setBigEndian();
+                metadata->context = context;
+                metadata->conId = conId;
+                metadata->conName = conName;
+                metadata->dbTimezoneStr = dbTimezoneStr;
+                if (metadata->ctx->dbTimezone != Ctx::BAD_TIMEZONE) {
+                    metadata->dbTimezone = metadata->ctx->dbTimezone;
+                } else {
+                    if (unlikely(!Data::parseTimezone(metadata->dbTimezoneStr, metadata->dbTimezone)))
+                        throw DataException(20001, "file: " + input.fileName + " - parse error of field \"db-timezone\", invalid value: " +
+                                            metadata->dbTimezoneStr);
+                }
+                metadata->dbRecoveryFileDest = dbRecoveryFileDest;
+                metadata->dbBlockChecksum = dbBlockChecksum;
+                if (!metadata->logArchiveFormatCustom)
+                    metadata->logArchiveFormat = logArchiveFormat;
+                metadata->logArchiveDest = logArchiveDest;
+                metadata->nlsCharacterSet = nlsCharacterSet;
+                metadata->nlsNcharCharacterSet = nlsNcharCharacterSet;
+                metadata->setNlsCharset(metadata->nlsCharacterSet, metadata->nlsNcharCharacterSet);
+                metadata->suppLogDbPrimary = suppLogDbPrimary;
+                metadata->suppLogDbAll = suppLogDbAll;
+
+                for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::ONLINE_REDO)]; ++i) {
+                    const uint8_t* rec = input.record(SECTION::ONLINE_REDO, i);
+                    const auto group = static_cast<int>(Input::get32(rec));
+                    auto* redoLog = new RedoLog(group, input.getString(rec));
+                    metadata->redoLogs.insert(redoLog);
+                }
+
+                for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::INCARNATION)]; ++i) {
+                    const uint8_t* rec = input.record(SECTION::INCARNATION, i);
+                    const uint32_t incarnation = Input::get32(rec);
+                    const Scn resetlogsScn(Input::get64(rec));
+                    const Scn priorResetlogsScn(Input::get64(rec));
+                    const std::string status = input.getString(rec);
+                    const typeResetlogs incarnationResetlogs = Input::get32(rec);
+                    const uint32_t priorIncarnation = Input::get32(rec);
+
+                    auto* oi = new DbIncarnation(incarnation, resetlogsScn, priorResetlogsScn, status, incarnationResetlogs, priorIncarnation);
+                    metadata->dbIncarnations.insert(oi);
+
+                    if (oi->current)
+                        metadata->dbIncarnationCurrent = oi;
+                    else
+                        metadata->dbIncarnationCurrent = nullptr;
+                }
+            }
+
+            if (!metadata->ctx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA)) {
+                std::set<std::string> users;
+                for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::USER)]; ++i) {
+                    const uint8_t* rec = input.record(SECTION::USER, i);
+                    users.insert(input.getString(rec));
+                }
+
+                for (const auto& user: metadata->users) {
+                    if (unlikely(users.find(user) == users.end()))
+                        throw DataException(20007, "file: " + input.fileName + " - " + user + " is missing");
+                }
+                for (const auto& user: users) {
+                    if (unlikely(metadata->users.find(user) == metadata->users.end()))
+                        throw DataException(20007, "file: " + input.fileName + " - " + user + " is redundant");
+                }
+            }
+        }
+
+        if (loadSchema) {
+            metadata->schema->deltaPending = false;
+            Scn schemaPrevScn = Scn::none();
+            if (input.counts[static_cast<uint>(SECTION::SCHEMA_DELTA)] > 0) {
+                const uint8_t* rec = input.record(SECTION::SCHEMA_DELTA, 0);
+                rec += 8; // base scn, not read
+                schemaPrevScn = Input::get64(rec);
+            }
+
+            // Schema referenced to other checkpoint file
+            if (!storeSchema) {
+                metadata->schema->scn = Scn::none();
+                metadata->schema->refScn = schemaRefScn;
+            } else if (schemaPrevScn != Scn::none() && metadata->schema->imageScn != schemaPrevScn) {
+                // Delta of a schema image which is not loaded yet
+                metadata->schema->scn = Scn::none();
+                metadata->schema->refScn = schemaPrevScn;
+                metadata->schema->deltaPending = true;
+            } else {
+                metadata->schema->scn = schemaScn;
+                metadata->schema->refScn = Scn::none();
+                metadata->schema->imageScn = scn;
+            }
+        }
+    }
+
+    void SerializerBinary::readDelta(Metadata* metadata, const Input& input) {
+        // Rows present in the delta are loaded again
+        for (const auto& [section, table]: DELTA_TABLES) {
+            for (uint64_t i = 0; i < input.counts[static_cast<uint>(section)]; ++i) {
+                const uint8_t* rec = input.record(section, i);
+                static_cast<void>(metadata->schema->dropDeltaRow(table, Input::getRowId(rec)));
+            }
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SCHEMA_DROP)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SCHEMA_DROP, i);
+            const auto table = static_cast<DbTable::TABLE>(Input::get8(rec));
+            const RowId rowId = Input::getRowId(rec);
+            if (unlikely(!metadata->schema->dropDeltaRow(table, rowId)))
+                throw DataException(20001, "file: " + input.fileName + " - invalid table: " + std::to_string(static_cast<uint>(table)) +
+                                    " in schema drop section");
+        }
+    }
+
+    void SerializerBinary::readSchema(Metadata* metadata, const Input& input) {
+        Ctx* ctx = metadata->ctx;
+        Schema* schema = metadata->schema;
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_USER)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_USER, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeUser user = Input::get32(rec);
+            std::string name = input.getString(rec);
+            const uint64_t spare11 = Input::get64(rec);
+            const uint64_t spare12 = Input::get64(rec);
+            const bool single = Input::get8(rec) != 0;
+
+            schema->sysUserPack.addWithKeys(ctx, new SysUser(rowId, user, std::move(name), spare11, spare12, single));
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_OBJ)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_OBJ, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeUser owner = Input::get32(rec);
+            const typeObj obj = Input::get32(rec);
+            const typeDataObj dataObj = Input::get32(rec);
+            const auto type = static_cast<SysObj::OBJTYPE>(Input::get16(rec));
+            std::string name = input.getString(rec);
+            const uint64_t flags1 = Input::get64(rec);
+            const uint64_t flags2 = Input::get64(rec);
+            const bool single = Input::get8(rec) != 0;
+
+            schema->sysObjPack.addWithKeys(ctx, new SysObj(rowId, owner, obj, dataObj, type, std::move(name), flags1, flags2, single));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_COL)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_COL, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const auto col = static_cast<typeCol>(Input::get16(rec));
+            const auto segCol = static_cast<typeCol>(Input::get16(rec));
+            const auto intCol = static_cast<typeCol>(Input::get16(rec));
+            std::string name = input.getString(rec);
+            const auto type = static_cast<SysCol::COLTYPE>(Input::get16(rec));
+            const uint length = Input::get32(rec);
+            const auto precision = static_cast<int>(Input::get32(rec));
+            const auto scale = static_cast<int>(Input::get32(rec));
+            const uint charsetForm = Input::get32(rec);
+            const uint charsetId = Input::get32(rec);
+            const auto null_ = static_cast<int>(Input::get32(rec));
+            const uint64_t property1 = Input::get64(rec);
+            const uint64_t property2 = Input::get64(rec);
+
+            schema->sysColPack.addWithKeys(ctx, new SysCol(rowId, obj, col, segCol, intCol, std::move(name), type, length, precision, scale,
+                                                           charsetForm, charsetId, null_, property1, property2));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_CCOL)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_CCOL, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeCon con = Input::get32(rec);
+            const auto intCol = static_cast<typeCol>(Input::get16(rec));
+            const typeObj obj = Input::get32(rec);
+            const uint64_t spare11 = Input::get64(rec);
+            const uint64_t spare12 = Input::get64(rec);
+
+            schema->sysCColPack.addWithKeys(ctx, new SysCCol(rowId, con, intCol, obj, spare11, spare12));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_CDEF)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_CDEF, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeCon con = Input::get32(rec);
+            const typeObj obj = Input::get32(rec);
+            const auto type = static_cast<SysCDef::CDEFTYPE>(Input::get16(rec));
+
+            schema->sysCDefPack.addWithKeys(ctx, new SysCDef(rowId, con, obj, type));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_DEFERRED_STG)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_DEFERRED_STG, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const uint64_t flagsStg1 = Input::get64(rec);
+            const uint64_t flagsStg2 = Input::get64(rec);
+
+            schema->sysDeferredStgPack.addWithKeys(ctx, new SysDeferredStg(rowId, obj, flagsStg1, flagsStg2));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_ECOL)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_ECOL, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj tabObj = Input::get32(rec);
+            const auto colNum = static_cast<typeCol>(Input::get16(rec));
+            const auto guardId = static_cast<typeCol>(Input::get16(rec));
+
+            schema->sysEColPack.addWithKeys(ctx, new SysECol(rowId, tabObj, colNum, guardId));
+            schema->touchTable(tabObj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_LOB)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_LOB, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const auto col = static_cast<typeCol>(Input::get16(rec));
+            const auto intCol = static_cast<typeCol>(Input::get16(rec));
+            const typeObj lObj = Input::get32(rec);
+            const typeTs ts = Input::get32(rec);
+
+            schema->sysLobPack.addWithKeys(ctx, new SysLob(rowId, obj, col, intCol, lObj, ts));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_LOB_COMP_PART)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_LOB_COMP_PART, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj partObj = Input::get32(rec);
+            const typeObj lObj = Input::get32(rec);
+
+            schema->sysLobCompPartPack.addWithKeys(ctx, new SysLobCompPart(rowId, partObj, lObj));
+            schema->touchTableLob(lObj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_LOB_FRAG)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_LOB_FRAG, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj fragObj = Input::get32(rec);
+            const typeObj parentObj = Input::get32(rec);
+            const typeTs ts = Input::get32(rec);
+
+            schema->sysLobFragPack.addWithKeys(ctx, new SysLobFrag(rowId, fragObj, parentObj, ts));
+            schema->touchTableLobFrag(parentObj);
+            schema->touchTableLob(parentObj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_TAB)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_TAB, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const typeDataObj dataObj = Input::get32(rec);
+            const typeTs ts = Input::get32(rec);
+            const auto cluCols = static_cast<typeCol>(Input::get16(rec));
+            const uint64_t flags1 = Input::get64(rec);
+            const uint64_t flags2 = Input::get64(rec);
+            const uint64_t property1 = Input::get64(rec);
+            const uint64_t property2 = Input::get64(rec);
+
+            schema->sysTabPack.addWithKeys(ctx, new SysTab(rowId, obj, dataObj, ts, cluCols, flags1, flags2, property1, property2));
+            schema->touchTable(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_TABPART)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_TABPART, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const typeDataObj dataObj = Input::get32(rec);
+            const typeObj bo = Input::get32(rec);
+
+            schema->sysTabPartPack.addWithKeys(ctx, new SysTabPart(rowId, obj, dataObj, bo));
+            schema->touchTable(bo);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_TABCOMPART)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_TABCOMPART, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const typeDataObj dataObj = Input::get32(rec);
+            const typeObj bo = Input::get32(rec);
+
+            schema->sysTabComPartPack.addWithKeys(ctx, new SysTabComPart(rowId, obj, dataObj, bo));
+            schema->touchTable(bo);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_TABSUBPART)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_TABSUBPART, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeObj obj = Input::get32(rec);
+            const typeDataObj dataObj = Input::get32(rec);
+            const typeObj pObj = Input::get32(rec);
+
+            schema->sysTabSubPartPack.addWithKeys(ctx, new SysTabSubPart(rowId, obj, dataObj, pObj));
+            schema->touchTablePart(obj);
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::SYS_TS)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::SYS_TS, i);
+            const RowId rowId = Input::getRowId(rec);
+            const typeTs ts = Input::get32(rec);
+            std::string name = input.getString(rec);
+            const uint32_t blockSize = Input::get32(rec);
+
+            schema->sysTsPack.addWithKeys(ctx, new SysTs(rowId, ts, std::move(name), blockSize));
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::XDB_TTSET)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::XDB_TTSET, i);
+            const RowId rowId = Input::getRowId(rec);
+            std::string guid = input.getString(rec);
+            std::string tokSuf = input.getString(rec);
+            const uint64_t flags = Input::get64(rec);
+            const typeObj obj = Input::get32(rec);
+
+            schema->xdbTtSetPack.addWithKeys(ctx, new XdbTtSet(rowId, std::move(guid), std::move(tokSuf), flags, obj));
+        }
+
+        // Delta images never contain XML dictionaries
+        if (input.counts[static_cast<uint>(SECTION::SCHEMA_DELTA)] > 0)
+            return;
+
+        for (const auto& [_, xdbTtSet]: schema->xdbTtSetPack.mapRowId) {
+            auto* xmlCtx = new XmlCtx(ctx, xdbTtSet->tokSuf, xdbTtSet->flags);
+            schema->schemaXmlMap.insert_or_assign(xdbTtSet->tokSuf, xmlCtx);
+        }
+
+        auto findXmlCtx = [&](const std::string& tokSuf) -> XmlCtx* {
+            auto it = schema->schemaXmlMap.find(tokSuf);
+            if (unlikely(it == schema->schemaXmlMap.end()))
+                throw DataException(20001, "file: " + input.fileName + " - missing XDB.XDB$TTSET entry for token suffix: " + tokSuf);
+            return it->second;
+        };
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::XDB_XNM)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::XDB_XNM, i);
+            XmlCtx* xmlCtx = findXmlCtx(input.getString(rec));
+            const RowId rowId = Input::getRowId(rec);
+            std::string nmSpcUri = input.getString(rec);
+            std::string id = input.getString(rec);
+
+            xmlCtx->xdbXNmPack.addWithKeys(ctx, new XdbXNm(rowId, std::move(nmSpcUri), std::move(id)));
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::XDB_XPT)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::XDB_XPT, i);
+            XmlCtx* xmlCtx = findXmlCtx(input.getString(rec));
+            const RowId rowId = Input::getRowId(rec);
+            std::string path = input.getString(rec);
+            std::string id = input.getString(rec);
+
+            xmlCtx->xdbXPtPack.addWithKeys(ctx, new XdbXPt(rowId, std::move(path), std::move(id)));
+        }
+
+        for (uint64_t i = 0; i < input.counts[static_cast<uint>(SECTION::XDB_XQN)]; ++i) {
+            const uint8_t* rec = input.record(SECTION::XDB_XQN, i);
+            XmlCtx* xmlCtx = findXmlCtx(input.getString(rec));
+            const RowId rowId = Input::getRowId(rec);
+            std::string nmSpcId = input.getString(rec);
+            std::string localName = input.getString(rec);
+            std::string flags = input.getString(rec);
+            std::string id = input.getString(rec);
+
+            xmlCtx->xdbXQnPack.addWithKeys(ctx, new XdbXQn(rowId, std::move(nmSpcId), std::move(localName), std::move(flags), std::move(id)));
+        }
+    }
+}
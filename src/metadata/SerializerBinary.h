@@ -0,0 +1,191 @@
+/* Header for SerializerBinary class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef SERIALIZER_BINARY_H_
+#define SERIALIZER_BINARY_H_
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "../common/DbTable.h"
+#include "../common/table/TablePack.h"
+#include "../common/types/RowId.h"
+#include "Serializer.h"
+
+namespace OpenLogReplicator {
+    class IntX;
+
+    // Checkpoint file layout, all numbers are little endian:
+    // - header: magic (8), version (4), number of sections (4), file size (8), string table offset (8), string table size (8), reserved (8)
+    // - section directory: id (4), record size (4), record count (8), data offset (8) for every section
+    // - section data: fixed size records, strings are stored as offset (4) and length (4) in the string table
+    // - string table: all distinct strings, not terminated
+    // Readers skip unknown sections and trailing fields of longer records, so new fields can be appended without changing the version.
+    // Version 2 adds schema delta images: the SCHEMA_DELTA section references the previous image, SYS sections hold only the changed rows.
+    class SerializerBinary final : public Serializer {
+    protected:
+        static constexpr uint32_t VERSION{2};
+        static constexpr uint64_t HEADER_SIZE{48};
+        static constexpr uint64_t SECTION_SIZE{24};
+
+        enum class SECTION : unsigned char {
+            HEADER,
+            ONLINE_REDO,
+            INCARNATION,
+            USER,
+            SYS_CCOL,
+            SYS_CDEF,
+            SYS_COL,
+            SYS_DEFERRED_STG,
+            SYS_ECOL,
+            SYS_LOB,
+            SYS_LOB_COMP_PART,
+            SYS_LOB_FRAG,
+            SYS_OBJ,
+            SYS_TAB,
+            SYS_TABCOMPART,
+            SYS_TABPART,
+            SYS_TABSUBPART,
+            SYS_TS,
+            SYS_USER,
+            XDB_TTSET,
+            XDB_XNM,
+            XDB_XPT,
+            XDB_XQN,
+            SCHEMA_DELTA,
+            SCHEMA_DROP,
+            REDO_THREAD,
+            NUM
+        };
+
+        // Minimal record sizes of every section
+        static constexpr uint32_t RECORD_SIZE[static_cast<uint>(SECTION::NUM)]{
+            154, // HEADER
+            12,  // ONLINE_REDO
+            36,  // INCARNATION
+            8,   // USER
+            36,  // SYS_CCOL
+            20,  // SYS_CDEF
+            70,  // SYS_COL
+            30,  // SYS_DEFERRED_STG
+            18,  // SYS_ECOL
+            26,  // SYS_LOB
+            18,  // SYS_LOB_COMP_PART
+            22,  // SYS_LOB_FRAG
+            49,  // SYS_OBJ
+            56,  // SYS_TAB
+            22,  // SYS_TABCOMPART
+            22,  // SYS_TABPART
+            22,  // SYS_TABSUBPART
+            26,  // SYS_TS
+            39,  // SYS_USER
+            38,  // XDB_TTSET
+            34,  // XDB_XNM
+            34,  // XDB_XPT
+            50,  // XDB_XQN
+            16,  // SCHEMA_DELTA
+            11,  // SCHEMA_DROP
+            14   // REDO_THREAD
+        };
+
+        // Sections which may be stored as a delta
+        static constexpr std::pair<SECTION, DbTable::TABLE> DELTA_TABLES[]{
+            {SECTION::SYS_CCOL, DbTable::TABLE::SYS_CCOL},
+            {SECTION::SYS_CDEF, DbTable::TABLE::SYS_CDEF},
+            {SECTION::SYS_COL, DbTable::TABLE::SYS_COL},
+            {SECTION::SYS_DEFERRED_STG, DbTable::TABLE::SYS_DEFERRED_STG},
+            {SECTION::SYS_ECOL, DbTable::TABLE::SYS_ECOL},
+            {SECTION::SYS_LOB, DbTable::TABLE::SYS_LOB},
+            {SECTION::SYS_LOB_COMP_PART, DbTable::TABLE::SYS_LOB_COMP_PART},
+            {SECTION::SYS_LOB_FRAG, DbTable::TABLE::SYS_LOB_FRAG},
+            {SECTION::SYS_OBJ, DbTable::TABLE::SYS_OBJ},
+            {SECTION::SYS_TAB, DbTable::TABLE::SYS_TAB},
+            {SECTION::SYS_TABCOMPART, DbTable::TABLE::SYS_TABCOMPART},
+            {SECTION::SYS_TABPART, DbTable::TABLE::SYS_TABPART},
+            {SECTION::SYS_TABSUBPART, DbTable::TABLE::SYS_TABSUBPART},
+            {SECTION::SYS_TS, DbTable::TABLE::SYS_TS},
+            {SECTION::SYS_USER, DbTable::TABLE::SYS_USER}
+        };
+
+        class Output final {
+        public:
+            std::string sections[static_cast<uint>(SECTION::NUM)];
+            uint64_t counts[static_cast<uint>(SECTION::NUM)]{};
+            std::string strings;
+            std::unordered_map<std::string, uint32_t> stringMap;
+
+            std::string& add(SECTION section);
+            static void put8(std::string& out, uint8_t value);
+            static void put16(std::string& out, uint16_t value);
+            static void put32(std::string& out, uint32_t value);
+            static void put64(std::string& out, uint64_t value);
+            static void putIntX(std::string& out, const IntX& value);
+            static void putRowId(std::string& out, RowId rowId);
+            void putString(std::string& out, const std::string& value);
+        };
+
+        class Input final {
+        public:
+            const std::string& fileName;
+            std::string_view strings;
+            const uint8_t* sections[static_cast<uint>(SECTION::NUM)]{};
+            uint32_t recordSizes[static_cast<uint>(SECTION::NUM)]{};
+            uint64_t counts[static_cast<uint>(SECTION::NUM)]{};
+
+            explicit Input(const std::string& newFileName):
+                    fileName(newFileName) {}
+
+            [[nodiscard]] const uint8_t* record(SECTION section, uint64_t i) const;
+            [[nodiscard]] static uint8_t get8(const uint8_t*& data);
+            [[nodiscard]] static uint16_t get16(const uint8_t*& data);
+            [[nodiscard]] static uint32_t get32(const uint8_t*& data);
+            [[nodiscard]] static uint64_t get64(const uint8_t*& data);
+            [[nodiscard]] static RowId getRowId(const uint8_t*& data);
+            [[nodiscard]] std::string getString(const uint8_t*& data) const;
+        };
+
+        template<class Data, class KeyMap, class KeyUnorderedMap>
+        static void serializeDropped(Output& output, DbTable::TABLE table, const TablePack<Data, KeyMap, KeyUnorderedMap>& pack) {
+            for (const RowId rowId: pack.snapshotDropped) {
+                std::string& out = output.add(SECTION::SCHEMA_DROP);
+                Output::put8(out, static_cast<uint8_t>(table));
+                Output::putRowId(out, rowId);
+            }
+        }
+
+        static void readHeader(Metadata* metadata, const Input& input, bool loadMetadata, bool loadSchema);
+        static void readDelta(Metadata* metadata, const Input& input);
+        static void readSchema(Metadata* metadata, const Input& input);
+
+    public:
+        SerializerBinary():
+                Serializer(FORMAT::BINARY) {}
+        ~SerializerBinary() override = default;
+        SerializerBinary(const SerializerBinary&) = delete;
+        SerializerBinary& operator=(const SerializerBinary&) = delete;
+
+        [[nodiscard]] bool deserialize(Metadata* metadata, std::string_view ss, const std::string& fileName, std::vector<std::string>& msgs,
+                                       std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool loadSchema) override;
+        void serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema, bool storeDelta,
+                       std::unique_lock<std::mutex>* lckCheckpoint) override;
+    };
+}
+
+#endif
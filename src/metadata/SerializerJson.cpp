@@ -49,8 +49,9 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "SerializerJson.h"
 
 namespace OpenLogReplicator {
-    void SerializerJson::serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema) {
-        // Assuming the caller holds all locks
+    void SerializerJson::serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema, bool storeDelta,
+                                   std::unique_lock<std::mutex>* lckCheckpoint) {
+        // Assuming the caller holds the checkpoint lock and has taken the schema snapshot
         ss << R"({"database":")";
         Data::writeEscapeValue(ss, metadata->database);
         ss << R"(","scn":)" << metadata->checkpointScn.toString() <<
@@ -65,6 +66,20 @@ namespace OpenLogReplicator {
                     R"(,"offset":)" << metadata->minFileOffset.toString() <<
                     R"(,"xid":")" << metadata->minXid.toString() << R"("})";
         }
+        if (!metadata->redoThreadPositions.empty()) {
+            ss << R"(,"redo-threads":[)";
+            bool hasPrev = false;
+            for (const auto& [thread, position]: metadata->redoThreadPositions) {
+                if (hasPrev)
+                    ss << ",";
+                else
+                    hasPrev = true;
+                ss << R"({"thread":)" << std::dec << thread <<
+                        R"(,"seq":)" << position.sequence.toString() <<
+                        R"(,"offset":)" << position.fileOffset.toString() << "}";
+            }
+            ss << "]";
+        }
         ss << R"(,"big-endian":)" << std::dec << (metadata->ctx->isBigEndian() ? 1 : 0) <<
                 R"(,"context":")";
         Data::writeEscapeValue(ss, metadata->context);
@@ -151,20 +166,27 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL;
 
+        // The schema is written from the snapshot, parsing may continue
+        metadata->releaseCheckpointLock(lckCheckpoint);
+
         // The schema has not changed since the last checkpoint file
         if (!storeSchema) {
-            ss << R"("schema-ref-scn":)" << metadata->schema->refScn.toString() << "}";
+            ss << R"("schema-ref-scn":)" << metadata->schema->snapshotRefScn.toString() << "}";
             return;
         }
 
-        metadata->schema->refScn = metadata->checkpointScn;
-        ss << R"("schema-scn":)" << metadata->schema->scn.toString() << ","
+        // Only rows changed since the previous schema image
+        if (storeDelta) {
+            ss << R"("schema-base-scn":)" << metadata->schema->snapshotBaseScn.toString() <<
+                    R"(,"schema-prev-scn":)" << metadata->schema->snapshotRefScn.toString() << ",";
+        }
+        ss << R"("schema-scn":)" << metadata->schema->snapshotScn.toString() << ","
         SERIALIZER_ENDL;
 
         // SYS.CCOL$
         ss << R"("sys-ccol":[)";
         hasPrev = false;
-        for (const auto& [_,sysCCol]: metadata->schema->sysCColPack.mapRowId) {
+        for (const auto* sysCCol: metadata->schema->sysCColPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -183,7 +205,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-cdef":[)";
         hasPrev = false;
-        for (const auto& [_, sysCDef]: metadata->schema->sysCDefPack.mapRowId) {
+        for (const auto* sysCDef: metadata->schema->sysCDefPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -201,7 +223,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-col":[)";
         hasPrev = false;
-        for (const auto& [_, sysCol]: metadata->schema->sysColPack.mapRowId) {
+        for (const auto* sysCol: metadata->schema->sysColPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -230,7 +252,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-deferredstg":[)";
         hasPrev = false;
-        for (const auto& [_, sysDeferredStg]: metadata->schema->sysDeferredStgPack.mapRowId) {
+        for (const auto* sysDeferredStg: metadata->schema->sysDeferredStgPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -247,7 +269,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-ecol":[)";
         hasPrev = false;
-        for (const auto& [_, sysECol]: metadata->schema->sysEColPack.mapRowId) {
+        for (const auto* sysECol: metadata->schema->sysEColPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -265,7 +287,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-lob":[)";
         hasPrev = false;
-        for (const auto& [_, sysLob]: metadata->schema->sysLobPack.mapRowId) {
+        for (const auto* sysLob: metadata->schema->sysLobPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -285,7 +307,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-lob-comp-part":[)";
         hasPrev = false;
-        for (const auto& [_, sysLobCompPart]: metadata->schema->sysLobCompPartPack.mapRowId) {
+        for (const auto* sysLobCompPart: metadata->schema->sysLobCompPartPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -302,7 +324,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-lob-frag":[)";
         hasPrev = false;
-        for (const auto& [_, sysLobFrag]: metadata->schema->sysLobFragPack.mapRowId) {
+        for (const auto* sysLobFrag: metadata->schema->sysLobFragPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -320,7 +342,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-obj":[)";
         hasPrev = false;
-        for (const auto& [_, sysObj]: metadata->schema->sysObjPack.mapRowId) {
+        for (const auto* sysObj: metadata->schema->sysObjPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -343,7 +365,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-tab":[)";
         hasPrev = false;
-        for (const auto& [_, sysTab]: metadata->schema->sysTabPack.mapRowId) {
+        for (const auto* sysTab: metadata->schema->sysTabPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -364,7 +386,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-tabcompart":[)";
         hasPrev = false;
-        for (const auto& [_, sysTabComPart]: metadata->schema->sysTabComPartPack.mapRowId) {
+        for (const auto* sysTabComPart: metadata->schema->sysTabComPartPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -382,7 +404,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-tabpart":[)";
         hasPrev = false;
-        for (const auto& [_, sysTabPart]: metadata->schema->sysTabPartPack.mapRowId) {
+        for (const auto* sysTabPart: metadata->schema->sysTabPartPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -400,7 +422,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-tabsubpart":[)";
         hasPrev = false;
-        for (const auto& [_, sysTabSubPart]: metadata->schema->sysTabSubPartPack.mapRowId) {
+        for (const auto* sysTabSubPart: metadata->schema->sysTabSubPartPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -418,7 +440,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-ts":[)";
         hasPrev = false;
-        for (const auto& [_, sysTs]: metadata->schema->sysTsPack.mapRowId) {
+        for (const auto* sysTs: metadata->schema->sysTsPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -437,7 +459,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("sys-user":[)";
         hasPrev = false;
-        for (const auto& [_, sysUser]: metadata->schema->sysUserPack.mapRowId) {
+        for (const auto* sysUser: metadata->schema->sysUserPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -457,7 +479,7 @@ namespace OpenLogReplicator {
         ss << "],"
         SERIALIZER_ENDL << R"("xdb-ttset":[)";
         hasPrev = false;
-        for (const auto& [_, xdbTtSet]: metadata->schema->xdbTtSetPack.mapRowId) {
+        for (const auto* xdbTtSet: metadata->schema->xdbTtSetPack.snapshotRows) {
             if (hasPrev)
                 ss << ",";
             else
@@ -473,12 +495,36 @@ namespace OpenLogReplicator {
                     R"(,"obj":)" << std::dec << xdbTtSet->obj << "}";
         }
 
-        for (const auto& [_, xmlCtx]: metadata->schema->schemaXmlMap) {
+        if (storeDelta) {
+            // Rows deleted since the previous schema image
+            ss << "],"
+            SERIALIZER_ENDL << R"("schema-drop":[)";
+            hasPrev = false;
+            serializeDropped(ss, hasPrev, "sys-ccol", metadata->schema->sysCColPack);
+            serializeDropped(ss, hasPrev, "sys-cdef", metadata->schema->sysCDefPack);
+            serializeDropped(ss, hasPrev, "sys-col", metadata->schema->sysColPack);
+            serializeDropped(ss, hasPrev, "sys-deferredstg", metadata->schema->sysDeferredStgPack);
+            serializeDropped(ss, hasPrev, "sys-ecol", metadata->schema->sysEColPack);
+            serializeDropped(ss, hasPrev, "sys-lob", metadata->schema->sysLobPack);
+            serializeDropped(ss, hasPrev, "sys-lob-comp-part", metadata->schema->sysLobCompPartPack);
+            serializeDropped(ss, hasPrev, "sys-lob-frag", metadata->schema->sysLobFragPack);
+            serializeDropped(ss, hasPrev, "sys-obj", metadata->schema->sysObjPack);
+            serializeDropped(ss, hasPrev, "sys-tab", metadata->schema->sysTabPack);
+            serializeDropped(ss, hasPrev, "sys-tabcompart", metadata->schema->sysTabComPartPack);
+            serializeDropped(ss, hasPrev, "sys-tabpart", metadata->schema->sysTabPartPack);
+            serializeDropped(ss, hasPrev, "sys-tabsubpart", metadata->schema->sysTabSubPartPack);
+            serializeDropped(ss, hasPrev, "sys-ts", metadata->schema->sysTsPack);
+            serializeDropped(ss, hasPrev, "sys-user", metadata->schema->sysUserPack);
+            ss << "]}";
+            return;
+        }
+
+        for (const XmlCtx* xmlCtx: metadata->schema->snapshotXmlCtx) {
             // XDB.X$NMxxx
             ss << "],"
             SERIALIZER_ENDL << R"("xdb-xnm)" << xmlCtx->tokSuf << R"(":[)";
             hasPrev = false;
-            for (const auto& [_2, xdbXNm]: xmlCtx->xdbXNmPack.mapRowId) {
+            for (const auto* xdbXNm: xmlCtx->xdbXNmPack.snapshotRows) {
                 if (hasPrev)
                     ss << ",";
                 else
@@ -496,7 +542,7 @@ namespace OpenLogReplicator {
             ss << "],"
             SERIALIZER_ENDL << R"("xdb-xpt)" << xmlCtx->tokSuf << R"(":[)";
             hasPrev = false;
-            for (const auto& [_2, xdbXPt]: xmlCtx->xdbXPtPack.mapRowId) {
+            for (const auto* xdbXPt: xmlCtx->xdbXPtPack.snapshotRows) {
                 if (hasPrev)
                     ss << ",";
                 else
@@ -514,7 +560,7 @@ namespace OpenLogReplicator {
             ss << "],"
             SERIALIZER_ENDL << R"("xdb-xqn)" << xmlCtx->tokSuf << R"(":[)";
             hasPrev = false;
-            for (const auto& [_2, xdbXQn]: xmlCtx->xdbXQnPack.mapRowId) {
+            for (const auto* xdbXQn: xmlCtx->xdbXQnPack.snapshotRows) {
                 if (hasPrev)
                     ss << ",";
                 else
@@ -536,11 +582,11 @@ namespace OpenLogReplicator {
         ss << "]}";
     }
 
-    bool SerializerJson::deserialize(Metadata* metadata, const std::string& ss, const std::string& fileName, std::vector<std::string>& msgs,
+    bool SerializerJson::deserialize(Metadata* metadata, std::string_view ss, const std::string& fileName, std::vector<std::string>& msgs,
                                      std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool loadSchema) {
         try {
             rapidjson::Document document;
-            if (unlikely(ss.empty() || document.Parse(ss.c_str()).HasParseError()))
+            if (unlikely(ss.empty() || document.Parse(ss.data(), ss.length()).HasParseError()))
                 throw DataException(20001, "file: " + fileName + " offset: " + std::to_string(document.GetErrorOffset()) +
                                     " - parse error: " + GetParseError_En(document.GetParseError()));
 
@@ -564,7 +610,11 @@ namespace OpenLogReplicator {
                     "nls-nchar-character-set",
                     "offset",
                     "online-redo",
+                    "redo-threads",
                     "resetlogs",
+                    "schema-base-scn",
+                    "schema-drop",
+                    "schema-prev-scn",
                     "schema-ref-scn",
                     "schema-scn",
                     "scn",
@@ -629,6 +679,28 @@ namespace OpenLogReplicator {
                 metadata->lastCheckpointTime = 0;
                 metadata->lastCheckpointBytes = 0;
 
+                metadata->redoThreadPositions.clear();
+                if (document.HasMember("redo-threads")) {
+                    const rapidjson::Value& redoThreadsJson = Ctx::getJsonFieldA(fileName, document, "redo-threads");
+                    for (rapidjson::SizeType i = 0; i < redoThreadsJson.Size(); ++i) {
+                        if (!metadata->ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                            static const std::vector<std::string> redoThreadsChildNames{
+                                "offset",
+                                "seq",
+                                "thread"
+                            };
+                            Ctx::checkJsonFields(fileName, redoThreadsJson[i], redoThreadsChildNames);
+                        }
+
+                        RedoThreadPosition& position = metadata->redoThreadPositions[Ctx::getJsonFieldU16(fileName, redoThreadsJson[i], "thread")];
+                        position.sequence = Ctx::getJsonFieldU32(fileName, redoThreadsJson[i], "seq");
+                        position.fileOffset = FileOffset(Ctx::getJsonFieldU64(fileName, redoThreadsJson[i], "offset"));
+                        if (unlikely(!position.fileOffset.matchesBlockSize(Ctx::MIN_BLOCK_SIZE)))
+                            throw DataException(20006, "file: " + fileName + " - invalid offset: " + position.fileOffset.toString() +
+                                                " is not a multiplication of " + std::to_string(Ctx::MIN_BLOCK_SIZE));
+                    }
+                }
+
                 if (!metadata->onlineData) {
                     // Database metadata
                     const std::string newDatabase = Ctx::getJsonFieldS(fileName, Ctx::JSON_PARAMETER_LENGTH, document, "database");
@@ -742,13 +814,26 @@ namespace OpenLogReplicator {
             }
 
             if (loadSchema) {
+                const bool delta = document.HasMember("schema-prev-scn");
+                metadata->schema->deltaPending = false;
+
                 // Schema referenced to other checkpoint file
                 if (document.HasMember("schema-ref-scn")) {
                     metadata->schema->scn = Scn::none();
                     metadata->schema->refScn = Ctx::getJsonFieldU64(fileName, document, "schema-ref-scn");
+                } else if (delta && metadata->schema->imageScn != Scn(Ctx::getJsonFieldU64(fileName, document, "schema-prev-scn"))) {
+                    // Delta of a schema image which is not loaded yet
+                    metadata->schema->scn = Scn::none();
+                    metadata->schema->refScn = Ctx::getJsonFieldU64(fileName, document, "schema-prev-scn");
+                    metadata->schema->deltaPending = true;
                 } else {
                     metadata->schema->scn = Ctx::getJsonFieldU64(fileName, document, "schema-scn");
                     metadata->schema->refScn = Scn::none();
+                    metadata->schema->imageScn = Ctx::getJsonFieldU64(fileName, document, "scn");
+
+                    // Changed rows replace the loaded ones
+                    if (delta)
+                        deserializeDelta(metadata, fileName, document);
 
                     deserializeSysUser(metadata, fileName, Ctx::getJsonFieldA(fileName, document, "sys-user"));
                     deserializeSysObj(metadata, fileName, Ctx::getJsonFieldA(fileName, document, "sys-obj"));
@@ -770,6 +855,10 @@ namespace OpenLogReplicator {
                         deserializeXdbTtSet(metadata, fileName, Ctx::getJsonFieldA(fileName, document, "xdb-ttset"));
 
                     for (const auto& [key, xdbTtSet]: metadata->schema->xdbTtSetPack.mapRowId) {
+                        // Delta images never contain XML dictionaries
+                        if (delta)
+                            break;
+
                         auto* xmlCtx = new XmlCtx(metadata->ctx, xdbTtSet->tokSuf, xdbTtSet->flags);
                         metadata->schema->schemaXmlMap.insert_or_assign(xdbTtSet->tokSuf, xmlCtx);
 
@@ -786,6 +875,7 @@ namespace OpenLogReplicator {
                 // Loading schema from configuration file
                 metadata->buildMaps(msgs, tablesUpdated);
                 metadata->schema->resetTouched();
+                metadata->schema->resetChanged();
                 metadata->schema->loaded = true;
                 return true;
             }
@@ -796,6 +886,58 @@ namespace OpenLogReplicator {
         return true;
     }
 
+    void SerializerJson::deserializeDelta(Metadata* metadata, const std::string& fileName, const rapidjson::Value& document) {
+        static const std::vector<std::pair<std::string, DbTable::TABLE>> deltaTables{
+            {"sys-ccol", DbTable::TABLE::SYS_CCOL},
+            {"sys-cdef", DbTable::TABLE::SYS_CDEF},
+            {"sys-col", DbTable::TABLE::SYS_COL},
+            {"sys-deferredstg", DbTable::TABLE::SYS_DEFERRED_STG},
+            {"sys-ecol", DbTable::TABLE::SYS_ECOL},
+            {"sys-lob", DbTable::TABLE::SYS_LOB},
+            {"sys-lob-comp-part", DbTable::TABLE::SYS_LOB_COMP_PART},
+            {"sys-lob-frag", DbTable::TABLE::SYS_LOB_FRAG},
+            {"sys-obj", DbTable::TABLE::SYS_OBJ},
+            {"sys-tab", DbTable::TABLE::SYS_TAB},
+            {"sys-tabcompart", DbTable::TABLE::SYS_TABCOMPART},
+            {"sys-tabpart", DbTable::TABLE::SYS_TABPART},
+            {"sys-tabsubpart", DbTable::TABLE::SYS_TABSUBPART},
+            {"sys-ts", DbTable::TABLE::SYS_TS},
+            {"sys-user", DbTable::TABLE::SYS_USER}
+        };
+
+        // Rows present in the delta are loaded again
+        for (const auto& [name, table]: deltaTables) {
+            const rapidjson::Value& rowsJson = Ctx::getJsonFieldA(fileName, document, name.c_str());
+            for (rapidjson::SizeType i = 0; i < rowsJson.Size(); ++i) {
+                const std::string rowIdStr = Ctx::getJsonFieldS(fileName, RowId::SIZE, rowsJson[i], "row-id");
+                static_cast<void>(metadata->schema->dropDeltaRow(table, RowId(rowIdStr)));
+            }
+        }
+
+        const rapidjson::Value& dropJson = Ctx::getJsonFieldA(fileName, document, "schema-drop");
+        for (rapidjson::SizeType i = 0; i < dropJson.Size(); ++i) {
+            if (!metadata->ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
+                static const std::vector<std::string> dropChildNames{
+                    "row-id",
+                    "table"
+                };
+                Ctx::checkJsonFields(fileName, dropJson[i], dropChildNames);
+            }
+
+            const std::string tableStr = Ctx::getJsonFieldS(fileName, Ctx::JSON_PARAMETER_LENGTH, dropJson[i], "table");
+            const std::string rowIdStr = Ctx::getJsonFieldS(fileName, RowId::SIZE, dropJson[i], "row-id");
+            bool found = false;
+            for (const auto& [name, table]: deltaTables) {
+                if (name == tableStr) {
+                    found = metadata->schema->dropDeltaRow(table, RowId(rowIdStr));
+                    break;
+                }
+            }
+            if (unlikely(!found))
+                throw DataException(20001, "file: " + fileName + " - parse error of field \"schema-drop\", invalid table: " + tableStr);
+        }
+    }
+
     void SerializerJson::deserializeSysCCol(const Metadata* metadata, const std::string& fileName, const rapidjson::Value& sysCColJson) {
         for (rapidjson::SizeType i = 0; i < sysCColJson.Size(); ++i) {
             if (!metadata->ctx->isDisableChecksSet(Ctx::DISABLE_CHECKS::JSON_TAGS)) {
@@ -23,6 +23,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
 
+#include "../common/table/TablePack.h"
 #include "Serializer.h"
 
 #define SERIALIZER_ENDL     <<'\n'
@@ -33,6 +34,19 @@ namespace OpenLogReplicator {
 
     class SerializerJson final : public Serializer {
     protected:
+        template<class Data, class KeyMap, class KeyUnorderedMap>
+        static void serializeDropped(std::ostringstream& ss, bool& hasPrev, const char* table, const TablePack<Data, KeyMap, KeyUnorderedMap>& pack) {
+            for (const RowId rowId: pack.snapshotDropped) {
+                if (hasPrev)
+                    ss << ",";
+                else
+                    hasPrev = true;
+
+                ss SERIALIZER_ENDL << R"({"table":")" << table << R"(","row-id":")" << rowId << R"("})";
+            }
+        }
+
+        static void deserializeDelta(Metadata* metadata, const std::string& fileName, const rapidjson::Value& document);
         static void deserializeSysCCol(const Metadata* metadata, const std::string& fileName, const rapidjson::Value& sysCColJson);
         static void deserializeSysCDef(Metadata* metadata, const std::string& fileName, const rapidjson::Value& sysCDefJson);
         static void deserializeSysCol(Metadata* metadata, const std::string& fileName, const rapidjson::Value& sysColJson);
@@ -54,14 +68,16 @@ namespace OpenLogReplicator {
         static void deserializeXdbXQn(Metadata* metadata, XmlCtx* xmlCtx, const std::string& fileName, const rapidjson::Value& xdbXQnJson);
 
     public:
-        SerializerJson() = default;
+        SerializerJson():
+                Serializer(FORMAT::JSON) {}
         ~SerializerJson() override = default;
         SerializerJson(const SerializerJson&) = delete;
         SerializerJson& operator=(const SerializerJson&) = delete;
 
-        [[nodiscard]] bool deserialize(Metadata* metadata, const std::string& ss, const std::string& fileName, std::vector<std::string>& msgs,
+        [[nodiscard]] bool deserialize(Metadata* metadata, std::string_view ss, const std::string& fileName, std::vector<std::string>& msgs,
                                        std::unordered_map<typeObj, std::string>& tablesUpdated, bool loadMetadata, bool loadSchema) override;
-        void serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema) override;
+        void serialize(Metadata* metadata, std::ostringstream& ss, bool storeSchema, bool storeDelta,
+                       std::unique_lock<std::mutex>* lckCheckpoint) override;
     };
 }
 
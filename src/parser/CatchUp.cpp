@@ -0,0 +1,239 @@
+/* Thread parsing archived redo logs ahead of the replicator
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "../common/exception/DataException.h"
+#include "../common/exception/RedoLogException.h"
+#include "../common/exception/RuntimeException.h"
+#include "CatchUp.h"
+#include "OpCode.h"
+#include "Parser.h"
+#include "Transaction.h"
+#include "TransactionBuffer.h"
+
+namespace OpenLogReplicator {
+    RedoLogRecord* CatchUpEvent::redoLogRecord1() const {
+        return reinterpret_cast<RedoLogRecord*>(data1 + sizeof(typeTransactionSize));
+    }
+
+    RedoLogRecord* CatchUpEvent::redoLogRecord2() const {
+        return reinterpret_cast<RedoLogRecord*>(data2 + sizeof(typeTransactionSize));
+    }
+
+    CatchUp::CatchUp(Ctx* newCtx, std::string newAlias, Parser* newParser, Reader* newReader, TransactionBuffer* newMainTransactionBuffer,
+                     Scn newSchemaScn):
+            Thread(newCtx, std::move(newAlias)),
+            parser(newParser),
+            reader(newReader),
+            transactionBuffer(new TransactionBuffer(newCtx, this)),
+            mainTransactionBuffer(newMainTransactionBuffer),
+            schemaScn(newSchemaScn) {
+        transactionBuffer->skipXidList = mainTransactionBuffer->skipXidList;
+        transactionBuffer->dumpXidList = mainTransactionBuffer->dumpXidList;
+        transactionBuffer->dumpPath = mainTransactionBuffer->dumpPath;
+    }
+
+    CatchUp::~CatchUp() {
+        freeEvents();
+
+        for (Transaction* transaction: dropped) {
+            transaction->purge(ctx);
+            delete transaction;
+        }
+        dropped.clear();
+
+        transactionBuffer->purge();
+        delete transactionBuffer;
+        transactionBuffer = nullptr;
+    }
+
+    void CatchUp::setConflict(const std::string& reason) {
+        std::unique_lock const lck(mtx);
+        if (conflict.empty())
+            conflict = reason;
+        stop = true;
+    }
+
+    bool CatchUp::isStopped() const {
+        return stop || ctx->softShutdown;
+    }
+
+    bool CatchUp::isDone() {
+        std::unique_lock const lck(mtx);
+        return done;
+    }
+
+    const std::string& CatchUp::getConflict() const {
+        return conflict;
+    }
+
+    bool CatchUp::checkConflicts(const std::unordered_map<LobId, Xid>& mainLobIdToXidMap) {
+        if (!conflict.empty())
+            return true;
+
+        if (deferredLob && (!lobMisses.empty() || !lobMapped.empty())) {
+            setConflict("lob index of a transaction started earlier");
+            return true;
+        }
+
+        for (const LobId& lobId: lobMisses) {
+            if (mainLobIdToXidMap.find(lobId) != mainLobIdToXidMap.end()) {
+                setConflict("lob " + lobId.lower() + " belongs to a transaction started earlier");
+                return true;
+            }
+        }
+
+        for (const LobId& lobId: lobMapped) {
+            if (mainLobIdToXidMap.find(lobId) != mainLobIdToXidMap.end() || mainTransactionBuffer->hasOrphanedLob(lobId)) {
+                setConflict("lob " + lobId.lower() + " was used before");
+                return true;
+            }
+        }
+
+        for (const XidMap xidMap: begins) {
+            if (mainTransactionBuffer->getTransaction(xidMap) != nullptr) {
+                setConflict("transaction slot reused");
+                return true;
+            }
+        }
+
+        for (const CatchUpEvent& event: events) {
+            if (event.type != CatchUpEvent::TYPE::COMMIT || event.transaction != nullptr)
+                continue;
+
+            const RedoLogRecord* redoLogRecord1 = event.redoLogRecord1();
+            const XidMap xidMap = (redoLogRecord1->xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord1->conId) << 32);
+            const Transaction* transaction = mainTransactionBuffer->getTransaction(xidMap);
+            if (transaction != nullptr && transaction->system && (redoLogRecord1->flg & OpCode::FLG_ROLLBACK_OP0504) == 0) {
+                setConflict("commit of system transaction " + transaction->xid.toString());
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void CatchUp::waitDone(Thread* t) {
+        t->contextSet(CONTEXT::WAIT, REASON::CATCH_UP_WAIT);
+        {
+            std::unique_lock lck(mtx);
+            while (!done)
+                condDone.wait(lck);
+        }
+        t->contextSet(CONTEXT::CPU);
+    }
+
+    void CatchUp::addCheckpoint(Scn lwnScn, Time lwnTimestamp, FileOffset fileOffset, uint64_t bytes, bool switchRedo) {
+        CatchUpEvent event;
+        event.type = CatchUpEvent::TYPE::CHECKPOINT;
+        event.switchRedo = switchRedo;
+        event.lwnScn = lwnScn;
+        event.lwnTimestamp = lwnTimestamp;
+        event.fileOffset = fileOffset;
+        event.bytes = bytes;
+        if (!switchRedo)
+            transactionBuffer->checkpoint(event.minSequence, event.minFileOffset, event.minXid);
+        events.push_back(event);
+    }
+
+    void CatchUp::addCommit(Transaction* transaction, const RedoLogRecord* redoLogRecord1, Scn lwnScn, Time lwnTimestamp) {
+        CatchUpEvent event;
+        event.type = CatchUpEvent::TYPE::COMMIT;
+        event.transaction = transaction;
+        event.data1 = TransactionBuffer::allocateLob(redoLogRecord1);
+        event.lwnScn = lwnScn;
+        event.lwnTimestamp = lwnTimestamp;
+        events.push_back(event);
+    }
+
+    void CatchUp::addDeferred(CatchUpEvent::TYPE type, const RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2, Scn lwnScn,
+                              Time lwnTimestamp) {
+        CatchUpEvent event;
+        event.type = type;
+        event.lwnScn = lwnScn;
+        event.lwnTimestamp = lwnTimestamp;
+        event.data1 = TransactionBuffer::allocateLob(redoLogRecord1);
+        if (redoLogRecord2 != nullptr)
+            event.data2 = TransactionBuffer::allocateLob(redoLogRecord2);
+        events.push_back(event);
+    }
+
+    void CatchUp::freeEvents() {
+        for (CatchUpEvent& event: events) {
+            delete[] event.data1;
+            delete[] event.data2;
+            if (event.transaction != nullptr) {
+                event.transaction->purge(ctx);
+                delete event.transaction;
+            }
+        }
+        events.clear();
+    }
+
+    void CatchUp::run() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "catch-up (" + ss.str() + ") start");
+        }
+
+        try {
+            reader->fileName = parser->path;
+            if (!reader->checkRedoLog() || !reader->updateRedoLog())
+                setConflict("file not ready");
+            else if (reader->getSequence() != parser->sequence || reader->getNextScn() == Scn::none())
+                setConflict("file not complete");
+            else {
+                parser->reader = reader;
+                ret = parser->parse();
+                if (ret != Reader::REDO_CODE::FINISHED)
+                    setConflict("parsing returned: " + std::string(Reader::REDO_MSG[static_cast<uint>(ret)]));
+            }
+        } catch (DataException& ex) {
+            setConflict(ex.msg);
+        } catch (RedoLogException& ex) {
+            setConflict(ex.msg);
+        } catch (RuntimeException& ex) {
+            setConflict(ex.msg);
+        } catch (std::bad_alloc& ex) {
+            setConflict("memory allocation failed: " + std::string(ex.what()));
+        }
+
+        // Release read buffers of an interrupted file
+        if (ret != Reader::REDO_CODE::FINISHED && !ctx->softShutdown && reader->checkRedoLog())
+            static_cast<void>(reader->updateRedoLog());
+
+        {
+            contextSet(CONTEXT::MUTEX, REASON::CATCH_UP_DONE);
+            std::unique_lock const lck(mtx);
+            done = true;
+            condDone.notify_all();
+        }
+        contextSet(CONTEXT::CPU);
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "catch-up (" + ss.str() + ") stop");
+        }
+    }
+}
@@ -0,0 +1,130 @@
+/* Header for CatchUp class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef CATCH_UP_H_
+#define CATCH_UP_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/RedoLogRecord.h"
+#include "../common/Thread.h"
+#include "../common/types/FileOffset.h"
+#include "../common/types/LobId.h"
+#include "../common/types/Scn.h"
+#include "../common/types/Seq.h"
+#include "../common/types/Time.h"
+#include "../common/types/Xid.h"
+#include "../reader/Reader.h"
+
+namespace OpenLogReplicator {
+    class Parser;
+    class Transaction;
+    class TransactionBuffer;
+
+    // Output of a worker which is replayed in redo order during the merge
+    struct CatchUpEvent {
+        enum class TYPE : unsigned char {
+            CHECKPOINT,
+            COMMIT,
+            ATTRIBUTES,
+            DDL,
+            LOB,
+            UNDO,
+            UNDO_PAIR,
+            ROLLBACK,
+            ROLLBACK_PAIR,
+            INDEX
+        };
+
+        TYPE type;
+        bool switchRedo{false};
+        // COMMIT: transaction started in the file
+        Transaction* transaction{nullptr};
+        // Copies of redo log records, allocated by TransactionBuffer::allocateLob()
+        uint8_t* data1{nullptr};
+        uint8_t* data2{nullptr};
+        Scn lwnScn;
+        Time lwnTimestamp{0};
+        // CHECKPOINT: position and oldest transaction open in the file
+        FileOffset fileOffset;
+        uint64_t bytes{0};
+        Seq minSequence{Seq::none()};
+        FileOffset minFileOffset;
+        Xid minXid;
+
+        [[nodiscard]] RedoLogRecord* redoLogRecord1() const;
+        [[nodiscard]] RedoLogRecord* redoLogRecord2() const;
+    };
+
+    // Parses one archived redo log in a separate thread while older files are merged. Records of transactions which
+    // started in earlier files are not processed, but deferred and replayed in order by the merge.
+    class CatchUp final : public Thread {
+    protected:
+        std::mutex mtx;
+        std::condition_variable condDone;
+        bool done{false};
+        std::string conflict;
+
+        void run() override;
+
+    public:
+        Parser* parser;
+        Reader* reader;
+        TransactionBuffer* transactionBuffer;
+        TransactionBuffer* mainTransactionBuffer;
+        Scn schemaScn;
+        Reader::REDO_CODE ret{Reader::REDO_CODE::OK};
+        std::atomic<bool> head{false};
+        std::atomic<bool> stop{false};
+
+        std::unordered_map<LobId, Xid> lobIdToXidMap;
+        std::vector<LobId> lobMisses;
+        std::vector<LobId> lobMapped;
+        std::vector<XidMap> begins;
+        std::vector<CatchUpEvent> events;
+        std::vector<Transaction*> dropped;
+        bool deferredLob{false};
+
+        CatchUp(Ctx* newCtx, std::string newAlias, Parser* newParser, Reader* newReader, TransactionBuffer* newMainTransactionBuffer,
+                Scn newSchemaScn);
+        ~CatchUp() override;
+
+        void setConflict(const std::string& reason);
+        [[nodiscard]] bool isStopped() const;
+        [[nodiscard]] bool isDone();
+        [[nodiscard]] const std::string& getConflict() const;
+        [[nodiscard]] bool checkConflicts(const std::unordered_map<LobId, Xid>& mainLobIdToXidMap);
+        void waitDone(Thread* t);
+        void addCheckpoint(Scn lwnScn, Time lwnTimestamp, FileOffset fileOffset, uint64_t bytes, bool switchRedo);
+        void addCommit(Transaction* transaction, const RedoLogRecord* redoLogRecord1, Scn lwnScn, Time lwnTimestamp);
+        void addDeferred(CatchUpEvent::TYPE type, const RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2, Scn lwnScn,
+                         Time lwnTimestamp);
+        void freeEvents();
+
+        std::string getName() const override {
+            return {"CatchUp: " + alias};
+        }
+    };
+}
+
+#endif
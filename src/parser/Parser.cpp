@@ -45,7 +45,9 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../common/XmlCtx.h"
 #include "../common/exception/RedoLogException.h"
 #include "../common/metrics/Metrics.h"
+#include "../metadata/LwnSummary.h"
 #include "../metadata/Metadata.h"
+#include "../metadata/RedoIndex.h"
 #include "../metadata/Schema.h"
 #include "../reader/Reader.h"
 #include "OpCode0501.h"
@@ -73,6 +75,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "OpCode1A02.h"
 #include "OpCode1A06.h"
 #include "Parser.h"
+#include "RedoThread.h"
 #include "Transaction.h"
 #include "TransactionBuffer.h"
 
@@ -83,11 +86,13 @@ namespace OpenLogReplicator {
             builder(newBuilder),
             metadata(newMetadata),
             transactionBuffer(newTransactionBuffer),
+            parserThread(newCtx->parserThread),
+            lobIdToXidMap(&newCtx->lobIdToXidMap),
             group(newGroup),
             path(std::move(newPath)) {
         zero.clear();
-        lwnChunks[0] = ctx->getMemoryChunk(ctx->parserThread, Ctx::MEMORY::PARSER);
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        lwnChunks[0] = ctx->getMemoryChunk(parserThread, Ctx::MEMORY::PARSER);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
         auto* size = reinterpret_cast<uint64_t*>(lwnChunks[0]);
         *size = sizeof(uint64_t);
         lwnAllocated = 1;
@@ -97,13 +102,13 @@ namespace OpenLogReplicator {
 
     Parser::~Parser() {
         while (lwnAllocated > 0) {
-            ctx->freeMemoryChunk(ctx->parserThread, Ctx::MEMORY::PARSER, lwnChunks[--lwnAllocated]);
+            ctx->freeMemoryChunk(parserThread, Ctx::MEMORY::PARSER, lwnChunks[--lwnAllocated]);
         }
     }
 
     void Parser::freeLwn() {
         while (lwnAllocated > 1) {
-            ctx->freeMemoryChunk(ctx->parserThread, Ctx::MEMORY::PARSER, lwnChunks[--lwnAllocated]);
+            ctx->freeMemoryChunk(parserThread, Ctx::MEMORY::PARSER, lwnChunks[--lwnAllocated]);
         }
 
         auto* size = reinterpret_cast<uint64_t*>(lwnChunks[0]);
@@ -338,11 +343,15 @@ namespace OpenLogReplicator {
                     case 0x0513:
                         // Session information
                         OpCode0513::process0513(ctx, &redoLogRecord[vectorCur], lastTransaction);
+                        if (catchUp != nullptr && lastDeferred)
+                            catchUp->addDeferred(CatchUpEvent::TYPE::ATTRIBUTES, &redoLogRecord[vectorCur], nullptr, lwnScn, lwnTimestamp);
                         break;
 
                     // Session information
                     case 0x0514:
                         OpCode0514::process0514(ctx, &redoLogRecord[vectorCur], lastTransaction);
+                        if (catchUp != nullptr && lastDeferred)
+                            catchUp->addDeferred(CatchUpEvent::TYPE::ATTRIBUTES, &redoLogRecord[vectorCur], nullptr, lwnScn, lwnTimestamp);
                         break;
 
                     case 0x0A02:
@@ -490,6 +499,9 @@ namespace OpenLogReplicator {
                         break;
                 }
 
+            if (lwnSummaryValid)
+                summarizeVector(&redoLogRecord[vectorCur], vectorPrev != -1 ? &redoLogRecord[vectorPrev] : nullptr);
+
             if (vectorPrev != -1) {
                 if (redoLogRecord[vectorPrev].opCode == 0x0501) {
                     if ((redoLogRecord[vectorCur].opCode & 0xFF00) == 0x0A00 || redoLogRecord[vectorCur].opCode == 0x1A02) {
@@ -583,17 +595,20 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, redoLogRecord1->xid, redoLogRecord1->conId,
                                                                       redoLogRecord1->thread, true,
                                                                       ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS), false);
-        if (transaction == nullptr)
+        if (transaction == nullptr) {
+            if (catchUp != nullptr)
+                deferRecord(CatchUpEvent::TYPE::DDL, redoLogRecord1, nullptr);
             return;
-        lastTransaction = transaction;
+        }
+        setLastTransaction(transaction);
 
         const DbTable* table;
         {
-            ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+            parserThread->contextSet(Thread::CONTEXT::TRAN);
             std::unique_lock const lckTransaction(metadata->mtxTransaction);
             table = metadata->schema->checkTableDict(redoLogRecord1->obj);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
 
         if (table == nullptr) {
             if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_DDL)) {
@@ -610,12 +625,7 @@ namespace OpenLogReplicator {
         // Transaction size limit
         if (ctx->transactionSizeMax > 0 &&
             transaction->size + redoLogRecord1->size + TransactionBuffer::ROW_HEADER_TOTAL >= ctx->transactionSizeMax) {
-            transactionBuffer->skipXidList.insert(transaction->xid);
-            transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
-            transaction->purge(ctx);
-            if (transaction == lastTransaction)
-                lastTransaction = nullptr;
-            delete transaction;
+            skipTransaction(transaction, redoLogRecord1);
             return;
         }
 
@@ -624,12 +634,12 @@ namespace OpenLogReplicator {
 
     void Parser::appendToTransactionLob(RedoLogRecord* redoLogRecord1) {
         DbLob* lob;
-        ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+        parserThread->contextSet(Thread::CONTEXT::TRAN);
         {
             std::unique_lock const lckTransaction(metadata->mtxTransaction);
             lob = metadata->schema->checkLobDict(redoLogRecord1->dataObj);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
 
         if (lob == nullptr) {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
@@ -641,8 +651,10 @@ namespace OpenLogReplicator {
         redoLogRecord1->lobPageSize = lob->checkLobPageSize(redoLogRecord1->dataObj);
 
         if (redoLogRecord1->xid.isEmpty()) {
-            const auto lobIdToXidMapIt = ctx->lobIdToXidMap.find(redoLogRecord1->lobId);
-            if (lobIdToXidMapIt == ctx->lobIdToXidMap.end()) {
+            const auto lobIdToXidMapIt = lobIdToXidMap->find(redoLogRecord1->lobId);
+            if (lobIdToXidMapIt == lobIdToXidMap->end()) {
+                if (catchUp != nullptr)
+                    catchUp->lobMisses.push_back(redoLogRecord1->lobId);
                 transactionBuffer->addOrphanedLob(redoLogRecord1);
                 return;
             }
@@ -657,9 +669,12 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, redoLogRecord1->xid, redoLogRecord1->conId,
                                                                       redoLogRecord1->thread, true,
                                                                       ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS), false);
-        if (transaction == nullptr)
+        if (transaction == nullptr) {
+            if (catchUp != nullptr)
+                deferRecord(CatchUpEvent::TYPE::LOB, redoLogRecord1, nullptr);
             return;
-        lastTransaction = transaction;
+        }
+        setLastTransaction(transaction);
 
         if (lob->table != nullptr && DbTable::isSystemTable(lob->table->options))
             transaction->system = true;
@@ -684,9 +699,12 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, redoLogRecord1->xid, redoLogRecord1->conId,
                                                                       redoLogRecord1->thread, true,
                                                                       ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS), false);
-        if (transaction == nullptr)
+        if (transaction == nullptr) {
+            if (catchUp != nullptr)
+                deferRecord(CatchUpEvent::TYPE::UNDO, redoLogRecord1, nullptr);
             return;
-        lastTransaction = transaction;
+        }
+        setLastTransaction(transaction);
 
         if (redoLogRecord1->opc != 0x0501 && redoLogRecord1->opc != 0x0A16 && redoLogRecord1->opc != 0x0B01) {
             transaction->log(ctx, "opc ", redoLogRecord1);
@@ -694,15 +712,15 @@ namespace OpenLogReplicator {
         }
 
         const DbTable* table;
-        ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+        parserThread->contextSet(Thread::CONTEXT::TRAN);
         {
             std::unique_lock const lckTransaction(metadata->mtxTransaction);
             table = metadata->schema->checkTableDict(redoLogRecord1->obj);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
 
         if (table == nullptr) {
-            if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
+            if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && redoThread == nullptr) {
                 transaction->log(ctx, "tbl ", redoLogRecord1);
                 return;
             }
@@ -716,12 +734,7 @@ namespace OpenLogReplicator {
         // Transaction size limit
         if (ctx->transactionSizeMax > 0 && transaction->size + redoLogRecord1->size + TransactionBuffer::ROW_HEADER_TOTAL >= ctx->transactionSizeMax) {
             transaction->log(ctx, "siz ", redoLogRecord1);
-            transactionBuffer->skipXidList.insert(transaction->xid);
-            transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
-            transaction->purge(ctx);
-            if (transaction == lastTransaction)
-                lastTransaction = nullptr;
-            delete transaction;
+            skipTransaction(transaction, redoLogRecord1);
             return;
         }
 
@@ -739,6 +752,10 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, xid, redoLogRecord1->conId, redoLogRecord1->thread,
                                                                     true, false, true);
         if (transaction == nullptr) {
+            if (catchUp != nullptr) {
+                deferRecord(CatchUpEvent::TYPE::ROLLBACK, redoLogRecord1, nullptr);
+                return;
+            }
             const XidMap xidMap = (xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord1->conId) << 32);
             auto brokenXidMapListIt = transactionBuffer->brokenXidMapList.find(xidMap);
             if (brokenXidMapListIt == transactionBuffer->brokenXidMapList.end()) {
@@ -749,18 +766,18 @@ namespace OpenLogReplicator {
             }
             return;
         }
-        lastTransaction = transaction;
+        setLastTransaction(transaction);
 
         const DbTable* table;
-        ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+        parserThread->contextSet(Thread::CONTEXT::TRAN);
         {
             std::unique_lock const lckTransaction(metadata->mtxTransaction);
             table = metadata->schema->checkTableDict(redoLogRecord1->obj);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
 
         if (table == nullptr) {
-            if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
+            if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && redoThread == nullptr) {
                 transaction->log(ctx, "rls ", redoLogRecord1);
                 return;
             }
@@ -782,14 +799,17 @@ namespace OpenLogReplicator {
         transaction->beginTimestamp = redoLogRecord1->timestamp;
         transaction->beginFileOffset = FileOffset(lwnCheckpointBlock, reader->getBlockSize());
         transaction->log(ctx, "B   ", redoLogRecord1);
-        lastTransaction = transaction;
+        setLastTransaction(transaction);
+
+        if (catchUp != nullptr)
+            catchUp->begins.push_back((redoLogRecord1->xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord1->conId) << 32));
     }
 
     void Parser::appendToTransactionCommit(RedoLogRecord* redoLogRecord1) {
         // Clean LOBs if used
-        for (auto lobIdToXidMapIt = ctx->lobIdToXidMap.cbegin(); lobIdToXidMapIt != ctx->lobIdToXidMap.cend();) {
+        for (auto lobIdToXidMapIt = lobIdToXidMap->cbegin(); lobIdToXidMapIt != lobIdToXidMap->cend();) {
             if (lobIdToXidMapIt->second == redoLogRecord1->xid) {
-                lobIdToXidMapIt = ctx->lobIdToXidMap.erase(lobIdToXidMapIt);
+                lobIdToXidMapIt = lobIdToXidMap->erase(lobIdToXidMapIt);
             } else
                 ++lobIdToXidMapIt;
         }
@@ -810,8 +830,11 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, redoLogRecord1->xid, redoLogRecord1->conId,
                                                                       redoLogRecord1->thread, true,
                                                                       ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS), false);
-        if (unlikely(transaction == nullptr))
+        if (unlikely(transaction == nullptr)) {
+            if (catchUp != nullptr)
+                deferRecord(CatchUpEvent::TYPE::COMMIT, redoLogRecord1, nullptr);
             return;
+        }
 
         transaction->log(ctx, "C   ", redoLogRecord1);
         transaction->commitSequence = redoLogRecord1->sequence;
@@ -820,11 +843,34 @@ namespace OpenLogReplicator {
         if ((redoLogRecord1->flg & OpCode::FLG_ROLLBACK_OP0504) != 0)
             transaction->rollback = true;
 
+        transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
+        setLastTransaction(nullptr);
+
+        // Output is created in order by the replicator thread during the merge
+        if (catchUp != nullptr) {
+            if (transaction->system && !transaction->rollback)
+                catchUp->setConflict("commit of system transaction " + transaction->xid.toString());
+            catchUp->addCommit(transaction, redoLogRecord1, lwnScn, lwnTimestamp);
+            return;
+        }
+
+        // Commits of all redo threads are merged in SCN order by the replicator thread
+        if (redoThread != nullptr) {
+            redoThread->addCommit(transaction, lwnScn, lwnTimestamp);
+            return;
+        }
+
+        commitTransaction(transaction);
+        transaction->purge(ctx);
+        delete transaction;
+    }
+
+    void Parser::commitTransaction(Transaction* transaction) {
         if ((transaction->commitScn > metadata->firstDataScn && !transaction->system) ||
             (transaction->commitScn > metadata->firstSchemaScn && transaction->system)) {
             if (transaction->begin) {
                 transaction->flush(metadata, builder);
-                ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+                parserThread->contextSet(Thread::CONTEXT::CPU);
                 if (ctx->metrics != nullptr) {
                     if (transaction->rollback)
                         ctx->metrics->emitTransactionsRollbackOut(1);
@@ -864,11 +910,6 @@ namespace OpenLogReplicator {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::TRANSACTION)))
                 ctx->logTrace(Ctx::TRACE::TRANSACTION, "skipping transaction already committed: " + transaction->toString(ctx));
         }
-
-        transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
-        transaction->purge(ctx);
-        lastTransaction = nullptr;
-        delete transaction;
     }
 
     void Parser::appendToTransaction(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2) {
@@ -883,9 +924,12 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, redoLogRecord1->xid, redoLogRecord1->conId,
                                                                       redoLogRecord1->thread, true,
                                                                       ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS), false);
-        if (transaction == nullptr)
+        if (transaction == nullptr) {
+            if (catchUp != nullptr)
+                deferRecord(CatchUpEvent::TYPE::UNDO_PAIR, redoLogRecord1, redoLogRecord2);
             return;
-        lastTransaction = transaction;
+        }
+        setLastTransaction(transaction);
 
         typeObj obj;
         if (redoLogRecord1->dataObj != 0) {
@@ -926,15 +970,16 @@ namespace OpenLogReplicator {
             case 0x0B16: {
                 // Logminer support - KDOCMP
                 const DbTable* table;
-                ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+                parserThread->contextSet(Thread::CONTEXT::TRAN);
                 {
                     std::unique_lock const lckTransaction(metadata->mtxTransaction);
                     table = metadata->schema->checkTableDict(obj);
                 }
-                ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+                parserThread->contextSet(Thread::CONTEXT::CPU);
 
+                // A table created by a transaction of another redo thread might not be merged yet, the builder filters the records
                 if (table == nullptr) {
-                    if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
+                    if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && redoThread == nullptr) {
                         transaction->log(ctx, "tbl1", redoLogRecord1);
                         transaction->log(ctx, "tbl2", redoLogRecord2);
                         return;
@@ -961,12 +1006,7 @@ namespace OpenLogReplicator {
             TransactionBuffer::ROW_HEADER_TOTAL >= ctx->transactionSizeMax) {
             transaction->log(ctx, "siz1", redoLogRecord1);
             transaction->log(ctx, "siz2", redoLogRecord2);
-            transactionBuffer->skipXidList.insert(transaction->xid);
-            transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
-            transaction->purge(ctx);
-            if (transaction == lastTransaction)
-                lastTransaction = nullptr;
-            delete transaction;
+            skipTransaction(transaction, redoLogRecord1);
             return;
         }
 
@@ -982,6 +1022,10 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, xid, redoLogRecord2->conId,
                                                                       redoLogRecord1->thread, true, false, true);
         if (transaction == nullptr) {
+            if (catchUp != nullptr) {
+                deferRecord(CatchUpEvent::TYPE::ROLLBACK_PAIR, redoLogRecord1, redoLogRecord2);
+                return;
+            }
             const XidMap xidMap = (xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord2->conId) << 32);
             auto brokenXidMapListIt = transactionBuffer->brokenXidMapList.find(xidMap);
             if (brokenXidMapListIt == transactionBuffer->brokenXidMapList.end()) {
@@ -992,7 +1036,7 @@ namespace OpenLogReplicator {
             }
             return;
         }
-        lastTransaction = transaction;
+        setLastTransaction(transaction);
         redoLogRecord1->xid = transaction->xid;
 
         // Skip list
@@ -1014,15 +1058,15 @@ namespace OpenLogReplicator {
                                    std::to_string(redoLogRecord2->bdba) + "), offset: " + redoLogRecord1->fileOffset.toString());
 
         const DbTable* table;
-        ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+        parserThread->contextSet(Thread::CONTEXT::TRAN);
         {
             std::unique_lock const lckTransaction(metadata->mtxTransaction);
             table = metadata->schema->checkTableDict(obj);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
 
         if (table == nullptr) {
-            if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS)) {
+            if (!ctx->isFlagSet(Ctx::REDO_FLAGS::SCHEMALESS) && redoThread == nullptr) {
                 transaction->log(ctx, "rls1", redoLogRecord1);
                 transaction->log(ctx, "rls2", redoLogRecord2);
                 return;
@@ -1076,9 +1120,14 @@ namespace OpenLogReplicator {
         Transaction* transaction = transactionBuffer->findTransaction(metadata->schema->xmlCtxDefault, redoLogRecord1->xid, redoLogRecord1->conId,
                                                                       redoLogRecord1->thread, true,
                                                                       ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_INCOMPLETE_TRANSACTIONS), false);
-        if (transaction == nullptr)
+        if (transaction == nullptr) {
+            if (catchUp != nullptr) {
+                deferRecord(CatchUpEvent::TYPE::INDEX, redoLogRecord1, redoLogRecord2);
+                catchUp->deferredLob = true;
+            }
             return;
-        lastTransaction = transaction;
+        }
+        setLastTransaction(transaction);
 
         typeDataObj dataObj;
         if (redoLogRecord1->dataObj != 0) {
@@ -1095,12 +1144,12 @@ namespace OpenLogReplicator {
                                    std::to_string(redoLogRecord2->bdba) + "), offset: " + redoLogRecord1->fileOffset.toString());
 
         const DbLob* lob;
-        ctx->parserThread->contextSet(Thread::CONTEXT::TRAN);
+        parserThread->contextSet(Thread::CONTEXT::TRAN);
         {
             std::unique_lock const lckTransaction(metadata->mtxTransaction);
             lob = metadata->schema->checkLobIndexDict(dataObj);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        parserThread->contextSet(Thread::CONTEXT::CPU);
 
         if (lob == nullptr && redoLogRecord2->opCode != 0x1A02) {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
@@ -1140,8 +1189,11 @@ namespace OpenLogReplicator {
                 return;
             }
 
-            auto lobIdToXidMapIt = ctx->lobIdToXidMap.find(redoLogRecord2->lobId);
-            if (lobIdToXidMapIt != ctx->lobIdToXidMap.end()) {
+            auto lobIdToXidMapIt = lobIdToXidMap->find(redoLogRecord2->lobId);
+            if (lobIdToXidMapIt == lobIdToXidMap->end()) {
+                if (catchUp != nullptr)
+                    catchUp->lobMisses.push_back(redoLogRecord2->lobId);
+            } else {
                 const Xid parentXid = lobIdToXidMapIt->second;
 
                 if (parentXid != redoLogRecord1->xid) {
@@ -1157,9 +1209,11 @@ namespace OpenLogReplicator {
                     if (transaction == nullptr) {
                         if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
                             ctx->logTrace(Ctx::TRACE::LOB, "parent transaction not found");
+                        if (catchUp != nullptr)
+                            catchUp->setConflict("parent transaction " + parentXid.toString() + " not found");
                         return;
                     }
-                    lastTransaction = transaction;
+                    setLastTransaction(transaction);
                 }
             }
         } else if (redoLogRecord2->opCode == 0x0A12) {
@@ -1211,11 +1265,13 @@ namespace OpenLogReplicator {
                           std::to_string(redoLogRecord2->lobPageNo) + " ind key: " + ss.str());
         }
 
-        auto lobIdToXidMapIt = ctx->lobIdToXidMap.find(redoLogRecord2->lobId);
-        if (lobIdToXidMapIt == ctx->lobIdToXidMap.end()) {
+        auto lobIdToXidMapIt = lobIdToXidMap->find(redoLogRecord2->lobId);
+        if (lobIdToXidMapIt == lobIdToXidMap->end()) {
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::LOB)))
                 ctx->logTrace(Ctx::TRACE::LOB, "id: " + redoLogRecord2->lobId.lower() + " xid: " + redoLogRecord1->xid.toString() + " MAP");
-            ctx->lobIdToXidMap.insert_or_assign(redoLogRecord2->lobId, redoLogRecord1->xid);
+            lobIdToXidMap->insert_or_assign(redoLogRecord2->lobId, redoLogRecord1->xid);
+            if (catchUp != nullptr)
+                catchUp->lobMapped.push_back(redoLogRecord2->lobId);
             transaction->lobCtx.checkOrphanedLobs(ctx, redoLogRecord2->lobId, redoLogRecord1->xid, redoLogRecord1->fileOffset);
         }
 
@@ -1229,16 +1285,354 @@ namespace OpenLogReplicator {
         // Transaction size limit
         if (ctx->transactionSizeMax > 0 &&
             transaction->size + redoLogRecord1->size + redoLogRecord2->size + TransactionBuffer::ROW_HEADER_TOTAL >= ctx->transactionSizeMax) {
-            transactionBuffer->skipXidList.insert(transaction->xid);
-            transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
+            skipTransaction(transaction, redoLogRecord1);
+            return;
+        }
+
+        transaction->add(metadata, transactionBuffer, redoLogRecord1, redoLogRecord2);
+    }
+
+    void Parser::setLastTransaction(Transaction* transaction) {
+        lastTransaction = transaction;
+        lastDeferred = false;
+    }
+
+    void Parser::skipTransaction(Transaction* transaction, const RedoLogRecord* redoLogRecord1) {
+        transactionBuffer->skipXidList.insert(transaction->xid);
+        transactionBuffer->dropTransaction(redoLogRecord1->xid, redoLogRecord1->conId);
+        if (transaction == lastTransaction)
+            lastTransaction = nullptr;
+
+        // Swapped memory is released by the replicator thread
+        if (catchUp != nullptr) {
+            catchUp->dropped.push_back(transaction);
+            return;
+        }
+        if (redoThread != nullptr) {
+            redoThread->addDropped(transaction);
+            return;
+        }
+
+        transaction->purge(ctx);
+        delete transaction;
+    }
+
+    void Parser::summarizeVector(const RedoLogRecord* redoLogRecord, const RedoLogRecord* redoLogRecordPrev) {
+        switch (redoLogRecord->opCode) {
+            case 0x0501:
+            case 0x0502:
+            case 0x0504:
+            case 0x1801:
+                LwnSummary::add(lwnSummary.bloom, (redoLogRecord->xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord->conId) << 32));
+                break;
+
+            case 0x0506:
+            case 0x050B: {
+                // Rollback is matched by the slot of the transaction
+                const Xid xid(redoLogRecord->usn, redoLogRecord->slt, 0);
+                LwnSummary::add(lwnSummary.bloom, (xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord->conId) << 32));
+                break;
+            }
+
+            case 0x0513:
+            case 0x0514:
+                // Session attributes belong to the transaction of the undo before them
+                if (redoLogRecordPrev != nullptr && redoLogRecordPrev->opCode == 0x0501)
+                    LwnSummary::add(lwnSummary.bloom, (redoLogRecordPrev->xid.getData() >> 32) |
+                                    (static_cast<uint64_t>(redoLogRecordPrev->conId) << 32));
+                else
+                    lwnSummaryValid = false;
+                break;
+
+            case 0x1301:
+            case 0x1A02:
+            case 0x1A06:
+                // LOB data can belong to the transaction found by the LOB id, such LWN is always analyzed
+                lwnSummaryValid = false;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void Parser::dropPartialTransactions() {
+        // Transactions not open at the checkpoint were committed before it, parsed only partially and never sent to the output
+        std::vector<Transaction*> dropped;
+        transactionBuffer->dropTransactions(metadata->lwnSummary->getOpenXids(), dropped);
+        metadata->lwnSummary->release();
+
+        for (Transaction* transaction: dropped) {
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::TRANSACTION)))
+                ctx->logTrace(Ctx::TRACE::TRANSACTION, "drop partial: " + transaction->xid.toString());
+
+            for (auto lobIdToXidMapIt = lobIdToXidMap->cbegin(); lobIdToXidMapIt != lobIdToXidMap->cend();) {
+                if (lobIdToXidMapIt->second == transaction->xid)
+                    lobIdToXidMapIt = lobIdToXidMap->erase(lobIdToXidMapIt);
+                else
+                    ++lobIdToXidMapIt;
+            }
+
             transaction->purge(ctx);
-            if (transaction == lastTransaction)
-                lastTransaction = nullptr;
             delete transaction;
+        }
+
+        ctx->info(0, "LWN summary used up to scn: " + lwnScn.toString() + ", dropped " + std::to_string(dropped.size()) +
+                  " partially parsed transactions");
+    }
+
+    void Parser::processCheckpoint(FileOffset fileOffset, uint64_t bytes, Seq minSequence, FileOffset minFileOffset, Xid minXid,
+                                   uint16_t checkpointThread, bool lwnSummaryOpen) {
+        // The indexed position must not skip transactions still open at the LWN, a transaction from an earlier file defers the entry.
+        // Redo parsed again before the first data or with transactions open from before the start would replace entries with later
+        // positions.
+        if (checkpointThread == 0 && lwnScn > metadata->firstDataScn && metadata->redoIndex->sample(sequence, bytes) &&
+                !transactionBuffer->hasPartialTransactions()) {
+            Seq indexSequence = minSequence;
+            FileOffset indexFileOffset = minFileOffset;
+            Xid indexXid = minXid;
+            transactionBuffer->checkpoint(indexSequence, indexFileOffset, indexXid);
+            if (indexSequence == Seq::none())
+                metadata->redoIndex->add(metadata->resetlogs, lwnScn, lwnTimestamp, sequence, fileOffset);
+            else if (indexSequence == sequence)
+                metadata->redoIndex->add(metadata->resetlogs, lwnScn, lwnTimestamp, sequence, indexFileOffset);
+        }
+
+        if (lwnScn > metadata->firstDataScn) {
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
+                ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString());
+            builder->processCheckpoint(sequence, lwnScn, lwnTimestamp, fileOffset, false);
+
+            transactionBuffer->checkpoint(minSequence, minFileOffset, minXid);
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::LWN)))
+                ctx->logTrace(Ctx::TRACE::LWN, "* checkpoint: " + lwnScn.toString());
+            // Transactions open at the checkpoint are stored with the LWN summaries, known only when the whole redo is parsed here
+            std::vector<XidMap> openXids;
+            if (lwnSummaryOpen)
+                transactionBuffer->getXidMaps(openXids);
+            metadata->checkpoint(parserThread, lwnScn, lwnTimestamp, sequence, fileOffset, bytes, minSequence, minFileOffset, minXid,
+                                 checkpointThread, lwnSummaryOpen ? &openXids : nullptr);
+
+            if (ctx->stopCheckpoints > 0 && metadata->isNewData(lwnScn, builder->lwnIdx)) {
+                --ctx->stopCheckpoints;
+                if (ctx->stopCheckpoints == 0) {
+                    ctx->info(0, "shutdown started - exhausted number of checkpoints");
+                    ctx->stopSoft();
+                }
+            }
+            if (ctx->metrics != nullptr)
+                ctx->metrics->emitCheckpointsOut(1);
+        } else {
+            if (ctx->metrics != nullptr)
+                ctx->metrics->emitCheckpointsSkip(1);
+        }
+
+        if (ctx->metrics != nullptr)
+            ctx->metrics->emitBytesParsed(bytes);
+    }
+
+    bool Parser::processSwitchCheckpoint(FileOffset fileOffset) {
+        if (lwnScn > metadata->firstDataScn) {
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
+                ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString() + " with switch");
+            builder->processCheckpoint(sequence, lwnScn, lwnTimestamp, fileOffset, true);
+            if (ctx->metrics != nullptr)
+                ctx->metrics->emitCheckpointsOut(1);
+            return true;
+        }
+
+        if (ctx->metrics != nullptr)
+            ctx->metrics->emitCheckpointsSkip(1);
+        return false;
+    }
+
+    bool Parser::isSystemObject(const RedoLogRecord* redoLogRecord) const {
+        bool system = false;
+        parserThread->contextSet(Thread::CONTEXT::TRAN);
+        {
+            std::unique_lock const lckTransaction(metadata->mtxTransaction);
+            const DbTable* table = metadata->schema->checkTableDict(redoLogRecord->obj);
+            if (table != nullptr && DbTable::isSystemTable(table->options))
+                system = true;
+
+            const DbLob* lob = metadata->schema->checkLobDict(redoLogRecord->dataObj);
+            if (lob == nullptr)
+                lob = metadata->schema->checkLobIndexDict(redoLogRecord->dataObj);
+            if (lob != nullptr && lob->table != nullptr && DbTable::isSystemTable(lob->table->options))
+                system = true;
+        }
+        parserThread->contextSet(Thread::CONTEXT::CPU);
+        return system;
+    }
+
+    void Parser::deferRecord(CatchUpEvent::TYPE type, const RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2) {
+        // The schema may only change when no other file is parsed
+        if (isSystemObject(redoLogRecord1) || (redoLogRecord2 != nullptr && isSystemObject(redoLogRecord2))) {
+            catchUp->setConflict("change of system table by transaction " + redoLogRecord1->xid.toString());
             return;
         }
 
-        transaction->add(metadata, transactionBuffer, redoLogRecord1, redoLogRecord2);
+        catchUp->addDeferred(type, redoLogRecord1, redoLogRecord2, lwnScn, lwnTimestamp);
+        lastTransaction = nullptr;
+        lastDeferred = true;
+    }
+
+    void Parser::setCatchUp(CatchUp* newCatchUp) {
+        if (newCatchUp != nullptr) {
+            transactionBuffer = newCatchUp->transactionBuffer;
+            parserThread = newCatchUp;
+            lobIdToXidMap = &newCatchUp->lobIdToXidMap;
+        } else if (catchUp != nullptr) {
+            transactionBuffer = catchUp->mainTransactionBuffer;
+            parserThread = ctx->parserThread;
+            lobIdToXidMap = &ctx->lobIdToXidMap;
+            // Parsing might have been interrupted in the middle of an LWN
+            freeLwn();
+        }
+        catchUp = newCatchUp;
+        lastTransaction = nullptr;
+        lastDeferred = false;
+    }
+
+    void Parser::merge(CatchUp* finishedCatchUp) {
+        // LOB pages not matched in the file are available for the older transactions
+        transactionBuffer->adoptOrphanedLobs(finishedCatchUp->transactionBuffer);
+
+        for (CatchUpEvent& event: finishedCatchUp->events) {
+            lwnScn = event.lwnScn;
+            lwnTimestamp = event.lwnTimestamp;
+
+            switch (event.type) {
+                case CatchUpEvent::TYPE::CHECKPOINT:
+                    lastTransaction = nullptr;
+                    if (event.switchRedo)
+                        processSwitchCheckpoint(event.fileOffset);
+                    else
+                        processCheckpoint(event.fileOffset, event.bytes, event.minSequence, event.minFileOffset, event.minXid);
+                    break;
+
+                case CatchUpEvent::TYPE::COMMIT:
+                    if (event.transaction != nullptr) {
+                        const RedoLogRecord* redoLogRecord1 = event.redoLogRecord1();
+                        const XidMap xidMap = (redoLogRecord1->xid.getData() >> 32) | (static_cast<uint64_t>(redoLogRecord1->conId) << 32);
+                        transactionBuffer->brokenXidMapList.erase(xidMap);
+
+                        Transaction* transaction = event.transaction;
+                        event.transaction = nullptr;
+                        commitTransaction(transaction);
+                        transaction->purge(ctx);
+                        delete transaction;
+                        lastTransaction = nullptr;
+                    } else
+                        appendToTransactionCommit(event.redoLogRecord1());
+                    break;
+
+                case CatchUpEvent::TYPE::ATTRIBUTES:
+                    if (event.redoLogRecord1()->opCode == 0x0513)
+                        OpCode0513::process0513(ctx, event.redoLogRecord1(), lastTransaction);
+                    else
+                        OpCode0514::process0514(ctx, event.redoLogRecord1(), lastTransaction);
+                    break;
+
+                case CatchUpEvent::TYPE::DDL:
+                    appendToTransactionDdl(event.redoLogRecord1());
+                    break;
+
+                case CatchUpEvent::TYPE::LOB:
+                    appendToTransactionLob(event.redoLogRecord1());
+                    break;
+
+                case CatchUpEvent::TYPE::UNDO:
+                    appendToTransaction(event.redoLogRecord1());
+                    break;
+
+                case CatchUpEvent::TYPE::UNDO_PAIR:
+                    appendToTransaction(event.redoLogRecord1(), event.redoLogRecord2());
+                    break;
+
+                case CatchUpEvent::TYPE::ROLLBACK:
+                    appendToTransactionRollback(event.redoLogRecord1());
+                    break;
+
+                case CatchUpEvent::TYPE::ROLLBACK_PAIR:
+                    appendToTransactionRollback(event.redoLogRecord1(), event.redoLogRecord2());
+                    break;
+
+                case CatchUpEvent::TYPE::INDEX:
+                    appendToTransactionIndex(event.redoLogRecord1(), event.redoLogRecord2());
+                    break;
+            }
+
+            delete[] event.data1;
+            event.data1 = nullptr;
+            delete[] event.data2;
+            event.data2 = nullptr;
+        }
+        finishedCatchUp->events.clear();
+
+        // Transactions still open at the end of the file
+        transactionBuffer->adoptTransactions(finishedCatchUp->transactionBuffer);
+        for (const auto& [lobId, xid]: finishedCatchUp->lobIdToXidMap)
+            lobIdToXidMap->insert_or_assign(lobId, xid);
+        finishedCatchUp->lobIdToXidMap.clear();
+
+        builder->flush();
+    }
+
+    void Parser::setRedoThread(RedoThread* newRedoThread) {
+        if (newRedoThread != nullptr) {
+            transactionBuffer = newRedoThread->transactionBuffer;
+            parserThread = newRedoThread;
+            lobIdToXidMap = &newRedoThread->lobIdToXidMap;
+        } else if (redoThread != nullptr)
+            // Parsing might have been interrupted in the middle of an LWN
+            freeLwn();
+        redoThread = newRedoThread;
+        lastTransaction = nullptr;
+    }
+
+    void Parser::merge(const RedoThread* mergedRedoThread, RedoThreadEvent& event) {
+        lwnScn = event.lwnScn;
+        lwnTimestamp = event.lwnTimestamp;
+        lastTransaction = nullptr;
+
+        switch (event.type) {
+            case RedoThreadEvent::TYPE::CHECKPOINT:
+                sequence = event.sequence;
+                if (event.switchRedo) {
+                    // The position of the redo thread moves to the beginning of the next archived redo log
+                    if (processSwitchCheckpoint(event.fileOffset)) {
+                        Seq minSequence = event.minSequence;
+                        FileOffset minFileOffset = event.minFileOffset;
+                        if (minSequence == Seq::none()) {
+                            minSequence = event.sequence;
+                            ++minSequence;
+                            minFileOffset = FileOffset::zero();
+                        }
+                        metadata->checkpoint(parserThread, lwnScn, lwnTimestamp, event.sequence, event.fileOffset, 0, minSequence, minFileOffset,
+                                             event.minXid, mergedRedoThread->thread);
+                    }
+                    builder->flush();
+                } else
+                    processCheckpoint(event.fileOffset, event.bytes, event.minSequence, event.minFileOffset, event.minXid, mergedRedoThread->thread);
+
+                if (ctx->metrics != nullptr)
+                    ctx->metrics->emitRedoThreadLag(ctx->clock->getTimeT() - lwnTimestamp.toEpoch(ctx->hostTimezone), mergedRedoThread->thread);
+                break;
+
+            case RedoThreadEvent::TYPE::COMMIT:
+                commitTransaction(event.transaction);
+                event.transaction->purge(ctx);
+                delete event.transaction;
+                event.transaction = nullptr;
+                break;
+
+            case RedoThreadEvent::TYPE::DROP:
+                event.transaction->purge(ctx);
+                delete event.transaction;
+                event.transaction = nullptr;
+                break;
+        }
     }
 
     void Parser::dumpRedoVector(const uint8_t* data, typeSize recordSize) const {
@@ -1265,7 +1659,10 @@ namespace OpenLogReplicator {
             firstScn = reader->getFirstScn();
             nextScn = reader->getNextScn();
         }
-        ctx->suppLogSize = 0;
+        if (catchUp == nullptr && redoThread == nullptr) {
+            ctx->suppLogSize = 0;
+            builder->lwnReadTime = 0;
+        }
 
         if (reader->getBufferStart() == FileOffset(2, reader->getBlockSize())) {
             if (unlikely(ctx->dumpRedoLog >= 1)) {
@@ -1283,19 +1680,35 @@ namespace OpenLogReplicator {
         }
 
         // Continue started offset
-        if (metadata->fileOffset > FileOffset::zero()) {
-            if (unlikely(!metadata->fileOffset.matchesBlockSize(reader->getBlockSize())))
-                throw RedoLogException(50047, "incorrect offset start: " + metadata->fileOffset.toString() +
+        FileOffset* startFileOffset = nullptr;
+        if (redoThread != nullptr)
+            startFileOffset = &redoThread->fileOffset;
+        else if (catchUp == nullptr)
+            startFileOffset = &metadata->fileOffset;
+        if (startFileOffset != nullptr && *startFileOffset > FileOffset::zero()) {
+            if (unlikely(!startFileOffset->matchesBlockSize(reader->getBlockSize())))
+                throw RedoLogException(50047, "incorrect offset start: " + startFileOffset->toString() +
                                        " - not a multiplication of block size: " + std::to_string(reader->getBlockSize()));
 
-            lwnConfirmedBlock = metadata->fileOffset.getBlock(reader->getBlockSize());
+            lwnConfirmedBlock = startFileOffset->getBlock(reader->getBlockSize());
             if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
-                ctx->logTrace(Ctx::TRACE::CHECKPOINT, "setting reader start position to " + metadata->fileOffset.toString() + " (block " +
+                ctx->logTrace(Ctx::TRACE::CHECKPOINT, "setting reader start position to " + startFileOffset->toString() + " (block " +
                               std::to_string(lwnConfirmedBlock) + ")");
-            metadata->fileOffset = FileOffset::zero();
+            *startFileOffset = FileOffset::zero();
+        }
+        // Keep blocks already buffered by the read-ahead of this file
+        if (reader->isReadAhead() && reader->getBufferStart() == FileOffset(lwnConfirmedBlock, reader->getBlockSize()))
+            reader->setReadAhead(0);
+        else {
+            // Read-ahead from another offset is discarded, checking the file again stops the reading
+            if (reader->isReadAhead()) {
+                reader->setReadAhead(0);
+                if (!reader->checkRedoLog() || !reader->updateRedoLog())
+                    return reader->getRet();
+            }
+            reader->setBufferStartEnd(FileOffset(lwnConfirmedBlock, reader->getBlockSize()),
+                                      FileOffset(lwnConfirmedBlock, reader->getBlockSize()));
         }
-        reader->setBufferStartEnd(FileOffset(lwnConfirmedBlock, reader->getBlockSize()),
-                                  FileOffset(lwnConfirmedBlock, reader->getBlockSize()));
 
         ctx->info(0, "processing redo log: " + toString() + " offset: " + reader->getBufferStart().toString());
         if (ctx->isFlagSet(Ctx::REDO_FLAGS::ADAPTIVE_SCHEMA) && !metadata->schema->loaded && !ctx->versionStr.empty()) {
@@ -1303,6 +1716,13 @@ namespace OpenLogReplicator {
             metadata->schema->loaded = true;
         }
 
+        // Changes of incarnation are left for the replicator thread
+        if (catchUp != nullptr && (metadata->resetlogs != reader->getResetlogs() ||
+                                   (reader->getActivation() != 0 && metadata->activation != reader->getActivation()))) {
+            catchUp->setConflict("new resetlogs or activation");
+            return Reader::REDO_CODE::STOPPED;
+        }
+
         if (metadata->resetlogs == 0)
             metadata->setResetlogs(reader->getResetlogs());
 
@@ -1393,8 +1813,8 @@ namespace OpenLogReplicator {
                                 if (unlikely(lwnAllocated == MAX_LWN_CHUNKS))
                                     throw RedoLogException(50052, "all " + std::to_string(MAX_LWN_CHUNKS) + " lwn buffers allocated");
 
-                                lwnChunks[lwnAllocated++] = ctx->getMemoryChunk(ctx->parserThread, Ctx::MEMORY::PARSER);
-                                ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+                                lwnChunks[lwnAllocated++] = ctx->getMemoryChunk(parserThread, Ctx::MEMORY::PARSER);
+                                parserThread->contextSet(Thread::CONTEXT::CPU);
                                 lwnAllocatedMax = std::max(lwnAllocated, lwnAllocatedMax);
                                 recordSize = reinterpret_cast<uint64_t*>(lwnChunks[lwnAllocated - 1]);
                                 *recordSize = sizeof(uint64_t);
@@ -1461,17 +1881,38 @@ namespace OpenLogReplicator {
                     if (unlikely(ctx->isTraceSet(Ctx::TRACE::LWN)))
                         ctx->logTrace(Ctx::TRACE::LWN, "* analyze: " + lwnScn.toString());
 
+                    // The LWN is complete when the read ending at its last block is done
+                    if (group != 0 && ctx->metrics != nullptr)
+                        builder->lwnReadTime = reader->getReadTime(FileOffset(currentBlock, reader->getBlockSize()));
+
+                    if (catchUp == nullptr && redoThread == nullptr) {
+                        // LWNs up to the checkpoint with no change of a transaction open at the checkpoint are not analyzed again
+                        if (metadata->lwnSummary->isActive()) {
+                            if (lwnScn > metadata->lwnSummary->getScn() || lwnScn > metadata->firstDataScn)
+                                dropPartialTransactions();
+                            else if (metadata->lwnSummary->skip(lwnScn, sequence, lwnCheckpointBlock)) {
+                                if (unlikely(ctx->isTraceSet(Ctx::TRACE::LWN)))
+                                    ctx->logTrace(Ctx::TRACE::LWN, "* skip: " + lwnScn.toString());
+                                lwnRecords = 0;
+                            }
+                        }
+
+                        lwnSummaryValid = ctx->isFlagSet(Ctx::REDO_FLAGS::LWN_SUMMARY) && lwnScn > metadata->firstDataScn;
+                        if (lwnSummaryValid)
+                            lwnSummary = {lwnScn, sequence, lwnCheckpointBlock, {}};
+                    }
+
                     while (lwnRecords > 0) {
                         try {
                             analyzeLwn(lwnMembers[1]);
                         } catch (DataException& ex) {
-                            if (ctx->isFlagSet(Ctx::REDO_FLAGS::IGNORE_DATA_ERRORS)) {
+                            if (catchUp == nullptr && ctx->isFlagSet(Ctx::REDO_FLAGS::IGNORE_DATA_ERRORS)) {
                                 ctx->error(ex.code, ex.msg);
                                 ctx->warning(60013, "forced to continue working in spite of error");
                             } else
                                 throw DataException(ex.code, "runtime error, aborting further redo log processing: " + ex.msg);
                         } catch (RedoLogException& ex) {
-                            if (ctx->isFlagSet(Ctx::REDO_FLAGS::IGNORE_DATA_ERRORS)) {
+                            if (catchUp == nullptr && ctx->isFlagSet(Ctx::REDO_FLAGS::IGNORE_DATA_ERRORS)) {
                                 ctx->error(ex.code, ex.msg);
                                 ctx->warning(60013, "forced to continue working in spite of error");
                             } else
@@ -1506,76 +1947,66 @@ namespace OpenLogReplicator {
                         --lwnRecords;
                     }
 
-                    if (lwnScn > metadata->firstDataScn) {
-                        if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
-                            ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString());
-                        builder->processCheckpoint(sequence, lwnScn, lwnTimestamp, FileOffset(currentBlock, reader->getBlockSize()), switchRedo);
-
-                        Seq minSequence = Seq::none();
-                        FileOffset minFileOffset;
-                        Xid minXid;
-                        transactionBuffer->checkpoint(minSequence, minFileOffset, minXid);
-                        if (unlikely(ctx->isTraceSet(Ctx::TRACE::LWN)))
-                            ctx->logTrace(Ctx::TRACE::LWN, "* checkpoint: " + lwnScn.toString());
-                        metadata->checkpoint(ctx->parserThread, lwnScn, lwnTimestamp, sequence, FileOffset(currentBlock, reader->getBlockSize()),
-                                             static_cast<uint64_t>(currentBlock - lwnConfirmedBlock) * reader->getBlockSize(), minSequence,
-                                             minFileOffset, minXid);
-
-                        if (ctx->stopCheckpoints > 0 && metadata->isNewData(lwnScn, builder->lwnIdx)) {
-                            --ctx->stopCheckpoints;
-                            if (ctx->stopCheckpoints == 0) {
-                                ctx->info(0, "shutdown started - exhausted number of checkpoints");
-                                ctx->stopSoft();
-                            }
-                        }
-                        if (ctx->metrics != nullptr)
-                            ctx->metrics->emitCheckpointsOut(1);
-                    } else {
-                        if (ctx->metrics != nullptr)
-                            ctx->metrics->emitCheckpointsSkip(1);
+                    const uint64_t bytes = static_cast<uint64_t>(currentBlock - lwnConfirmedBlock) * reader->getBlockSize();
+                    if (catchUp != nullptr) {
+                        catchUp->addCheckpoint(lwnScn, lwnTimestamp, FileOffset(currentBlock, reader->getBlockSize()), bytes, false);
+                        // Transactions of following files must not exhaust memory needed to finish the oldest one
+                        if (!catchUp->head && ctx->isMemoryLow(parserThread))
+                            catchUp->setConflict("memory low");
+                    } else if (redoThread != nullptr)
+                        redoThread->addCheckpoint(lwnScn, lwnTimestamp, sequence, FileOffset(currentBlock, reader->getBlockSize()), bytes, false);
+                    else {
+                        const bool lwnSummaryOpen = ctx->isFlagSet(Ctx::REDO_FLAGS::LWN_SUMMARY) && lwnScn > metadata->firstDataScn;
+                        processCheckpoint(FileOffset(currentBlock, reader->getBlockSize()), bytes, Seq::none(), FileOffset(), Xid(), 0,
+                                          lwnSummaryOpen);
+                        if (lwnSummaryOpen && lwnSummaryValid)
+                            metadata->lwnSummary->add(lwnSummary);
                     }
 
                     lwnNumCnt = 0;
                     freeLwn();
-
-                    if (ctx->metrics != nullptr)
-                        ctx->metrics->emitBytesParsed((currentBlock - lwnConfirmedBlock) * reader->getBlockSize());
                     lwnConfirmedBlock = currentBlock;
+
+                    if (catchUp != nullptr && catchUp->isStopped())
+                        break;
                 } else if (unlikely(lwnNumCnt > lwnNumMax))
                     throw RedoLogException(50055, "lwn overflow: " + std::to_string(lwnNumCnt) + "/" + std::to_string(lwnNumMax));
 
                 // Free memory
                 if (redoBufferPos == Ctx::MEMORY_CHUNK_SIZE) {
-                    reader->bufferFree(ctx->parserThread, redoBufferNum);
+                    reader->bufferFree(parserThread, redoBufferNum);
                     reader->confirmReadData(confirmedBufferStart);
                 }
             }
 
+            if (catchUp != nullptr && catchUp->isStopped())
+                break;
+
             // Processing finished
             if (!switchRedo && lwnScn > Scn::zero() && confirmedBufferStart == reader->getBufferEnd() && reader->getRet() == Reader::REDO_CODE::FINISHED) {
-                if (lwnScn > metadata->firstDataScn) {
+                if (catchUp != nullptr) {
                     switchRedo = true;
-                    if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
-                        ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString() + " with switch");
-                    builder->processCheckpoint(sequence, lwnScn, lwnTimestamp, FileOffset(currentBlock, reader->getBlockSize()), switchRedo);
-                    if (ctx->metrics != nullptr)
-                        ctx->metrics->emitCheckpointsOut(1);
-                } else {
-                    if (ctx->metrics != nullptr)
-                        ctx->metrics->emitCheckpointsSkip(1);
-                }
+                    catchUp->addCheckpoint(lwnScn, lwnTimestamp, FileOffset(currentBlock, reader->getBlockSize()), 0, true);
+                } else if (redoThread != nullptr) {
+                    switchRedo = true;
+                    redoThread->addCheckpoint(lwnScn, lwnTimestamp, sequence, FileOffset(currentBlock, reader->getBlockSize()), 0, true);
+                } else
+                    switchRedo = processSwitchCheckpoint(FileOffset(currentBlock, reader->getBlockSize()));
             }
 
             if (ctx->softShutdown) {
                 if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
                     ctx->logTrace(Ctx::TRACE::CHECKPOINT, "on: " + lwnScn.toString() + " at exit");
-                builder->processCheckpoint(sequence, lwnScn, lwnTimestamp, FileOffset(currentBlock, reader->getBlockSize()), false);
-                if (ctx->metrics != nullptr)
-                    ctx->metrics->emitCheckpointsOut(1);
+                // Checkpoints of redo threads are written only in SCN order by the replicator thread
+                if (redoThread == nullptr) {
+                    builder->processCheckpoint(sequence, lwnScn, lwnTimestamp, FileOffset(currentBlock, reader->getBlockSize()), false);
+                    if (ctx->metrics != nullptr)
+                        ctx->metrics->emitCheckpointsOut(1);
+                }
 
                 reader->setRet(Reader::REDO_CODE::SHUTDOWN);
             } else {
-                if (reader->checkFinished(ctx->parserThread, confirmedBufferStart)) {
+                if (reader->checkFinished(parserThread, confirmedBufferStart)) {
                     if (reader->getRet() == Reader::REDO_CODE::FINISHED && nextScn == Scn::none() && reader->getNextScn() != Scn::none())
                         nextScn = reader->getNextScn();
                     if (reader->getRet() == Reader::REDO_CODE::STOPPED || reader->getRet() == Reader::REDO_CODE::OVERWRITTEN)
@@ -1637,8 +2068,16 @@ namespace OpenLogReplicator {
             ctx->dumpStream->close();
         }
 
-        builder->flush();
         freeLwn();
+        if (catchUp != nullptr) {
+            if (catchUp->isStopped())
+                return Reader::REDO_CODE::STOPPED;
+            return reader->getRet();
+        }
+        if (redoThread != nullptr)
+            return reader->getRet();
+
+        builder->flush();
         return reader->getRet();
     }
 
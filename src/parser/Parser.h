@@ -21,20 +21,25 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define PARSER_H_
 
 #include <cstddef>
+#include <unordered_map>
 
 #include "../common/Ctx.h"
 #include "../common/RedoLogRecord.h"
+#include "../metadata/LwnSummary.h"
 #include "../reader/Reader.h"
 #include "../common/types/Time.h"
 #include "../common/types/Types.h"
 #include "../common/types/Xid.h"
+#include "CatchUp.h"
 
 namespace OpenLogReplicator {
     class Builder;
     class Metadata;
+    class RedoThread;
     class Transaction;
     class TransactionBuffer;
     class XmlCtx;
+    struct RedoThreadEvent;
 
     struct LwnMember {
         uint16_t pageOffset;
@@ -69,8 +74,13 @@ namespace OpenLogReplicator {
         Builder* builder;
         Metadata* metadata;
         TransactionBuffer* transactionBuffer;
+        Thread* parserThread;
+        CatchUp* catchUp{nullptr};
+        RedoThread* redoThread{nullptr};
+        std::unordered_map<LobId, Xid>* lobIdToXidMap;
         RedoLogRecord zero;
         Transaction* lastTransaction{nullptr};
+        bool lastDeferred{false};
 
         uint8_t* lwnChunks[MAX_LWN_CHUNKS]{};
         LwnMember* lwnMembers[MAX_RECORDS_IN_LWN + 1]{};
@@ -79,6 +89,9 @@ namespace OpenLogReplicator {
         Time lwnTimestamp{0};
         Scn lwnScn;
         typeBlk lwnCheckpointBlock{0};
+        // Transactions of the analyzed LWN, recorded with the checkpoints when LWN summaries are enabled
+        LwnSummary::Entry lwnSummary{};
+        bool lwnSummaryValid{false};
 
         void freeLwn();
         void analyzeLwn(LwnMember* lwnMember);
@@ -92,11 +105,23 @@ namespace OpenLogReplicator {
         void appendToTransaction(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2);
         void appendToTransactionRollback(RedoLogRecord* redoLogRecord1, RedoLogRecord* redoLogRecord2);
         void dumpRedoVector(const uint8_t* data, typeSize recordSize) const;
+        void setLastTransaction(Transaction* transaction);
+        void skipTransaction(Transaction* transaction, const RedoLogRecord* redoLogRecord1);
+        void summarizeVector(const RedoLogRecord* redoLogRecord, const RedoLogRecord* redoLogRecordPrev);
+        void dropPartialTransactions();
+        void commitTransaction(Transaction* transaction);
+        void processCheckpoint(FileOffset fileOffset, uint64_t bytes, Seq minSequence, FileOffset minFileOffset, Xid minXid,
+                               uint16_t checkpointThread = 0, bool lwnSummaryOpen = false);
+        bool processSwitchCheckpoint(FileOffset fileOffset);
+        [[nodiscard]] bool isSystemObject(const RedoLogRecord* redoLogRecord) const;
+        void deferRecord(CatchUpEvent::TYPE type, const RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
 
     public:
         int group;
         std::string path;
         Seq sequence;
+        // Redo thread from the file name, used by the RAC mode (reader: redo-threads)
+        uint16_t thread{0};
         Scn firstScn{Scn::none()};
         Scn nextScn{Scn::none()};
         Reader* reader{nullptr};
@@ -105,6 +130,10 @@ namespace OpenLogReplicator {
         ~Parser();
 
         Reader::REDO_CODE parse();
+        void setCatchUp(CatchUp* newCatchUp);
+        void merge(CatchUp* finishedCatchUp);
+        void setRedoThread(RedoThread* newRedoThread);
+        void merge(const RedoThread* mergedRedoThread, RedoThreadEvent& event);
         [[nodiscard]] std::string toString() const;
     };
 }
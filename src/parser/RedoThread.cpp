@@ -0,0 +1,285 @@
+/* Thread parsing archived redo logs of one redo thread
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <chrono>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "../common/exception/DataException.h"
+#include "../common/exception/RedoLogException.h"
+#include "../common/exception/RuntimeException.h"
+#include "../reader/Reader.h"
+#include "Parser.h"
+#include "RedoThread.h"
+#include "Transaction.h"
+#include "TransactionBuffer.h"
+
+namespace OpenLogReplicator {
+    RedoThread::RedoThread(Ctx* newCtx, std::string newAlias, uint16_t newThread, Reader* newReader, const TransactionBuffer* mainTransactionBuffer,
+                           std::mutex& newMtx, std::condition_variable& newCondMerge, Seq newSequence, FileOffset newFileOffset):
+            Thread(newCtx, std::move(newAlias)),
+            mtx(newMtx),
+            condMerge(newCondMerge),
+            thread(newThread),
+            reader(newReader),
+            transactionBuffer(new TransactionBuffer(newCtx, this)),
+            sequence(newSequence),
+            fileOffset(newFileOffset) {
+        transactionBuffer->skipXidList = mainTransactionBuffer->skipXidList;
+        transactionBuffer->dumpXidList = mainTransactionBuffer->dumpXidList;
+        transactionBuffer->dumpPath = mainTransactionBuffer->dumpPath;
+    }
+
+    RedoThread::~RedoThread() {
+        for (const auto& [_, parser]: files)
+            delete parser;
+        files.clear();
+
+        for (RedoThreadEvent& event: events) {
+            if (event.transaction != nullptr) {
+                event.transaction->purge(ctx);
+                delete event.transaction;
+            }
+        }
+        events.clear();
+
+        transactionBuffer->purge();
+        delete transactionBuffer;
+        transactionBuffer = nullptr;
+    }
+
+    bool RedoThread::addFile(Parser* parser) {
+        std::unique_lock const lck(mtx);
+        if (parser->sequence < sequence || files.find(parser->sequence) != files.end())
+            return false;
+
+        files.insert_or_assign(parser->sequence, parser);
+        // Not idle until the thread checks the new file
+        idle = false;
+        condParse.notify_all();
+        return true;
+    }
+
+    bool RedoThread::isIdle() const {
+        // Assuming the caller holds the lock
+        return idle;
+    }
+
+    void RedoThread::addCheckpoint(Scn lwnScn, Time lwnTimestamp, Seq newSequence, FileOffset newFileOffset, uint64_t bytes, bool switchRedo) {
+        RedoThreadEvent event;
+        event.type = RedoThreadEvent::TYPE::CHECKPOINT;
+        event.switchRedo = switchRedo;
+        event.scn = lwnScn;
+        event.lwnScn = lwnScn;
+        event.lwnTimestamp = lwnTimestamp;
+        event.sequence = newSequence;
+        event.fileOffset = newFileOffset;
+        event.bytes = bytes;
+        transactionBuffer->checkpoint(event.minSequence, event.minFileOffset, event.minXid);
+
+        contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+        {
+            std::unique_lock lck(mtx);
+            events.push_back(event);
+            bound = lwnScn;
+            condMerge.notify_all();
+
+            // Parsing ahead of the other redo threads must not exhaust memory needed to merge them
+            while (!events.empty() && !stop && !ctx->softShutdown && ctx->isMemoryLow(this)) {
+                contextSet(CONTEXT::WAIT, REASON::REDO_THREAD_WAIT);
+                condParse.wait_for(lck, std::chrono::milliseconds(100));
+            }
+        }
+        contextSet(CONTEXT::CPU);
+    }
+
+    void RedoThread::addCommit(Transaction* transaction, Scn lwnScn, Time lwnTimestamp) {
+        RedoThreadEvent event;
+        event.type = RedoThreadEvent::TYPE::COMMIT;
+        event.transaction = transaction;
+        event.scn = transaction->commitScn;
+        event.lwnScn = lwnScn;
+        event.lwnTimestamp = lwnTimestamp;
+
+        contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+        {
+            std::unique_lock const lck(mtx);
+            events.push_back(event);
+            condMerge.notify_all();
+        }
+        contextSet(CONTEXT::CPU);
+    }
+
+    void RedoThread::addDropped(Transaction* transaction) {
+        // Swapped memory is released by the replicator thread, the order doesn't matter
+        RedoThreadEvent event;
+        event.type = RedoThreadEvent::TYPE::DROP;
+        event.transaction = transaction;
+        event.scn = Scn::zero();
+
+        contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+        {
+            std::unique_lock const lck(mtx);
+            events.push_back(event);
+            condMerge.notify_all();
+        }
+        contextSet(CONTEXT::CPU);
+    }
+
+    void RedoThread::notifyParse() {
+        condParse.notify_all();
+    }
+
+    void RedoThread::wakeUp() {
+        std::unique_lock const lck(mtx);
+        condParse.notify_all();
+    }
+
+    Parser* RedoThread::nextFile() {
+        bool reported = false;
+
+        contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+        std::unique_lock lck(mtx);
+        while (!stop && !ctx->softShutdown) {
+            if (!files.empty()) {
+                // Without a checkpoint the thread starts from the first file found
+                if (sequence == Seq::zero())
+                    sequence = files.begin()->first;
+
+                const auto it = files.begin();
+                if (it->first == sequence) {
+                    Parser* parser = it->second;
+                    files.erase(it);
+                    ++sequence;
+                    idle = false;
+                    contextSet(CONTEXT::CPU);
+                    return parser;
+                }
+
+                if (!reported) {
+                    ctx->warning(60027, "couldn't find archive log for thread: " + std::to_string(thread) + ", seq: " + sequence.toString() +
+                                 ", found: " + it->first.toString());
+                    reported = true;
+                }
+            }
+
+            idle = true;
+            condMerge.notify_all();
+            contextSet(CONTEXT::WAIT, REASON::REDO_THREAD_WAIT);
+            condParse.wait_for(lck, std::chrono::milliseconds(100));
+        }
+        contextSet(CONTEXT::CPU);
+        return nullptr;
+    }
+
+    void RedoThread::run() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "redo thread " + std::to_string(thread) + " (" + ss.str() + ") start");
+        }
+
+        Parser* parser = nullptr;
+        try {
+            while (!stop && !ctx->softShutdown) {
+                parser = nextFile();
+                if (parser == nullptr)
+                    break;
+
+                reader->fileName = parser->path;
+                uint retry = ctx->archReadTries;
+                while (!ctx->softShutdown) {
+                    if (reader->checkRedoLog() && reader->updateRedoLog())
+                        break;
+
+                    if (retry == 0) {
+                        reader->showHint(this, "", parser->path);
+                        throw RuntimeException(10009, "file: " + parser->path + " - failed to open after " +
+                                               std::to_string(ctx->archReadTries) + " tries");
+                    }
+
+                    ctx->info(0, "archived redo log " + parser->path + " is not ready for read, sleeping " +
+                              std::to_string(ctx->archReadSleepUs) + " us");
+                    contextSet(CONTEXT::SLEEP);
+                    ctx->usleepInt(ctx->archReadSleepUs);
+                    contextSet(CONTEXT::CPU);
+                    --retry;
+                }
+                if (ctx->softShutdown)
+                    break;
+
+                if (unlikely(reader->getThread() != thread || reader->getSequence() != parser->sequence))
+                    throw RuntimeException(10075, "file: " + parser->path + " - contains redo thread: " + std::to_string(reader->getThread()) +
+                                           ", seq: " + reader->getSequence().toString() + ", expected redo thread: " + std::to_string(thread) +
+                                           ", seq: " + parser->sequence.toString());
+
+                parser->setRedoThread(this);
+                parser->reader = reader;
+                const Reader::REDO_CODE ret = parser->parse();
+                if (stop || ctx->softShutdown)
+                    break;
+
+                if (ret != Reader::REDO_CODE::FINISHED)
+                    throw RuntimeException(10047, "archive log processing returned: " + std::string(Reader::REDO_MSG[static_cast<uint>(ret)]) +
+                                           ", code: " + std::to_string(static_cast<uint>(ret)));
+
+                {
+                    contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+                    std::unique_lock const lck(mtx);
+                    // The next file of the thread starts with the next SCN of this one
+                    if (parser->nextScn != Scn::none())
+                        bound = parser->nextScn;
+                    condMerge.notify_all();
+                }
+                contextSet(CONTEXT::CPU);
+
+                delete parser;
+                parser = nullptr;
+            }
+        } catch (DataException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        } catch (RedoLogException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        } catch (RuntimeException& ex) {
+            ctx->error(ex.code, ex.msg);
+            ctx->stopHard();
+        } catch (std::bad_alloc& ex) {
+            ctx->error(10018, "memory allocation failed: " + std::string(ex.what()));
+            ctx->stopHard();
+        }
+
+        delete parser;
+        {
+            contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+            std::unique_lock const lck(mtx);
+            idle = true;
+            condMerge.notify_all();
+        }
+        contextSet(CONTEXT::CPU);
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "redo thread " + std::to_string(thread) + " (" + ss.str() + ") stop");
+        }
+    }
+}
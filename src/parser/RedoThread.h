@@ -0,0 +1,114 @@
+/* Header for RedoThread class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef REDO_THREAD_H_
+#define REDO_THREAD_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "../common/Thread.h"
+#include "../common/types/FileOffset.h"
+#include "../common/types/LobId.h"
+#include "../common/types/Scn.h"
+#include "../common/types/Seq.h"
+#include "../common/types/Time.h"
+#include "../common/types/Xid.h"
+
+namespace OpenLogReplicator {
+    class Parser;
+    class Reader;
+    class Transaction;
+    class TransactionBuffer;
+
+    // Output of a redo thread, merged with the output of the other redo threads in SCN order
+    struct RedoThreadEvent {
+        enum class TYPE : unsigned char {
+            CHECKPOINT,
+            COMMIT,
+            DROP
+        };
+
+        TYPE type;
+        bool switchRedo{false};
+        // COMMIT, DROP: transaction removed from the transaction buffer of the redo thread
+        Transaction* transaction{nullptr};
+        // Order of the merge: commit SCN or LWN SCN
+        Scn scn;
+        Scn lwnScn;
+        Time lwnTimestamp{0};
+        // CHECKPOINT: position after the LWN and oldest transaction open in the redo thread
+        Seq sequence{Seq::none()};
+        FileOffset fileOffset;
+        uint64_t bytes{0};
+        Seq minSequence{Seq::none()};
+        FileOffset minFileOffset;
+        Xid minXid;
+    };
+
+    // Parses archived redo logs of one redo thread of a RAC database (reader: redo-threads). Transactions are assembled by XID in own
+    // transaction buffer, commits and LWN checkpoints are queued in redo order and merged in SCN order by the replicator thread.
+    class RedoThread final : public Thread {
+    protected:
+        std::mutex& mtx;
+        std::condition_variable& condMerge;
+        std::condition_variable condParse;
+        // Archived redo logs of the thread waiting for parsing
+        std::map<Seq, Parser*> files;
+        bool idle{false};
+
+        Parser* nextFile();
+        void run() override;
+
+    public:
+        uint16_t thread;
+        Reader* reader;
+        TransactionBuffer* transactionBuffer;
+        std::unordered_map<LobId, Xid> lobIdToXidMap;
+        // Next archived redo log to parse and the position to start the first one from
+        Seq sequence;
+        FileOffset fileOffset;
+        // Events with a lower SCN will not follow
+        Scn bound{Scn::zero()};
+        std::deque<RedoThreadEvent> events;
+        std::atomic<bool> stop{false};
+
+        RedoThread(Ctx* newCtx, std::string newAlias, uint16_t newThread, Reader* newReader, const TransactionBuffer* mainTransactionBuffer,
+                   std::mutex& newMtx, std::condition_variable& newCondMerge, Seq newSequence, FileOffset newFileOffset);
+        ~RedoThread() override;
+
+        [[nodiscard]] bool addFile(Parser* parser);
+        [[nodiscard]] bool isIdle() const;
+        void addCheckpoint(Scn lwnScn, Time lwnTimestamp, Seq newSequence, FileOffset newFileOffset, uint64_t bytes, bool switchRedo);
+        void addCommit(Transaction* transaction, Scn lwnScn, Time lwnTimestamp);
+        void addDropped(Transaction* transaction);
+        void notifyParse();
+        void wakeUp() override;
+
+        std::string getName() const override {
+            return {"RedoThread: " + alias};
+        }
+    };
+}
+
+#endif
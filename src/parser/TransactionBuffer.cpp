@@ -30,8 +30,9 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "TransactionBuffer.h"
 
 namespace OpenLogReplicator {
-    TransactionBuffer::TransactionBuffer(Ctx* newCtx):
-        ctx(newCtx) {
+    TransactionBuffer::TransactionBuffer(Ctx* newCtx, Thread* newParserThread):
+        ctx(newCtx),
+        parserThread(newParserThread) {
         buffer[0] = 0;
     }
 
@@ -45,6 +46,13 @@ namespace OpenLogReplicator {
         orphanedLobs.clear();
     }
 
+    Thread* TransactionBuffer::getThread() const {
+        // The buffer of the replicator is used by the thread which is currently parsing
+        if (parserThread != nullptr)
+            return parserThread;
+        return ctx->parserThread;
+    }
+
     void TransactionBuffer::purge() {
         for (const auto& [_, transaction]: xidTransactionMap) {
             transaction->purge(ctx);
@@ -53,6 +61,13 @@ namespace OpenLogReplicator {
         xidTransactionMap.clear();
     }
 
+    Transaction* TransactionBuffer::getTransaction(XidMap xidMap) const {
+        auto xidTransactionMapIt = xidTransactionMap.find(xidMap);
+        if (xidTransactionMapIt == xidTransactionMap.end())
+            return nullptr;
+        return xidTransactionMapIt->second;
+    }
+
     Transaction* TransactionBuffer::findTransaction(XmlCtx* xmlCtx, Xid xid, typeConId conId, uint16_t thread, bool old, bool add, bool rollback) {
         const XidMap xidMap = (xid.getData() >> 32) | ((static_cast<uint64_t>(conId)) << 32);
         Transaction* transaction;
@@ -67,13 +82,14 @@ namespace OpenLogReplicator {
                 return nullptr;
 
             transaction = new Transaction(xid, &orphanedLobs, xmlCtx, thread);
+            Thread* t = getThread();
             {
-                ctx->parserThread->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FIND);
+                t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FIND);
                 std::unique_lock const lck(mtx);
                 xidTransactionMap.insert_or_assign(xidMap, transaction);
             }
-            ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
-            ctx->swappedMemoryInit(ctx->parserThread, xid);
+            t->contextSet(Thread::CONTEXT::CPU);
+            ctx->swappedMemoryInit(t, xid);
 
             if (dumpXidList.find(xid) != dumpXidList.end())
                 transaction->dump = true;
@@ -84,12 +100,44 @@ namespace OpenLogReplicator {
 
     void TransactionBuffer::dropTransaction(Xid xid, typeConId conId) {
         const XidMap xidMap = (xid.getData() >> 32) | (static_cast<uint64_t>(conId) << 32);
+        Thread* t = getThread();
         {
-            ctx->parserThread->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_DROP);
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_DROP);
             std::unique_lock const lck(mtx);
             xidTransactionMap.erase(xidMap);
         }
-        ctx->parserThread->contextSet(Thread::CONTEXT::CPU);
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void TransactionBuffer::dropTransactions(const std::unordered_set<XidMap>& keepXidMaps, std::vector<Transaction*>& dropped) {
+        Thread* t = getThread();
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_DROP);
+            std::unique_lock const lck(mtx);
+            for (auto it = xidTransactionMap.begin(); it != xidTransactionMap.end();) {
+                if (keepXidMaps.find(it->first) != keepXidMaps.end()) {
+                    ++it;
+                    continue;
+                }
+                dropped.push_back(it->second);
+                it = xidTransactionMap.erase(it);
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void TransactionBuffer::getXidMaps(std::vector<XidMap>& xidMaps) const {
+        xidMaps.reserve(xidTransactionMap.size());
+        for (const auto& [xidMap, _]: xidTransactionMap)
+            xidMaps.push_back(xidMap);
+    }
+
+    bool TransactionBuffer::hasPartialTransactions() const {
+        // The begin of the transaction was not parsed, the position of the first change is unknown
+        for (const auto& [_, transaction]: xidTransactionMap)
+            if (transaction->beginSequence == Seq::none())
+                return true;
+        return false;
     }
 
     void TransactionBuffer::addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord) {
@@ -116,7 +164,7 @@ namespace OpenLogReplicator {
 
         // New block
         if (transaction->lastTc == nullptr || transaction->lastTc->size + chunkSize > TransactionChunk::DATA_BUFFER_SIZE)
-            transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryGrow(ctx->parserThread, transaction->xid));
+            transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryGrow(getThread(), transaction->xid));
 
         // Append to the chunk at the end
         auto* lastTc = transaction->lastTc;
@@ -177,7 +225,7 @@ namespace OpenLogReplicator {
 
         // New block
         if (transaction->lastTc == nullptr || transaction->lastTc->size + chunkSize > TransactionChunk::DATA_BUFFER_SIZE)
-            transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryGrow(ctx->parserThread, transaction->xid));
+            transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryGrow(getThread(), transaction->xid));
 
         // Append to the chunk at the end
         auto* lastTc = transaction->lastTc;
@@ -220,7 +268,7 @@ namespace OpenLogReplicator {
         if (likely(lastTc->elements > 0))
             return;
 
-        transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryShrink(ctx->parserThread, transaction->xid));
+        transaction->lastTc = reinterpret_cast<TransactionChunk*>(ctx->swappedMemoryShrink(getThread(), transaction->xid));
     }
 
     void TransactionBuffer::mergeBlocks(uint8_t* mergeBuffer, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2) {
@@ -294,6 +342,40 @@ namespace OpenLogReplicator {
         orphanedLobs.insert_or_assign(lobKey, allocateLob(redoLogRecord1));
     }
 
+    bool TransactionBuffer::hasOrphanedLob(const LobId& lobId) const {
+        auto orphanedLobsIt = orphanedLobs.upper_bound(LobKey(lobId, 0));
+        return orphanedLobsIt != orphanedLobs.end() && orphanedLobsIt->first.lobId == lobId;
+    }
+
+    void TransactionBuffer::adoptOrphanedLobs(TransactionBuffer* other) {
+        for (const auto& [lobKey, data]: other->orphanedLobs) {
+            if (orphanedLobs.find(lobKey) != orphanedLobs.end()) {
+                ctx->warning(60009, "duplicate orphaned lob: " + lobKey.lobId.lower() + ", page: " + std::to_string(lobKey.page));
+                delete[] data;
+                continue;
+            }
+            orphanedLobs.insert_or_assign(lobKey, data);
+        }
+        other->orphanedLobs.clear();
+    }
+
+    void TransactionBuffer::adoptTransactions(TransactionBuffer* other) {
+        Thread* t = getThread();
+        {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::TRANSACTION_FIND);
+            std::unique_lock const lck(mtx);
+            for (const auto& [xidMap, transaction]: other->xidTransactionMap) {
+                transaction->lobCtx.orphanedLobs = &orphanedLobs;
+                xidTransactionMap.insert_or_assign(xidMap, transaction);
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+        other->xidTransactionMap.clear();
+
+        skipXidList.insert(other->skipXidList.begin(), other->skipXidList.end());
+        other->skipXidList.clear();
+    }
+
     uint8_t* TransactionBuffer::allocateLob(const RedoLogRecord* redoLogRecord1) {
         const typeTransactionSize lobSize = redoLogRecord1->size + sizeof(RedoLogRecord) + sizeof(typeTransactionSize);
         auto* data = new uint8_t[lobSize];
@@ -24,6 +24,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <mutex>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "../common/Ctx.h"
 #include "../common/LobKey.h"
@@ -34,6 +36,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../common/types/Xid.h"
 
 namespace OpenLogReplicator {
+    class Thread;
     class Transaction;
     class XmlCtx;
 
@@ -57,30 +60,40 @@ namespace OpenLogReplicator {
 
     protected:
         Ctx* ctx;
+        Thread* parserThread;
         uint8_t buffer[TransactionChunk::DATA_BUFFER_SIZE]{};
 
         std::mutex mtx;
         std::unordered_map<XidMap, Transaction*> xidTransactionMap;
         std::map<LobKey, uint8_t*> orphanedLobs;
 
+        [[nodiscard]] Thread* getThread() const;
+
     public:
         std::set<Xid> skipXidList;
         std::set<Xid> dumpXidList;
         std::set<XidMap> brokenXidMapList;
         std::string dumpPath;
 
-        explicit TransactionBuffer(Ctx* newCtx);
+        explicit TransactionBuffer(Ctx* newCtx, Thread* newParserThread = nullptr);
         ~TransactionBuffer();
 
         void purge();
+        [[nodiscard]] Transaction* getTransaction(XidMap xidMap) const;
         [[nodiscard]] Transaction* findTransaction(XmlCtx* xmlCtx, Xid xid, typeConId conId, uint16_t thread, bool old, bool add, bool rollback);
         void dropTransaction(Xid xid, typeConId conId);
+        void dropTransactions(const std::unordered_set<XidMap>& keepXidMaps, std::vector<Transaction*>& dropped);
+        void getXidMaps(std::vector<XidMap>& xidMaps) const;
+        [[nodiscard]] bool hasPartialTransactions() const;
         void addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord);
         void addTransactionChunk(Transaction* transaction, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
         void rollbackTransactionChunk(Transaction* transaction);
         void mergeBlocks(uint8_t* mergeBuffer, RedoLogRecord* redoLogRecord1, const RedoLogRecord* redoLogRecord2);
         void checkpoint(Seq& minSequence, FileOffset& minFileOffset, Xid& minXid);
         void addOrphanedLob(RedoLogRecord* redoLogRecord1);
+        [[nodiscard]] bool hasOrphanedLob(const LobId& lobId) const;
+        void adoptOrphanedLobs(TransactionBuffer* other);
+        void adoptTransactions(TransactionBuffer* other);
         static uint8_t* allocateLob(const RedoLogRecord* redoLogRecord1);
     };
 }
@@ -178,6 +178,45 @@ namespace OpenLogReplicator {
         return prevRead;
     }
 
+    bool Reader::redoWait(uint64_t us) {
+        contextSet(CONTEXT::SLEEP);
+        ctx->usleepInt(us);
+        contextSet(CONTEXT::CPU);
+        return false;
+    }
+
+    void Reader::tailWait() {
+        // Exponential backoff from redo-read-sleep-min-us to redo-read-sleep-us, reset when data is read
+        if (tailSleepUs == 0)
+            tailSleepUs = ctx->redoReadSleepMinUs;
+        else
+            tailSleepUs = std::min(tailSleepUs * 2, ctx->redoReadSleepUs);
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
+            ctx->logTrace(Ctx::TRACE::SLEEP, "Reader:mainLoop:tail " + std::to_string(tailSleepUs) + " us");
+        tailNotified = redoWait(tailSleepUs);
+    }
+
+    void Reader::addReadTime(uint64_t offset, time_ut time) {
+        // Assuming the caller holds the lock
+        if (group == 0 || ctx->metrics == nullptr)
+            return;
+
+        readTimes.emplace_back(offset, time);
+        if (readTimes.size() > READ_TIMES_MAX)
+            readTimes.pop_front();
+    }
+
+    time_ut Reader::getReadTime(FileOffset fileOffset) {
+        contextSet(CONTEXT::MUTEX, REASON::READER_READ_TIME);
+        std::unique_lock const lck(mtx);
+        while (!readTimes.empty() && readTimes.front().first < fileOffset.getData())
+            readTimes.pop_front();
+        const time_ut time = readTimes.empty() ? 0 : readTimes.front().second;
+        contextSet(CONTEXT::CPU);
+        return time;
+    }
+
     Reader::REDO_CODE Reader::reloadHeaderRead() {
         if (ctx->softShutdown)
             return REDO_CODE::ERROR;
@@ -477,6 +516,7 @@ namespace OpenLogReplicator {
                     std::unique_lock const lck(mtx);
                     bufferEnd += goodBlocks * blockSize;
                     bufferScan = bufferEnd;
+                    addReadTime(bufferEnd, lastReadTime);
                     condParserSleeping.notify_all();
                 }
                 contextSet(CONTEXT::CPU);
@@ -501,6 +541,7 @@ namespace OpenLogReplicator {
     bool Reader::read2() {
         uint maxNumBlock = (bufferScan - bufferEnd) / blockSize;
         uint goodBlocks = 0;
+        time_ut latestReadTime = 0;
         maxNumBlock = std::min<uint64_t>(maxNumBlock, Ctx::MEMORY_CHUNK_SIZE / blockSize);
 
         for (uint numBlock = 0; numBlock < maxNumBlock; ++numBlock) {
@@ -509,6 +550,7 @@ namespace OpenLogReplicator {
 
             const auto* const readTimeP = reinterpret_cast<const time_ut*>(redoBufferList[redoBufferNum] + redoBufferPos);
             if (*readTimeP + static_cast<time_ut>(ctx->redoVerifyDelayUs) < loopTime) {
+                latestReadTime = std::max(latestReadTime, *readTimeP);
                 ++goodBlocks;
             } else {
                 readTime = *readTimeP + static_cast<time_t>(ctx->redoVerifyDelayUs);
@@ -591,6 +633,7 @@ namespace OpenLogReplicator {
                 contextSet(CONTEXT::MUTEX, REASON::READER_READ2);
                 std::unique_lock const lck(mtx);
                 bufferEnd += actualRead;
+                addReadTime(bufferEnd, latestReadTime);
                 condParserSleeping.notify_all();
             }
             contextSet(CONTEXT::CPU);
@@ -657,6 +700,7 @@ namespace OpenLogReplicator {
                 {
                     contextSet(CONTEXT::MUTEX, REASON::READER_SLEEP1);
                     std::unique_lock const lck(mtx);
+                    readTimes.clear();
                     ret = currentRet;
                     status = STATUS::SLEEPING;
                     condParserSleeping.notify_all();
@@ -671,6 +715,9 @@ namespace OpenLogReplicator {
                 readTime = 0;
                 bufferScan = bufferEnd;
                 reachedZero = false;
+                tailSleepUs = 0;
+                tailNotified = false;
+                const bool tail = ctx->redoReadSleepMinUs > 0 && group != 0;
 
                 while (!ctx->softShutdown && status == STATUS::READ) {
                     loopTime = ctx->clock->getTimeUt();
@@ -690,10 +737,10 @@ namespace OpenLogReplicator {
                     }
 
                     // Buffer full?
-                    if (bufferStart + ctx->bufferSizeMax == bufferEnd) {
+                    if (bufferFull()) {
                         contextSet(CONTEXT::MUTEX, REASON::READER_FULL);
                         std::unique_lock lck(mtx);
-                        if (!ctx->softShutdown && bufferStart + ctx->bufferSizeMax == bufferEnd) {
+                        if (!ctx->softShutdown && status == STATUS::READ && bufferFull()) {
                             if (unlikely(ctx->isTraceSet(Ctx::TRACE::SLEEP)))
                                 ctx->logTrace(Ctx::TRACE::SLEEP, "Reader:mainLoop:bufferFull");
                             contextSet(CONTEXT::WAIT, REASON::READER_BUFFER_FULL);
@@ -709,9 +756,12 @@ namespace OpenLogReplicator {
 
                     // #1 read
                     if (bufferScan < fileSize && (bufferIsFree() || (bufferScan % Ctx::MEMORY_CHUNK_SIZE) > 0)
-                        && (!reachedZero || lastReadTime + static_cast<time_t>(ctx->redoReadSleepUs) < loopTime))
+                        && (!reachedZero || (tail && (tailNotified || lastReadTime + static_cast<time_t>(tailSleepUs) <= loopTime)) ||
+                            (!tail && lastReadTime + static_cast<time_t>(ctx->redoReadSleepUs) < loopTime))) {
+                        tailNotified = false;
                         if (!read1())
                             break;
+                    }
 
                     if (numBlocksHeader != Ctx::ZERO_BLK && bufferEnd == static_cast<uint64_t>(numBlocksHeader) * blockSize) {
                         if (nextScnHeader != Scn::none()) {
@@ -726,8 +776,12 @@ namespace OpenLogReplicator {
                     }
 
                     // Sleep some time
-                    if (!readBlocks) {
-                        if (readTime == 0) {
+                    if (readBlocks) {
+                        tailSleepUs = 0;
+                    } else {
+                        if (readTime == 0 && tail) {
+                            tailWait();
+                        } else if (readTime == 0) {
                             contextSet(CONTEXT::SLEEP);
                             ctx->usleepInt(ctx->redoReadSleepUs);
                             contextSet(CONTEXT::CPU);
@@ -751,7 +805,9 @@ namespace OpenLogReplicator {
                 {
                     contextSet(CONTEXT::MUTEX, REASON::READER_SLEEP2);
                     std::unique_lock const lck(mtx);
-                    status = STATUS::SLEEPING;
+                    // A new request (e.g. a check of another file after discarded read-ahead) might have been set meanwhile
+                    if (status == STATUS::READ)
+                        status = STATUS::SLEEPING;
                     condParserSleeping.notify_all();
                 }
                 contextSet(CONTEXT::CPU);
@@ -759,6 +815,13 @@ namespace OpenLogReplicator {
         }
     }
 
+    bool Reader::bufferFull() const {
+        // Read-ahead of a file which is not parsed yet is limited to the configured number of chunks
+        if (bufferReadAhead > 0)
+            return bufferEnd >= bufferStart - (bufferStart % Ctx::MEMORY_CHUNK_SIZE) + bufferReadAhead;
+        return bufferStart + ctx->bufferSizeMax == bufferEnd;
+    }
+
     typeSum Reader::calcChSum(uint8_t* buffer, uint size) const {
         const typeSum oldChSum = ctx->read16(buffer + 14);
         uint64_t sum = 0;
@@ -1082,6 +1145,10 @@ namespace OpenLogReplicator {
         return thread;
     }
 
+    bool Reader::isReadAhead() const {
+        return bufferReadAhead > 0;
+    }
+
     void Reader::setRet(REDO_CODE newRet) {
         ret = newRet;
     }
@@ -1154,6 +1221,16 @@ namespace OpenLogReplicator {
         contextSet(CONTEXT::CPU);
     }
 
+    void Reader::setReadAhead(uint64_t newBufferReadAhead) {
+        {
+            contextSet(CONTEXT::MUTEX, REASON::READER_SET_READ);
+            std::unique_lock const lck(mtx);
+            bufferReadAhead = newBufferReadAhead;
+            condBufferFull.notify_all();
+        }
+        contextSet(CONTEXT::CPU);
+    }
+
     void Reader::confirmReadData(FileOffset confirmedBufferStart) {
         contextSet(CONTEXT::MUTEX, REASON::READER_CONFIRM);
         {
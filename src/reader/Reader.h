@@ -21,6 +21,8 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define READER_H_
 
 #include <atomic>
+#include <deque>
+#include <utility>
 #include <vector>
 
 #include "../common/Thread.h"
@@ -67,6 +69,7 @@ namespace OpenLogReplicator {
 
         static constexpr uint PAGE_SIZE_MAX{4096};
         static constexpr uint BAD_CDC_MAX_CNT{20};
+        static constexpr uint64_t READ_TIMES_MAX{1024};
 
         std::string database;
         int fileCopyDes{-1};
@@ -99,10 +102,16 @@ namespace OpenLogReplicator {
         time_ut lastReadTime{0};
         time_ut readTime{0};
         time_ut loopTime{0};
+        // Adaptive tailing of online redo logs (redo-read-sleep-min-us): current sleep time and a change notified while sleeping
+        uint64_t tailSleepUs{0};
+        bool tailNotified{false};
+        // Time when the data up to the offset was read from an online redo log, used by the redo_latency_us metric
+        std::deque<std::pair<uint64_t, time_ut>> readTimes;
 
         std::mutex mtx;
         std::atomic<uint64_t> bufferStart{0};
         std::atomic<uint64_t> bufferEnd{0};
+        std::atomic<uint64_t> bufferReadAhead{0};
         std::atomic<STATUS> status{STATUS::SLEEPING};
         std::atomic<REDO_CODE> ret{REDO_CODE::OK};
         std::condition_variable condBufferFull;
@@ -114,11 +123,15 @@ namespace OpenLogReplicator {
         virtual int redoRead(uint8_t* buf, uint64_t offset, uint size) = 0;
         virtual uint readSize(uint prevRead);
         virtual REDO_CODE reloadHeaderRead();
+        virtual bool redoWait(uint64_t us);
+        void tailWait();
+        void addReadTime(uint64_t offset, time_ut time);
         REDO_CODE checkBlockHeader(uint8_t* buffer, typeBlk blockNumber, bool showHint);
         REDO_CODE reloadHeader();
         bool read1();
         bool read2();
         void mainLoop();
+        [[nodiscard]] bool bufferFull() const;
 
     public:
         const static char* REDO_MSG[static_cast<uint>(REDO_CODE::CNT)];
@@ -153,12 +166,15 @@ namespace OpenLogReplicator {
         [[nodiscard]] uint64_t getSumRead() const;
         [[nodiscard]] uint64_t getSumTime() const;
         [[nodiscard]] uint16_t getThread() const;
+        [[nodiscard]] bool isReadAhead() const;
+        [[nodiscard]] time_ut getReadTime(FileOffset fileOffset);
 
         void setRet(REDO_CODE newRet);
         void setBufferStartEnd(FileOffset newBufferStart, FileOffset newBufferEnd);
         bool checkRedoLog();
         bool updateRedoLog();
         void setStatusRead();
+        void setReadAhead(uint64_t newBufferReadAhead);
         void confirmReadData(FileOffset confirmedBufferStart);
         [[nodiscard]] bool checkFinished(Thread* t, FileOffset confirmedBufferStart);
         virtual void showHint(Thread* t, std::string origPath, std::string mappedPath) const = 0;
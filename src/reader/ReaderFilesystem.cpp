@@ -27,8 +27,12 @@ enum {
 #include <cstring>
 #include <dirent.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#if __linux__
+#include <sys/inotify.h>
+#endif
 
 #include "../common/Clock.h"
 #include "../common/Ctx.h"
@@ -49,6 +53,10 @@ namespace OpenLogReplicator {
             contextSet(CONTEXT::CPU);
             fileDes = -1;
         }
+        if (notifyDes != -1) {
+            close(notifyDes);
+            notifyDes = -1;
+        }
     }
 
     Reader::REDO_CODE ReaderFilesystem::redoOpen() {
@@ -83,6 +91,19 @@ namespace OpenLogReplicator {
             return REDO_CODE::ERROR;
         }
 
+#if __linux__
+        // Writes to online redo logs wake up the reader, filesystems without notifications (e.g. NFS) fall back to polling
+        if (group != 0 && ctx->redoReadSleepMinUs > 0) {
+            notifyDes = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (notifyDes != -1 && inotify_add_watch(notifyDes, fileName.c_str(), IN_MODIFY) == -1) {
+                close(notifyDes);
+                notifyDes = -1;
+            }
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::FILE)))
+                ctx->logTrace(Ctx::TRACE::FILE, "file: " + fileName + " - write notifications " + (notifyDes != -1 ? "enabled" : "not available"));
+        }
+#endif
+
 #if __APPLE__
         if (!ctx->isFlagSet(Ctx::REDO_FLAGS::DIRECT_DISABLE)) {
             contextSet(CONTEXT::OS, REASON::OS);
@@ -96,6 +117,27 @@ namespace OpenLogReplicator {
         return REDO_CODE::OK;
     }
 
+    bool ReaderFilesystem::redoWait(uint64_t us) {
+        if (notifyDes == -1)
+            return Reader::redoWait(us);
+
+        pollfd pfd{};
+        pfd.fd = notifyDes;
+        pfd.events = POLLIN;
+        contextSet(CONTEXT::SLEEP);
+        const int pollRet = poll(&pfd, 1, static_cast<int>((us + 999) / 1000));
+        contextSet(CONTEXT::CPU);
+        if (pollRet <= 0)
+            return false;
+
+        // Only the fact of a write matters, the events are discarded
+        alignas(8) uint8_t events[4096];
+        contextSet(CONTEXT::OS, REASON::OS);
+        while (read(notifyDes, events, sizeof(events)) > 0) {}
+        contextSet(CONTEXT::CPU);
+        return true;
+    }
+
     int ReaderFilesystem::redoRead(uint8_t* buf, uint64_t offset, uint size) {
         uint64_t startTime = 0;
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::PERFORMANCE)))
@@ -27,9 +27,12 @@ namespace OpenLogReplicator {
     protected:
         int fileDes{-1};
         int flags{0};
+        // Notification of writes to an online redo log (redo-read-sleep-min-us)
+        int notifyDes{-1};
         void redoClose() override;
         REDO_CODE redoOpen() override;
         int redoRead(uint8_t* buf, uint64_t offset, uint size) override;
+        bool redoWait(uint64_t us) override;
 
     public:
         ReaderFilesystem(Ctx* newCtx, std::string newAlias, std::string newDatabase, int newGroup, bool newConfiguredBlockSum);
@@ -18,11 +18,16 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
 #include <cerrno>
+#include <chrono>
 #include <cstddef>
+#include <cstdio>
 #include <dirent.h>
 #include <sys/stat.h>
 #include <thread>
 #include <unistd.h>
+#if __linux__
+#include <sys/inotify.h>
+#endif
 
 #include "../builder/Builder.h"
 #include "../common/Clock.h"
@@ -32,10 +37,14 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../common/exception/RedoLogException.h"
 #include "../common/exception/RuntimeException.h"
 #include "../common/types/Seq.h"
+#include "../metadata/LwnSummary.h"
 #include "../metadata/Metadata.h"
+#include "../metadata/RedoIndex.h"
 #include "../metadata/RedoLog.h"
 #include "../metadata/Schema.h"
+#include "../parser/CatchUp.h"
 #include "../parser/Parser.h"
+#include "../parser/RedoThread.h"
 #include "../parser/Transaction.h"
 #include "../reader/ReaderFilesystem.h"
 #include "Replicator.h"
@@ -53,7 +62,10 @@ namespace OpenLogReplicator {
     }
 
     Replicator::~Replicator() {
+        catchUpDrop();
+        redoThreadsDrop();
         readerDropAll();
+        archIndexReset();
 
         while (!archiveRedoQueue.empty()) {
             const Parser* parser = archiveRedoQueue.top();
@@ -113,6 +125,10 @@ namespace OpenLogReplicator {
         }
 
         archReader = nullptr;
+        archReaderNext = nullptr;
+        archReaderNextSequence = Seq::none();
+        catchUpReaders.clear();
+        catchUpReadersFree.clear();
         readers.clear();
     }
 
@@ -123,10 +139,72 @@ namespace OpenLogReplicator {
     void Replicator::positionReader() {
         if (metadata->startSequence != Seq::none())
             metadata->setSeqFileOffset(metadata->startSequence, FileOffset::zero());
-        else
+        else if (!positionIndex())
             metadata->setSeqFileOffset(Seq(Seq::zero()), FileOffset::zero());
     }
 
+    bool Replicator::positionIndex() {
+        // Without a database connection the start SCN or time is looked up in the redo index, positions of redo threads are not indexed
+        if (redoThreads > 0)
+            return false;
+
+        RedoIndex::Entry entry;
+        if (!metadata->startTime.empty() || metadata->startTimeRel > 0) {
+            time_t time;
+            if (!metadata->startTime.empty()) {
+                int year;
+                int month;
+                int day;
+                int hour;
+                int minute;
+                int second;
+                char end;
+                if (sscanf(metadata->startTime.c_str(), "%4d-%2d-%2d %2d:%2d:%2d%c", &year, &month, &day, &hour, &minute, &second, &end) != 6 ||
+                        year < 1988 || month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 59 ||
+                        hour < 0 || minute < 0 || second < 0)
+                    throw BootException(10080, "can't parse start time: " + metadata->startTime + ", expected format: YYYY-MM-DD HH24:MI:SS");
+                // Same encoding as the redo log timestamps
+                uint64_t value = static_cast<uint64_t>(year - 1988);
+                value = (value * 12) + month - 1;
+                value = (value * 31) + day - 1;
+                value = (value * 24) + hour;
+                value = (value * 60) + minute;
+                value = (value * 60) + second;
+                time = Time(static_cast<uint32_t>(value)).toEpoch(ctx->hostTimezone);
+            } else
+                time = ctx->clock->getTimeT() - static_cast<time_t>(metadata->startTimeRel);
+
+            // Without a checkpoint the incarnation is known only from the index
+            const typeResetlogs resetlogs = metadata->resetlogs != 0 ? metadata->resetlogs : metadata->redoIndex->getResetlogs();
+            if (!metadata->redoIndex->findTime(resetlogs, time, ctx->hostTimezone, entry))
+                throw BootException(10081, "can't find redo log position for start time without database connection, no redo index entry");
+            metadata->firstDataScn = entry.scn;
+
+            // Schema and position come from the last checkpoint before the indexed LWN, like for a start SCN, so that schema changes
+            // committed after the checkpoint are not missed
+            for (auto it = metadata->checkpointScnList.crbegin(); it != metadata->checkpointScnList.crend(); ++it) {
+                if (*it > entry.scn)
+                    continue;
+
+                metadata->readCheckpoint(*it);
+                if (metadata->sequence != Seq::none() && metadata->sequence != Seq::zero()) {
+                    ctx->info(0, "redo index scn for start time: " + entry.scn.toString() + ", starting from checkpoint scn: " + it->toString());
+                    return true;
+                }
+            }
+        } else {
+            if (metadata->firstDataScn == Scn::none() || metadata->firstDataScn == Scn::zero())
+                return false;
+            if (!metadata->redoIndex->findScn(metadata->resetlogs, metadata->firstDataScn, Seq::none(), entry))
+                return false;
+        }
+
+        metadata->setSeqFileOffset(entry.sequence, entry.fileOffset);
+        ctx->info(0, "redo index position for scn: " + metadata->firstDataScn.toString() + " is seq: " + entry.sequence.toString() +
+                  ", offset: " + entry.fileOffset.toString() + ", indexed scn: " + entry.scn.toString());
+        return true;
+    }
+
     void Replicator::verifySchema(Scn currentScn __attribute__((unused))) {
         // Nothing for offline mode
     }
@@ -272,6 +350,8 @@ namespace OpenLogReplicator {
         }
 
         ctx->info(0, "Replicator for: " + database + " is shutting down");
+        catchUpDrop();
+        redoThreadsDrop();
         transactionBuffer->purge();
 
         ctx->replicatorFinished = true;
@@ -286,10 +366,14 @@ namespace OpenLogReplicator {
 
     Reader* Replicator::readerCreate(int group) {
         for (Reader* reader: readers)
-            if (reader->getGroup() == group)
+            if (reader->getGroup() == group && reader != archReaderNext && catchUpReaders.find(reader) == catchUpReaders.end())
                 return reader;
 
-        auto* readerFS = new ReaderFilesystem(ctx, alias + "-reader-" + std::to_string(group), database, group,
+        return readerSpawn(group, alias + "-reader-" + std::to_string(group));
+    }
+
+    Reader* Replicator::readerSpawn(int group, const std::string& name) {
+        auto* readerFS = new ReaderFilesystem(ctx, name, database, group,
                                               metadata->dbBlockChecksum != "OFF" && metadata->dbBlockChecksum != "FALSE");
         readers.insert(readerFS);
         readerFS->initialize();
@@ -344,8 +428,9 @@ namespace OpenLogReplicator {
     // %a - activation id
     // %d - database id
     // %h - some hash
-    Seq Replicator::getSequenceFromFileName(const Replicator* replicator, const std::string& file) {
+    Seq Replicator::getSequenceFromFileName(const Replicator* replicator, const std::string& file, uint16_t& thread) {
         Seq sequence{0};
+        thread = 0;
         size_t i{};
         size_t j{};
 
@@ -372,6 +457,8 @@ namespace OpenLogReplicator {
 
                     if (replicator->metadata->logArchiveFormat[i + 1] == 's' || replicator->metadata->logArchiveFormat[i + 1] == 'S')
                         sequence = Seq(number);
+                    else if (replicator->metadata->logArchiveFormat[i + 1] == 't' || replicator->metadata->logArchiveFormat[i + 1] == 'T')
+                        thread = static_cast<uint16_t>(number);
                     i += 2;
                 } else if (replicator->metadata->logArchiveFormat[i + 1] == 'h') {
                     // Some [0-9a-z]*
@@ -408,6 +495,17 @@ namespace OpenLogReplicator {
         return Seq::zero();
     }
 
+    Seq Replicator::getThreadSequence(uint16_t thread) const {
+        if (redoThreads == 0)
+            return metadata->sequence;
+
+        // Without a position of the redo thread all files found are used
+        const auto it = metadata->redoThreadPositions.find(thread);
+        if (it == metadata->redoThreadPositions.end() || it->second.sequence == Seq::none())
+            return Seq::zero();
+        return it->second.sequence;
+    }
+
     void Replicator::addPathMapping(std::string source, std::string target) {
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::FILE)))
             ctx->logTrace(Ctx::TRACE::FILE, "added mapping [" + source + "] -> [" + target + "]");
@@ -507,12 +605,13 @@ namespace OpenLogReplicator {
                 if (unlikely(replicator->ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
                     replicator->ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "checking path: " + fileName);
 
-                const Seq sequence = getSequenceFromFileName(replicator, ent2->d_name);
+                uint16_t thread;
+                const Seq sequence = getSequenceFromFileName(replicator, ent2->d_name, thread);
 
                 if (unlikely(replicator->ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
                     replicator->ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "found seq: " + sequence.toString());
 
-                if (sequence == Seq::zero() || sequence < replicator->metadata->sequence)
+                if (sequence == Seq::zero() || sequence < replicator->getThreadSequence(thread))
                     continue;
 
                 auto* parser = new Parser(replicator->ctx, replicator->builder, replicator->metadata,
@@ -521,6 +620,7 @@ namespace OpenLogReplicator {
                 parser->firstScn = Scn::none();
                 parser->nextScn = Scn::none();
                 parser->sequence = sequence;
+                parser->thread = thread;
                 replicator->archiveRedoQueue.push(parser);
             }
             closedir(dir2);
@@ -537,6 +637,281 @@ namespace OpenLogReplicator {
         }
     }
 
+    void Replicator::archGetLogPathIndex(Replicator* replicator) {
+        if (replicator->metadata->logArchiveFormat.empty())
+            throw RuntimeException(10044, "missing location of archived redo logs for offline mode");
+
+        std::string mappedPath(replicator->metadata->dbRecoveryFileDest + "/" + replicator->metadata->context + "/archivelog");
+        replicator->applyMapping(mappedPath);
+
+        if (replicator->archIndexInitialized && (mappedPath != replicator->archIndexPath || replicator->archIndexResetlogs != replicator->metadata->resetlogs))
+            replicator->archIndexReset();
+
+        if (!replicator->archIndexInitialized) {
+            replicator->archIndexPath = mappedPath;
+            replicator->archIndexResetlogs = replicator->metadata->resetlogs;
+            replicator->archIndexInitialize();
+        } else {
+            replicator->archIndexReadEvents();
+
+            // Events are not delivered for changes made by other hosts (like NFS), verify directory modification times
+            if (replicator->archIndex.find(replicator->metadata->sequence) == replicator->archIndex.end())
+                replicator->archIndexScanPath(false);
+        }
+
+        if (replicator->metadata->sequence != Seq::zero())
+            replicator->archIndex.erase(replicator->archIndex.begin(), replicator->archIndex.lower_bound(replicator->metadata->sequence));
+        if (replicator->archIndex.empty())
+            return;
+
+        // The queue contains consecutive sequences starting from the current one
+        Seq sequence = replicator->metadata->sequence;
+        auto it = replicator->archIndex.end();
+        if (replicator->archiveRedoQueue.empty()) {
+            it = replicator->archIndex.find(sequence);
+            // Missing sequence, queue the first available to report the gap
+            if (it == replicator->archIndex.end())
+                it = replicator->archIndex.begin();
+        } else if (replicator->archIndexQueued != Seq::none()) {
+            sequence = replicator->archIndexQueued;
+            ++sequence;
+            it = replicator->archIndex.find(sequence);
+        }
+
+        while (it != replicator->archIndex.end()) {
+            if (unlikely(replicator->ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+                replicator->ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "queued seq: " + it->first.toString() + " file: " + it->second);
+
+            auto* parser = new Parser(replicator->ctx, replicator->builder, replicator->metadata,
+                                      replicator->transactionBuffer, 0, it->second);
+            parser->firstScn = Scn::none();
+            parser->nextScn = Scn::none();
+            parser->sequence = it->first;
+            replicator->archiveRedoQueue.push(parser);
+            replicator->archIndexQueued = it->first;
+
+            sequence = it->first;
+            ++sequence;
+            ++it;
+            if (it == replicator->archIndex.end() || it->first != sequence)
+                break;
+        }
+    }
+
+    void Replicator::archIndexReset() {
+#if __linux__
+        if (archIndexNotify != -1) {
+            close(archIndexNotify);
+            archIndexNotify = -1;
+        }
+#endif
+        archIndex.clear();
+        archIndexSeen.clear();
+        archIndexDays.clear();
+        archIndexWatches.clear();
+        archIndexWatchDays.clear();
+        archIndexPathMtime = 0;
+        archIndexScanTime = 0;
+        archIndexPathWatch = -1;
+        archIndexQueued = Seq::none();
+        archIndexInitialized = false;
+    }
+
+    void Replicator::archIndexInitialize() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+            ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "building index of path: " + archIndexPath);
+
+#if __linux__
+        archIndexNotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (archIndexNotify == -1)
+            ctx->warning(60038, "directory: " + archIndexPath + " - inotify initialization returned: " + strerror(errno) +
+                         ", falling back to directory scans");
+        else {
+            archIndexPathWatch = inotify_add_watch(archIndexNotify, archIndexPath.c_str(), IN_CREATE | IN_MOVED_TO | IN_ONLYDIR);
+            if (archIndexPathWatch == -1)
+                ctx->warning(60038, "directory: " + archIndexPath + " - inotify add watch returned: " + strerror(errno) +
+                             ", falling back to directory scans");
+        }
+#endif
+
+        archIndexScanPath(true);
+        archIndexInitialized = true;
+    }
+
+    void Replicator::archIndexAddFile(const std::string& day, const char* file) {
+        std::string fileName(archIndexPath + "/" + day + "/" + file);
+        if (!archIndexSeen.insert(fileName).second)
+            return;
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+            ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "checking path: " + fileName);
+
+        uint16_t thread;
+        const Seq sequence = getSequenceFromFileName(this, file, thread);
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+            ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "found seq: " + sequence.toString());
+
+        if (sequence == Seq::zero() || sequence < metadata->sequence)
+            return;
+
+        archIndex.emplace(sequence, std::move(fileName));
+    }
+
+    void Replicator::archIndexScanDay(const std::string& day) {
+        const std::string dayPath(archIndexPath + "/" + day);
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+            ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "checking path: " + dayPath);
+
+        DIR* dir = opendir(dayPath.c_str());
+        if (dir == nullptr)
+            throw RuntimeException(10012, "directory: " + dayPath + " - can't read");
+
+        const dirent* ent;
+        while ((ent = readdir(dir)) != nullptr) {
+            if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0)
+                continue;
+            archIndexAddFile(day, ent->d_name);
+        }
+        closedir(dir);
+    }
+
+    void Replicator::archIndexScanPath(bool all) {
+        // Directory modification times have 1 second precision, directories modified in the same second as the last scan are checked again
+        const time_t scanTime = time(nullptr);
+        struct stat fileStat{};
+
+        if (stat(archIndexPath.c_str(), &fileStat) != 0)
+            throw RuntimeException(10012, "directory: " + archIndexPath + " - can't read");
+
+        if (all || fileStat.st_mtime != archIndexPathMtime || fileStat.st_mtime >= archIndexScanTime) {
+            archIndexPathMtime = fileStat.st_mtime;
+
+            DIR* dir = opendir(archIndexPath.c_str());
+            if (dir == nullptr)
+                throw RuntimeException(10012, "directory: " + archIndexPath + " - can't read");
+
+            const dirent* ent;
+            while ((ent = readdir(dir)) != nullptr) {
+                const std::string day(ent->d_name);
+                if (day == "." || day == ".." || archIndexDays.find(day) != archIndexDays.end())
+                    continue;
+
+                const std::string dayPath(archIndexPath + "/" + day);
+                if (stat(dayPath.c_str(), &fileStat) != 0) {
+                    ctx->warning(10003, "file: " + dayPath + " - get metadata returned: " + strerror(errno));
+                    continue;
+                }
+
+                if (!S_ISDIR(fileStat.st_mode))
+                    continue;
+
+                archIndexDays.insert_or_assign(day, fileStat.st_mtime);
+                archIndexWatch(day);
+                archIndexScanDay(day);
+            }
+            closedir(dir);
+        }
+
+        // Only the newest days receive new files
+        uint days = 0;
+        for (auto it = archIndexDays.rbegin(); it != archIndexDays.rend() && days < ARCH_INDEX_WATCH_DAYS; ++it, ++days) {
+            const std::string dayPath(archIndexPath + "/" + it->first);
+            if (stat(dayPath.c_str(), &fileStat) != 0)
+                continue;
+
+            if (fileStat.st_mtime != it->second || fileStat.st_mtime >= archIndexScanTime) {
+                it->second = fileStat.st_mtime;
+                archIndexScanDay(it->first);
+            }
+        }
+
+        archIndexScanTime = scanTime;
+    }
+
+    void Replicator::archIndexWatch(const std::string& day) {
+        // Older days would not receive new files
+        if (archIndexWatches.size() >= ARCH_INDEX_WATCH_DAYS && archIndexWatches.begin()->first > day)
+            return;
+
+        const std::string dayPath(archIndexPath + "/" + day);
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+            ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "watching path: " + dayPath);
+
+#if __linux__
+        if (archIndexNotify == -1 || archIndexPathWatch == -1)
+            return;
+
+        const int wd = inotify_add_watch(archIndexNotify, dayPath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (wd == -1) {
+            ctx->warning(60038, "directory: " + dayPath + " - inotify add watch returned: " + strerror(errno));
+            return;
+        }
+        archIndexWatches.insert_or_assign(day, wd);
+        archIndexWatchDays.insert_or_assign(wd, day);
+
+        while (archIndexWatches.size() > ARCH_INDEX_WATCH_DAYS) {
+            const auto it = archIndexWatches.begin();
+            inotify_rm_watch(archIndexNotify, it->second);
+            archIndexWatchDays.erase(it->second);
+            archIndexWatches.erase(it);
+        }
+#endif
+    }
+
+    void Replicator::archIndexReadEvents() {
+#if __linux__
+        if (archIndexNotify == -1)
+            return;
+
+        alignas(inotify_event) char buffer[16384];
+        bool rescan = false;
+        for (;;) {
+            const ssize_t length = read(archIndexNotify, buffer, sizeof(buffer));
+            if (length <= 0)
+                break;
+
+            for (const char* ptr = buffer; ptr < buffer + length; ) {
+                const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                ptr += sizeof(inotify_event) + event->len;
+
+                if ((event->mask & IN_Q_OVERFLOW) != 0) {
+                    rescan = true;
+                    continue;
+                }
+                if (event->len == 0)
+                    continue;
+
+                if (event->wd == archIndexPathWatch) {
+                    if ((event->mask & IN_ISDIR) == 0)
+                        continue;
+                    const std::string day(event->name);
+                    if (archIndexDays.find(day) != archIndexDays.end())
+                        continue;
+
+                    if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+                        ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "new directory: " + archIndexPath + "/" + day);
+                    archIndexDays.insert_or_assign(day, 0);
+                    archIndexWatch(day);
+                    archIndexScanDay(day);
+                    continue;
+                }
+
+                const auto it = archIndexWatchDays.find(event->wd);
+                if (it != archIndexWatchDays.end())
+                    archIndexAddFile(it->second, event->name);
+            }
+        }
+
+        if (rescan) {
+            ctx->warning(60038, "directory: " + archIndexPath + " - inotify event queue overflow, rescanning");
+            archIndexSeen.clear();
+            archIndexDays.clear();
+            archIndexScanPath(true);
+        }
+#endif
+    }
+
     void Replicator::archGetLogList(Replicator* replicator) {
         Seq sequenceStart = Seq::none();
         for (const std::string& mappedPath: replicator->redoLogsBatch) {
@@ -562,12 +937,13 @@ namespace OpenLogReplicator {
                         break;
                     --j;
                 }
-                const Seq sequence = getSequenceFromFileName(replicator, fileName + j);
+                uint16_t thread;
+                const Seq sequence = getSequenceFromFileName(replicator, fileName + j, thread);
 
                 if (unlikely(replicator->ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
                     replicator->ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "found seq: " + sequence.toString());
 
-                if (sequence == Seq::zero() || sequence < replicator->metadata->sequence)
+                if (sequence == Seq::zero() || sequence < replicator->getThreadSequence(thread))
                     continue;
 
                 auto* parser = new Parser(replicator->ctx, replicator->builder, replicator->metadata,
@@ -575,6 +951,7 @@ namespace OpenLogReplicator {
                 parser->firstScn = Scn::none();
                 parser->nextScn = Scn::none();
                 parser->sequence = sequence;
+                parser->thread = thread;
                 replicator->archiveRedoQueue.push(parser);
                 if (sequenceStart == Seq::none() || sequenceStart > sequence)
                     sequenceStart = sequence;
@@ -595,12 +972,13 @@ namespace OpenLogReplicator {
                     if (unlikely(replicator->ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
                         replicator->ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "checking path: " + fileName);
 
-                    const Seq sequence = getSequenceFromFileName(replicator, ent->d_name);
+                    uint16_t thread;
+                    const Seq sequence = getSequenceFromFileName(replicator, ent->d_name, thread);
 
                     if (unlikely(replicator->ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
                         replicator->ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "found seq: " + sequence.toString());
 
-                    if (sequence == Seq::zero() || sequence < replicator->metadata->sequence)
+                    if (sequence == Seq::zero() || sequence < replicator->getThreadSequence(thread))
                         continue;
 
                     auto* parser = new Parser(replicator->ctx, replicator->builder, replicator->metadata,
@@ -608,6 +986,7 @@ namespace OpenLogReplicator {
                     parser->firstScn = Scn::none();
                     parser->nextScn = Scn::none();
                     parser->sequence = sequence;
+                    parser->thread = thread;
                     replicator->archiveRedoQueue.push(parser);
                 }
                 closedir(dir);
@@ -688,6 +1067,9 @@ namespace OpenLogReplicator {
     }
 
     bool Replicator::processArchivedRedoLogs() {
+        if (redoThreads > 0)
+            return processRedoThreads();
+
         Reader::REDO_CODE ret;
         Parser* parser;
         bool logsProcessed = false;
@@ -698,7 +1080,7 @@ namespace OpenLogReplicator {
             updateResetlogs();
             archGetLog(this);
 
-            if (archiveRedoQueue.empty()) {
+            if (archiveRedoQueue.empty() && catchUps.empty()) {
                 if (ctx->isFlagSet(Ctx::REDO_FLAGS::ARCH_ONLY)) {
                     if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
                         ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "archived redo log missing for seq: " + metadata->sequence.toString() +
@@ -716,7 +1098,14 @@ namespace OpenLogReplicator {
                 ss << std::this_thread::get_id();
                 ctx->logTrace(Ctx::TRACE::REDO, "searching archived redo log for seq: " + metadata->sequence.toString());
             }
-            while (!archiveRedoQueue.empty() && !ctx->softShutdown) {
+            while ((!archiveRedoQueue.empty() || !catchUps.empty()) && !ctx->softShutdown) {
+                if (catchUpProcess()) {
+                    logsProcessed = true;
+                    continue;
+                }
+                if (archiveRedoQueue.empty())
+                    break;
+
                 parser = archiveRedoQueue.top();
                 if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
                     ctx->logTrace(Ctx::TRACE::REDO, parser->path + " is seq: " + parser->sequence.toString() + ", scn: " + parser->firstScn.toString());
@@ -748,12 +1137,21 @@ namespace OpenLogReplicator {
                 }
 
                 logsProcessed = true;
+                if (archReaderNext != nullptr && archReaderNextSequence == parser->sequence && archReaderNextPath == parser->path &&
+                    (archReaderNext->getRet() == Reader::REDO_CODE::OK || archReaderNext->getRet() == Reader::REDO_CODE::FINISHED)) {
+                    // The file is already open, verified and partially buffered by the read-ahead
+                    std::swap(archReader, archReaderNext);
+                    archReaderNextSequence = Seq::none();
+                    if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
+                        ctx->logTrace(Ctx::TRACE::REDO, "using read-ahead of: " + parser->path + ", buffered: " +
+                                      std::to_string(archReader->getBufferEnd().getData() - archReader->getBufferStart().getData()) + " bytes");
+                }
                 parser->reader = archReader;
 
                 archReader->fileName = parser->path;
                 uint retry = ctx->archReadTries;
 
-                while (true) {
+                while (!archReader->isReadAhead()) {
                     if (ctx->softShutdown)
                         break;
                     if (archReader->checkRedoLog() && archReader->updateRedoLog())
@@ -776,6 +1174,7 @@ namespace OpenLogReplicator {
                 if (ctx->softShutdown)
                     break;
 
+                archReadAhead(parser);
                 ret = parser->parse();
                 metadata->firstScn = parser->firstScn;
                 metadata->nextScn = parser->nextScn;
@@ -812,9 +1211,358 @@ namespace OpenLogReplicator {
                 break;
         }
 
+        catchUpDrop();
+        return logsProcessed;
+    }
+
+    bool Replicator::catchUpProcess() {
+        // Redo log covered by the LWN summary is parsed by the replicator thread, which drops partial transactions at its end
+        if (catchUpThreads == 0 || metadata->lwnSummary->isActive())
+            return false;
+
+        // The first file and a file with a position to continue from are parsed by the replicator thread
+        if (catchUps.empty() && (archiveRedoQueue.empty() || metadata->sequence == Seq::zero() || metadata->fileOffset > FileOffset::zero() ||
+                                 archiveRedoQueue.top()->sequence != metadata->sequence))
+            return false;
+
+        if (!catchUps.empty() && catchUps.front()->schemaScn != metadata->schema->scn) {
+            catchUpDrop();
+            return false;
+        }
+
+        catchUpDispatch();
+        if (catchUps.empty())
+            return false;
+
+        CatchUp* catchUp = catchUps.front();
+        catchUps.pop_front();
+        catchUp->head = true;
+        catchUp->waitDone(this);
+        ctx->finishThread(catchUp);
+        Parser* parser = catchUp->parser;
+
+        if (catchUp->checkConflicts(ctx->lobIdToXidMap)) {
+            // This and the following files are parsed again in order
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
+                ctx->logTrace(Ctx::TRACE::REDO, "parsing again: " + parser->path + ", reason: " + catchUp->getConflict());
+            catchUpRelease(catchUp, true);
+            catchUpDrop();
+            return false;
+        }
+
+        parser->setCatchUp(nullptr);
+        parser->merge(catchUp);
+        metadata->firstScn = parser->firstScn;
+        metadata->nextScn = parser->nextScn;
+        catchUpRelease(catchUp, false);
+
+        if (ctx->softShutdown)
+            return true;
+
+        ++metadata->sequence;
+        if (ctx->stopLogSwitches > 0) {
+            --ctx->stopLogSwitches;
+            if (ctx->stopLogSwitches == 0) {
+                ctx->info(0, "shutdown started - exhausted number of log switches");
+                ctx->stopSoft();
+            }
+        }
+        return true;
+    }
+
+    void Replicator::catchUpDispatch() {
+        Seq sequenceNext = metadata->sequence;
+        if (!catchUps.empty()) {
+            sequenceNext = catchUps.back()->parser->sequence;
+            ++sequenceNext;
+        }
+
+        while (catchUps.size() < catchUpThreads && !archiveRedoQueue.empty() && !ctx->softShutdown) {
+            Parser* parser = archiveRedoQueue.top();
+            if (parser->sequence < sequenceNext) {
+                archiveRedoQueue.pop();
+                delete parser;
+                continue;
+            }
+            if (parser->sequence != sequenceNext)
+                break;
+            if (!catchUps.empty() && ctx->isMemoryLow(this))
+                break;
+            archiveRedoQueue.pop();
+
+            Reader* reader;
+            if (catchUpReadersFree.empty()) {
+                reader = readerSpawn(0, alias + "-reader-0-catch-up-" + std::to_string(catchUpReaders.size()));
+                catchUpReaders.insert(reader);
+            } else {
+                reader = catchUpReadersFree.back();
+                catchUpReadersFree.pop_back();
+            }
+
+            auto* catchUp = new CatchUp(ctx, alias + "-catch-up-" + parser->sequence.toString(), parser, reader, transactionBuffer,
+                                        metadata->schema->scn);
+            parser->setCatchUp(catchUp);
+            catchUps.push_back(catchUp);
+            ctx->spawnThread(catchUp);
+            ++sequenceNext;
+        }
+    }
+
+    void Replicator::catchUpRelease(CatchUp* catchUp, bool requeue) {
+        Parser* parser = catchUp->parser;
+        parser->setCatchUp(nullptr);
+        catchUpReadersFree.push_back(catchUp->reader);
+        delete catchUp;
+
+        if (requeue)
+            archiveRedoQueue.push(parser);
+        else
+            delete parser;
+    }
+
+    void Replicator::catchUpDrop() {
+        for (CatchUp* catchUp: catchUps)
+            catchUp->stop = true;
+
+        // Finished threads are released first, their memory might be needed by the others to stop
+        while (!catchUps.empty()) {
+            for (auto it = catchUps.begin(); it != catchUps.end();) {
+                CatchUp* catchUp = *it;
+                if (!catchUp->isDone()) {
+                    ++it;
+                    continue;
+                }
+
+                it = catchUps.erase(it);
+                ctx->finishThread(catchUp);
+                catchUpRelease(catchUp, true);
+            }
+
+            if (!catchUps.empty()) {
+                contextSet(CONTEXT::SLEEP);
+                ctx->usleepInt(1000);
+                contextSet(CONTEXT::CPU);
+            }
+        }
+    }
+
+    bool Replicator::processRedoThreads() {
+        bool logsProcessed = false;
+
+        while (!ctx->softShutdown) {
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
+                ctx->logTrace(Ctx::TRACE::REDO, "checking archived redo logs of " + std::to_string(redoThreads) + " redo threads");
+            updateResetlogs();
+            archGetLog(this);
+            redoThreadsDispatch();
+
+            if (redoThreadsMerge(false)) {
+                logsProcessed = true;
+                continue;
+            }
+            if (ctx->softShutdown)
+                break;
+
+            if (ctx->isFlagSet(Ctx::REDO_FLAGS::ARCH_ONLY)) {
+                if (unlikely(ctx->isTraceSet(Ctx::TRACE::ARCHIVE_LIST)))
+                    ctx->logTrace(Ctx::TRACE::ARCHIVE_LIST, "archived redo logs of all redo threads missing, sleeping");
+                contextSet(CONTEXT::SLEEP);
+                ctx->usleepInt(ctx->archReadSleepUs);
+                contextSet(CONTEXT::CPU);
+                continue;
+            }
+
+            // No more files would follow, the remaining output of all redo threads is merged
+            logsProcessed |= redoThreadsMerge(true);
+            break;
+        }
+
+        redoThreadsDrop();
         return logsProcessed;
     }
 
+    void Replicator::redoThreadsDispatch() {
+        while (!archiveRedoQueue.empty()) {
+            Parser* parser = archiveRedoQueue.top();
+            archiveRedoQueue.pop();
+
+            RedoThread* redoThread;
+            const auto it = redoThreadMap.find(parser->thread);
+            if (it != redoThreadMap.end()) {
+                redoThread = it->second;
+            } else {
+                if (unlikely(redoThreadMap.size() >= redoThreads)) {
+                    const uint16_t thread = parser->thread;
+                    delete parser;
+                    throw RuntimeException(10076, "found archived redo log of redo thread: " + std::to_string(thread) + ", expected " +
+                                           std::to_string(redoThreads) + " redo threads");
+                }
+
+                Reader* reader;
+                if (catchUpReadersFree.empty()) {
+                    reader = readerSpawn(0, alias + "-reader-0-thread-" + std::to_string(parser->thread));
+                    catchUpReaders.insert(reader);
+                } else {
+                    reader = catchUpReadersFree.back();
+                    catchUpReadersFree.pop_back();
+                }
+
+                Seq sequence = Seq::zero();
+                FileOffset fileOffset;
+                {
+                    contextSet(CONTEXT::MUTEX, REASON::REPLICATOR_ARCH);
+                    std::unique_lock const lck(metadata->mtxCheckpoint);
+                    const auto positionIt = metadata->redoThreadPositions.find(parser->thread);
+                    if (positionIt != metadata->redoThreadPositions.end() && positionIt->second.sequence != Seq::none()) {
+                        sequence = positionIt->second.sequence;
+                        fileOffset = positionIt->second.fileOffset;
+                    }
+                }
+                contextSet(CONTEXT::CPU);
+
+                redoThread = new RedoThread(ctx, alias + "-thread-" + std::to_string(parser->thread), parser->thread, reader, transactionBuffer,
+                                            mtxRedoThreads, condRedoThreads, sequence, fileOffset);
+                redoThreadMap.insert_or_assign(parser->thread, redoThread);
+                ctx->spawnThread(redoThread);
+            }
+
+            // Already parsed or queued
+            if (!redoThread->addFile(parser))
+                delete parser;
+        }
+    }
+
+    bool Replicator::redoThreadsMerge(bool drain) {
+        bool merged = false;
+        if (redoThreadsParser == nullptr)
+            redoThreadsParser = new Parser(ctx, builder, metadata, transactionBuffer, 0, "");
+
+        while (!ctx->softShutdown) {
+            RedoThread* next = nullptr;
+            RedoThreadEvent event;
+            {
+                contextSet(CONTEXT::MUTEX, REASON::REDO_THREAD_EVENT);
+                std::unique_lock lck(mtxRedoThreads);
+
+                // Until every redo thread is found any of them could have lower SCN
+                if (!drain && redoThreadMap.size() < redoThreads)
+                    break;
+
+                for (const auto& [_, redoThread]: redoThreadMap) {
+                    if (redoThread->events.empty())
+                        continue;
+                    if (next == nullptr)
+                        next = redoThread;
+                    else {
+                        const RedoThreadEvent& head = redoThread->events.front();
+                        const RedoThreadEvent& nextHead = next->events.front();
+                        // For equal SCN the checkpoint goes after the commits
+                        if (head.scn < nextHead.scn || (head.scn == nextHead.scn && nextHead.type == RedoThreadEvent::TYPE::CHECKPOINT &&
+                                                        head.type != RedoThreadEvent::TYPE::CHECKPOINT))
+                            next = redoThread;
+                    }
+                }
+
+                // An event may be merged only when no other redo thread can produce an event with a lower SCN
+                bool blocked = false;
+                bool busy = false;
+                for (const auto& [_, redoThread]: redoThreadMap) {
+                    if (!redoThread->events.empty())
+                        continue;
+                    if (next != nullptr && redoThread->bound >= next->events.front().scn)
+                        continue;
+                    if (drain && redoThread->isIdle())
+                        continue;
+
+                    blocked = true;
+                    if (!redoThread->isIdle())
+                        busy = true;
+                }
+
+                if (next != nullptr && !blocked) {
+                    event = next->events.front();
+                    next->events.pop_front();
+                    next->notifyParse();
+                } else {
+                    if (!busy)
+                        break;
+                    contextSet(CONTEXT::WAIT, REASON::REDO_THREAD_WAIT);
+                    condRedoThreads.wait_for(lck, std::chrono::milliseconds(100));
+                    continue;
+                }
+            }
+            contextSet(CONTEXT::CPU);
+
+            redoThreadsParser->merge(next, event);
+            merged = true;
+
+            if (event.type == RedoThreadEvent::TYPE::CHECKPOINT && event.switchRedo && ctx->stopLogSwitches > 0) {
+                --ctx->stopLogSwitches;
+                if (ctx->stopLogSwitches == 0) {
+                    ctx->info(0, "shutdown started - exhausted number of log switches");
+                    ctx->stopSoft();
+                }
+            }
+        }
+        contextSet(CONTEXT::CPU);
+
+        if (merged)
+            builder->flush();
+        return merged;
+    }
+
+    void Replicator::redoThreadsDrop() {
+        for (const auto& [_, redoThread]: redoThreadMap) {
+            redoThread->stop = true;
+            redoThread->wakeUp();
+        }
+
+        for (const auto& [_, redoThread]: redoThreadMap) {
+            ctx->finishThread(redoThread);
+            catchUpReadersFree.push_back(redoThread->reader);
+            delete redoThread;
+        }
+        redoThreadMap.clear();
+
+        delete redoThreadsParser;
+        redoThreadsParser = nullptr;
+    }
+
+    void Replicator::archReadAhead(Parser* parser) {
+        if (ctx->bufferSizeReadAhead == 0 || archiveRedoQueue.size() < 2)
+            return;
+
+        // The queue is ordered by sequence, the parser being processed is on top
+        archiveRedoQueue.pop();
+        const Parser* parserNext = archiveRedoQueue.top();
+        archiveRedoQueue.push(parser);
+
+        Seq sequenceNext = parser->sequence;
+        ++sequenceNext;
+        if (parserNext->sequence != sequenceNext)
+            return;
+
+        if (archReaderNext == nullptr)
+            archReaderNext = readerSpawn(0, alias + "-reader-0-ahead");
+
+        archReaderNextSequence = Seq::none();
+        archReaderNext->fileName = parserNext->path;
+        if (!archReaderNext->checkRedoLog() || !archReaderNext->updateRedoLog())
+            return;
+
+        // Only complete files are read ahead, a file still being archived is handled by the regular retry logic
+        if (archReaderNext->getNextScn() == Scn::none() || archReaderNext->getSequence() != sequenceNext)
+            return;
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
+            ctx->logTrace(Ctx::TRACE::REDO, "reading ahead: " + parserNext->path + ", seq: " + sequenceNext.toString() + ", up to: " +
+                          std::to_string(ctx->bufferSizeReadAhead) + " bytes");
+        archReaderNextSequence = sequenceNext;
+        archReaderNextPath = parserNext->path;
+        archReaderNext->setReadAhead(ctx->bufferSizeReadAhead);
+        archReaderNext->setStatusRead();
+    }
+
     bool Replicator::processOnlineRedoLogs() {
         Parser* parser;
         bool logsProcessed = false;
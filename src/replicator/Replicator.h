@@ -20,10 +20,15 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef REPLICATOR_H_
 #define REPLICATOR_H_
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <queue>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "../common/Ctx.h"
@@ -32,11 +37,13 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../common/exception/RedoLogException.h"
 
 namespace OpenLogReplicator {
+    class CatchUp;
     class Parser;
     class Builder;
     class Metadata;
     class Reader;
     class RedoLogRecord;
+    class RedoThread;
     class State;
     class Transaction;
     class TransactionBuffer;
@@ -46,6 +53,9 @@ namespace OpenLogReplicator {
     };
 
     class Replicator : public Thread {
+    public:
+        static constexpr uint ARCH_INDEX_WATCH_DAYS{2};
+
     protected:
         void (*archGetLog)(Replicator* replicator);
         Builder* builder;
@@ -55,17 +65,62 @@ namespace OpenLogReplicator {
         std::string redoCopyPath;
         // Redo log files
         Reader* archReader{nullptr};
+        Reader* archReaderNext{nullptr};
+        Seq archReaderNextSequence{Seq::none()};
+        std::string archReaderNextPath;
         std::string lastCheckedDay;
         std::priority_queue<Parser*, std::vector<Parser*>, parserCompare> archiveRedoQueue;
         std::set<Parser*> onlineRedoSet;
         std::set<Reader*> readers;
         std::vector<std::string> pathMapping;
         std::vector<std::string> redoLogsBatch;
+        // Archived redo log index (arch: path-index)
+        std::string archIndexPath;
+        std::map<Seq, std::string> archIndex;
+        std::unordered_set<std::string> archIndexSeen;
+        std::map<std::string, time_t> archIndexDays;
+        std::map<std::string, int> archIndexWatches;
+        std::unordered_map<int, std::string> archIndexWatchDays;
+        time_t archIndexPathMtime{0};
+        time_t archIndexScanTime{0};
+        typeResetlogs archIndexResetlogs{0};
+        Seq archIndexQueued{Seq::none()};
+        int archIndexNotify{-1};
+        int archIndexPathWatch{-1};
+        bool archIndexInitialized{false};
+        // Archived redo logs parsed in parallel (reader: catch-up-threads, redo-threads)
+        std::deque<CatchUp*> catchUps;
+        std::set<Reader*> catchUpReaders;
+        std::vector<Reader*> catchUpReadersFree;
+        // Redo threads of a RAC database parsed in parallel and merged in SCN order (reader: redo-threads)
+        std::map<uint16_t, RedoThread*> redoThreadMap;
+        std::mutex mtxRedoThreads;
+        std::condition_variable condRedoThreads;
+        Parser* redoThreadsParser{nullptr};
 
         void cleanArchList();
         void updateOnlineLogs() const;
         void readerDropAll();
-        static Seq getSequenceFromFileName(const Replicator* replicator, const std::string& file);
+        Reader* readerSpawn(int group, const std::string& name);
+        void archReadAhead(Parser* parser);
+        static Seq getSequenceFromFileName(const Replicator* replicator, const std::string& file, uint16_t& thread);
+        [[nodiscard]] Seq getThreadSequence(uint16_t thread) const;
+        void archIndexReset();
+        void archIndexInitialize();
+        void archIndexAddFile(const std::string& day, const char* file);
+        void archIndexScanDay(const std::string& day);
+        void archIndexScanPath(bool all);
+        void archIndexWatch(const std::string& day);
+        void archIndexReadEvents();
+        bool catchUpProcess();
+        void catchUpDispatch();
+        void catchUpRelease(CatchUp* catchUp, bool requeue);
+        void catchUpDrop();
+        bool processRedoThreads();
+        void redoThreadsDispatch();
+        bool redoThreadsMerge(bool drain);
+        void redoThreadsDrop();
+        bool positionIndex();
         virtual std::string getModeName() const;
         virtual bool checkConnection();
         virtual bool continueWithOnline();
@@ -74,6 +129,9 @@ namespace OpenLogReplicator {
         virtual void updateOnlineRedoLogData();
 
     public:
+        uint64_t catchUpThreads{0};
+        uint64_t redoThreads{0};
+
         Replicator(Ctx* newCtx, void (*newArchGetLog)(Replicator* replicator), Builder* newBuilder, Metadata* newMetadata,
                    TransactionBuffer* newTransactionBuffer, std::string newAlias, std::string newDatabase);
         ~Replicator() override;
@@ -88,6 +146,7 @@ namespace OpenLogReplicator {
         void addPathMapping(std::string source, std::string target);
         void addRedoLogsBatch(std::string path);
         static void archGetLogPath(Replicator* replicator);
+        static void archGetLogPathIndex(Replicator* replicator);
         static void archGetLogList(Replicator* replicator);
         void applyMapping(std::string& path) const;
         void updateResetlogs();
@@ -28,6 +28,9 @@ namespace OpenLogReplicator {
         Replicator(newCtx, newArchGetLog, newBuilder, newMetadata, newTransactionBuffer, std::move(newAlias), std::move(newDatabase)) {}
 
     void ReplicatorBatch::positionReader() {
+        if (metadata->startSequence == Seq::none() && positionIndex())
+            return;
+
         if (metadata->startSequence != Seq::none())
             metadata->setSeqFileOffset(metadata->startSequence, FileOffset::zero());
         else
@@ -48,6 +48,7 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include "../common/table/XdbXQn.h"
 #include "../common/table/XdbXPt.h"
 #include "../metadata/Metadata.h"
+#include "../metadata/RedoIndex.h"
 #include "../metadata/RedoLog.h"
 #include "../metadata/Schema.h"
 #include "../parser/Parser.h"
@@ -319,7 +320,14 @@ namespace OpenLogReplicator {
             if (stmt.executeQuery() == 0)
                 throw BootException(10030, "getting database sequence for scn: " + metadata->firstDataScn.toString());
 
-            metadata->setSeqFileOffset(sequence, FileOffset::zero());
+            // The redo index moves the start to the nearest LWN inside of the redo log file
+            RedoIndex::Entry entry;
+            if (redoThreads == 0 && metadata->redoIndex->findScn(metadata->resetlogs, metadata->firstDataScn, sequence, entry)) {
+                metadata->setSeqFileOffset(sequence, entry.fileOffset);
+                ctx->info(0, "redo index position for scn: " + metadata->firstDataScn.toString() + " is seq: " + entry.sequence.toString() +
+                          ", offset: " + entry.fileOffset.toString() + ", indexed scn: " + entry.scn.toString());
+            } else
+                metadata->setSeqFileOffset(sequence, FileOffset::zero());
             ctx->info(0, "starting sequence not found - starting with new batch with seq: " + metadata->sequence.toString());
         }
 
@@ -511,7 +519,8 @@ namespace OpenLogReplicator {
 
             for (const SchemaElement* element: metadata->schemaElements)
                 createSchemaForTable(metadata->firstDataScn, element->owner, element->table, element->keyList, element->key, element->tagType,
-                                     element->tagList, element->tag, element->condition, element->options, tablesUpdated);
+                                     element->tagList, element->tag, element->condition, element->filters, element->columnList,
+                                     element->options, tablesUpdated);
             metadata->schema->resetTouched();
 
             if (unlikely(metadata->ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
@@ -1424,7 +1433,8 @@ namespace OpenLogReplicator {
     void ReplicatorOnline::createSchemaForTable(Scn targetScn, const std::string& owner, const std::string& table, const std::vector<std::string>& keyList,
                                                 const std::string& key, SchemaElement::TAG_TYPE tagType, const std::vector<std::string>& tagList,
                                                 const std::string& tag,
-                                                const std::string& condition, DbTable::OPTIONS options,
+                                                const std::string& condition, const std::vector<DbFilter>& filters,
+                                                const std::vector<std::string>& columnList, DbTable::OPTIONS options,
                                                 std::unordered_map<typeObj, std::string>& tablesUpdated) {
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::REDO)))
             ctx->logTrace(Ctx::TRACE::REDO, "creating table schema for owner: " + owner + " table: " + table + " options: " +
@@ -1432,8 +1442,8 @@ namespace OpenLogReplicator {
 
         readSystemDictionaries(metadata->schema, targetScn, owner, table, options);
 
-        metadata->schema->buildMaps(owner, table, keyList, key, tagType, tagList, tag, condition, options, tablesUpdated, metadata->suppLogDbPrimary,
-                                    metadata->suppLogDbAll, metadata->defaultCharacterMapId,
+        metadata->schema->buildMaps(owner, table, keyList, key, tagType, tagList, tag, condition, filters, columnList, options, tablesUpdated,
+                                    metadata->suppLogDbPrimary, metadata->suppLogDbAll, metadata->defaultCharacterMapId,
                                     metadata->defaultCharacterNcharMapId);
     }
 
@@ -17,10 +17,36 @@ You should have received a copy of the GNU General Public License
 along with OpenLogReplicator; see the file LICENSE;  If not see
 <http://www.gnu.org/licenses/>.  */
 
+#include <sys/mman.h>
+
 #include "../common/Ctx.h"
 #include "State.h"
 
 namespace OpenLogReplicator {
+    StateMap::~StateMap() {
+        release();
+    }
+
+    void StateMap::release() {
+        if (address != nullptr) {
+            munmap(address, length);
+            address = nullptr;
+        }
+        length = 0;
+        buffer.clear();
+    }
+
+    std::string_view StateMap::data() const {
+        if (address != nullptr)
+            return {reinterpret_cast<const char*>(address), length};
+        return buffer;
+    }
+
     State::State(Ctx* newCtx):
             ctx(newCtx) {}
+
+    bool State::map(const std::string& name, uint64_t maxSize, StateMap& in) {
+        in.release();
+        return read(name, maxSize, in.buffer);
+    }
 }
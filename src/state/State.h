@@ -21,26 +21,47 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define STATE_H_
 
 #include <set>
+#include <string_view>
 
 #include "../common/types/Types.h"
 
 namespace OpenLogReplicator {
     class Ctx;
 
+    // Read-only content of a stored object, mapped to memory when the storage type allows it, copied otherwise
+    class StateMap final {
+    public:
+        std::string buffer;
+        void* address{nullptr};
+        uint64_t length{0};
+
+        StateMap() = default;
+        ~StateMap();
+        StateMap(const StateMap&) = delete;
+        StateMap& operator=(const StateMap&) = delete;
+
+        void release();
+        [[nodiscard]] std::string_view data() const;
+    };
+
     class State {
     protected:
         Ctx* ctx;
 
     public:
         static constexpr uint64_t TYPE_DISK{0};
+        static constexpr uint64_t TYPE_LOG{1};
 
         explicit State(Ctx* newCtx);
         virtual ~State() = default;
 
         virtual void list(std::set<std::string>& namesList) const = 0;
         [[nodiscard]] virtual bool read(const std::string& name, uint64_t maxSize, std::string& in) = 0;
+        [[nodiscard]] virtual bool map(const std::string& name, uint64_t maxSize, StateMap& in);
         virtual void write(const std::string& name, Scn scn, const std::ostringstream& out) = 0;
         virtual void drop(const std::string& name) = 0;
+        // Background maintenance of the storage, run by the checkpoint thread
+        virtual void compact() {}
     };
 }
 
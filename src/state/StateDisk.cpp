@@ -20,12 +20,15 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #include <cerrno>
 #include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
 #include <fstream>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 #include "../common/Ctx.h"
 #include "../common/exception/RuntimeException.h"
+#include "../metadata/Serializer.h"
 #include "StateDisk.h"
 
 namespace OpenLogReplicator {
@@ -33,6 +36,15 @@ namespace OpenLogReplicator {
             State(newCtx),
             path(std::move(newPath)) {}
 
+    std::string StateDisk::findFile(const std::string& name) const {
+        // Binary checkpoint files take precedence over JSON files left from before the conversion
+        const std::string fileNameBinary(path + "/" + name + SUFFIX_BINARY);
+        struct stat fileStat{};
+        if (stat(fileNameBinary.c_str(), &fileStat) == 0)
+            return fileNameBinary;
+        return path + "/" + name + SUFFIX_JSON;
+    }
+
     void StateDisk::list(std::set<std::string>& namesList) const {
         DIR* dir = opendir(path.c_str());
         if (dir == nullptr)
@@ -56,18 +68,19 @@ namespace OpenLogReplicator {
             if (S_ISDIR(fileStat.st_mode))
                 continue;
 
-            const std::string suffix(".json");
-            if (fileName.length() < suffix.length() || fileName.substr(fileName.length() - suffix.length(), fileName.length()) != suffix)
-                continue;
+            for (const std::string suffix: {SUFFIX_JSON, SUFFIX_BINARY}) {
+                if (fileName.length() < suffix.length() || fileName.substr(fileName.length() - suffix.length(), fileName.length()) != suffix)
+                    continue;
 
-            const std::string fileBase(fileName.substr(0, fileName.length() - suffix.length()));
-            namesList.insert(fileBase);
+                const std::string fileBase(fileName.substr(0, fileName.length() - suffix.length()));
+                namesList.insert(fileBase);
+            }
         }
         closedir(dir);
     }
 
     bool StateDisk::read(const std::string& name, uint64_t maxSize, std::string& in) {
-        const std::string fileName(path + "/" + name + ".json");
+        const std::string fileName(findFile(name));
         struct stat fileStat{};
         if (stat(fileName.c_str(), &fileStat) != 0) {
             ctx->warning(10003, "file: " + fileName + " - get metadata returned: " + strerror(errno));
@@ -91,24 +104,64 @@ namespace OpenLogReplicator {
         return true;
     }
 
+    bool StateDisk::map(const std::string& name, uint64_t maxSize, StateMap& in) {
+        in.release();
+        const std::string fileName(findFile(name));
+        const int fd = open(fileName.c_str(), O_RDONLY);
+        if (fd == -1) {
+            ctx->warning(10003, "file: " + fileName + " - get metadata returned: " + strerror(errno));
+            return false;
+        }
+
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0) {
+            ctx->warning(10003, "file: " + fileName + " - get metadata returned: " + strerror(errno));
+            close(fd);
+            return false;
+        }
+        if (static_cast<uint64_t>(fileStat.st_size) > maxSize || fileStat.st_size == 0) {
+            close(fd);
+            throw RuntimeException(10004, "file: " + fileName + " - wrong size: " + std::to_string(fileStat.st_size));
+        }
+
+        void* address = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        // Not every file system allows mapping, read the content then
+        if (address == MAP_FAILED)
+            return read(name, maxSize, in.buffer);
+
+        madvise(address, fileStat.st_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+        in.address = address;
+        in.length = fileStat.st_size;
+        return true;
+    }
+
     void StateDisk::write(const std::string& name, Scn scn __attribute__((unused)), const std::ostringstream& out) {
-        const std::string fileName(path + "/" + name + ".json");
+        const std::string content(out.str());
+        const bool binary = Serializer::detect(content) == Serializer::FORMAT::BINARY;
+        const std::string fileName(path + "/" + name + (binary ? SUFFIX_BINARY : SUFFIX_JSON));
         std::ofstream outputStream;
 
-        outputStream.open(fileName.c_str(), std::ios::out | std::ios::trunc);
+        outputStream.open(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
         if (!outputStream.is_open())
             throw RuntimeException(10006, "file: " + fileName + " - open for writing returned: " + strerror(errno));
 
-        outputStream << out.str();
+        outputStream << content;
         if (outputStream.bad() || outputStream.fail())
             throw RuntimeException(10007, "file: " + fileName + " - 0 bytes written instead of " +
-                                          std::to_string(out.str().length()) + ", code returned: " + strerror(errno));
+                                          std::to_string(content.length()) + ", code returned: " + strerror(errno));
 
         outputStream.close();
+
+        // A converted file replaces the file written in the other format
+        const std::string fileNameOther(path + "/" + name + (binary ? SUFFIX_JSON : SUFFIX_BINARY));
+        struct stat fileStat{};
+        if (stat(fileNameOther.c_str(), &fileStat) == 0 && unlink(fileNameOther.c_str()) != 0)
+            throw RuntimeException(10010, "file: " + fileNameOther + " - delete returned: " + strerror(errno));
     }
 
     void StateDisk::drop(const std::string& name) {
-        const std::string fileName(path + "/" + name + ".json");
+        const std::string fileName(findFile(name));
         if (unlink(fileName.c_str()) != 0)
             throw RuntimeException(10010, "file: " + fileName + " - delete returned: " + strerror(errno));
     }
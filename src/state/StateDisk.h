@@ -25,8 +25,13 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 namespace OpenLogReplicator {
     class StateDisk final : public State {
     protected:
+        static constexpr const char* SUFFIX_JSON{".json"};
+        static constexpr const char* SUFFIX_BINARY{".bin"};
+
         std::string path;
 
+        [[nodiscard]] std::string findFile(const std::string& name) const;
+
     public:
         explicit StateDisk(Ctx* newCtx, std::string newPath);
         StateDisk(const StateDisk&) = delete;
@@ -34,6 +39,7 @@ namespace OpenLogReplicator {
 
         void list(std::set<std::string>& namesList) const override;
         [[nodiscard]] bool read(const std::string& name, uint64_t maxSize, std::string& in) override;
+        [[nodiscard]] bool map(const std::string& name, uint64_t maxSize, StateMap& in) override;
         void write(const std::string& name, Scn scn, const std::ostringstream& out) override;
         void drop(const std::string& name) override;
     };
@@ -0,0 +1,372 @@
+/* Checkpoint storage in an append-only log of segment files
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "../common/Ctx.h"
+#include "../common/exception/RuntimeException.h"
+#include "StateLog.h"
+
+namespace OpenLogReplicator {
+    StateLog::StateLog(Ctx* newCtx, std::string newPath, std::string newPrefix, uint64_t newSegmentSize, uint64_t newSyncMs):
+            State(newCtx),
+            path(std::move(newPath)),
+            prefix(std::move(newPrefix)),
+            segmentSize(newSegmentSize),
+            syncMs(newSyncMs) {
+        recover();
+
+        // Records are never appended to a segment written before the restart
+        uint64_t seg = 1;
+        if (!segmentBytes.empty())
+            seg = segmentBytes.rbegin()->first + 1;
+        openSegment(seg);
+    }
+
+    StateLog::~StateLog() {
+        if (fd != -1) {
+            fdatasync(fd);
+            close(fd);
+            fd = -1;
+        }
+    }
+
+    std::string StateLog::segmentName(uint64_t seg) const {
+        std::string num(std::to_string(seg));
+        if (num.length() < 10)
+            num.insert(0, 10 - num.length(), '0');
+        return path + "/" + prefix + "-" + num + SUFFIX_LOG;
+    }
+
+    uint32_t StateLog::crc32(const uint8_t* data, uint64_t length) {
+        static const std::array<uint32_t, 256> table = [] {
+            std::array<uint32_t, 256> values{};
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t value = i;
+                for (uint bit = 0; bit < 8; ++bit)
+                    value = (value & 1) != 0 ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+                values[i] = value;
+            }
+            return values;
+        }();
+
+        uint32_t crc = 0xFFFFFFFF;
+        for (uint64_t i = 0; i < length; ++i)
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        return crc ^ 0xFFFFFFFF;
+    }
+
+    void StateLog::recover() {
+        DIR* dir = opendir(path.c_str());
+        if (dir == nullptr)
+            throw RuntimeException(10012, "directory: " + path + " - can't read");
+
+        std::set<uint64_t> segments;
+        const std::string segmentPrefix(prefix + "-");
+        const dirent* ent;
+        while ((ent = readdir(dir)) != nullptr) {
+            const std::string fileName(ent->d_name);
+            if (fileName.length() <= segmentPrefix.length() + strlen(SUFFIX_LOG) || fileName.substr(0, segmentPrefix.length()) != segmentPrefix ||
+                fileName.substr(fileName.length() - strlen(SUFFIX_LOG)) != SUFFIX_LOG)
+                continue;
+
+            const std::string num(fileName.substr(segmentPrefix.length(), fileName.length() - segmentPrefix.length() - strlen(SUFFIX_LOG)));
+            if (num.find_first_not_of("0123456789") != std::string::npos)
+                continue;
+            segments.insert(strtoull(num.c_str(), nullptr, 10));
+        }
+        closedir(dir);
+
+        // Later records of the same name replace earlier ones, segments are read in the order they were written
+        for (const uint64_t seg: segments)
+            recoverSegment(seg);
+    }
+
+    void StateLog::recoverSegment(uint64_t seg) {
+        const std::string fileName(segmentName(seg));
+        const int segFd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (segFd == -1)
+            throw RuntimeException(10001, "file: " + fileName + " - open for read returned: " + strerror(errno));
+
+        struct stat fileStat{};
+        if (fstat(segFd, &fileStat) != 0) {
+            close(segFd);
+            throw RuntimeException(10003, "file: " + fileName + " - get metadata returned: " + strerror(errno));
+        }
+
+        std::string buffer(fileStat.st_size, '\0');
+        uint64_t done = 0;
+        while (done < buffer.length()) {
+            const int64_t bytes = ::read(segFd, buffer.data() + done, buffer.length() - done);
+            if (bytes <= 0) {
+                close(segFd);
+                throw RuntimeException(10001, "file: " + fileName + " - read returned: " + strerror(errno));
+            }
+            done += bytes;
+        }
+        close(segFd);
+
+        const auto* data = reinterpret_cast<const uint8_t*>(buffer.data());
+        uint64_t pos = 0;
+        segmentLiveBytes[seg] = 0;
+        while (pos < buffer.length()) {
+            bool valid = pos + HEADER_SIZE <= buffer.length();
+            uint64_t nameLength = 0;
+            uint64_t contentLength = 0;
+            if (valid) {
+                nameLength = Ctx::read32Little(data + pos + 8);
+                contentLength = Ctx::read64Little(data + pos + 12);
+                valid = nameLength <= buffer.length() - pos - HEADER_SIZE && contentLength <= buffer.length() - pos - HEADER_SIZE - nameLength;
+            }
+            const uint64_t recordSize = HEADER_SIZE + nameLength + contentLength;
+            if (valid)
+                valid = Ctx::read32Little(data + pos) == crc32(data + pos + 4, recordSize - 4);
+
+            // A write interrupted by a crash leaves a torn record at the end, everything after the last valid record is discarded
+            if (!valid) {
+                ctx->warning(60042, "file: " + fileName + " - invalid record at offset: " + std::to_string(pos) + ", ignoring the rest of the segment");
+                if (truncate(fileName.c_str(), static_cast<off_t>(pos)) != 0)
+                    throw RuntimeException(10074, "file: " + fileName + " - truncate returned: " + strerror(errno));
+                break;
+            }
+
+            const auto type = static_cast<RECORD>(data[pos + 4]);
+            const std::string name(buffer.data() + pos + HEADER_SIZE, nameLength);
+            retire(name);
+            if (type == RECORD::WRITE) {
+                entries.insert_or_assign(name, Entry{seg, pos + HEADER_SIZE + nameLength, contentLength, recordSize,
+                                                     Scn(Ctx::read64Little(data + pos + 20))});
+                segmentLiveBytes[seg] += recordSize;
+            }
+            pos += recordSize;
+        }
+        segmentBytes[seg] = pos;
+    }
+
+    void StateLog::openSegment(uint64_t seg) {
+        const std::string fileName(segmentName(seg));
+        fd = open(fileName.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd == -1)
+            throw RuntimeException(10006, "file: " + fileName + " - open for writing returned: " + strerror(errno));
+
+        segment = seg;
+        segmentBytes.try_emplace(seg, 0);
+        segmentLiveBytes.try_emplace(seg, 0);
+        syncDirectory();
+    }
+
+    void StateLog::syncDirectory() const {
+        const int dirFd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dirFd == -1)
+            return;
+        if (fsync(dirFd) != 0) {
+            close(dirFd);
+            throw RuntimeException(10073, "file: " + path + " - sync returned: " + strerror(errno));
+        }
+        close(dirFd);
+    }
+
+    void StateLog::retire(const std::string& name) {
+        const auto it = entries.find(name);
+        if (it == entries.end())
+            return;
+        segmentLiveBytes[it->second.segment] -= it->second.recordSize;
+        entries.erase(it);
+    }
+
+    void StateLog::append(RECORD type, const std::string& name, Scn scn, std::string_view content) {
+        const uint64_t recordSize = HEADER_SIZE + name.length() + content.length();
+
+        // A segment is closed only when no sync is in progress, all its records are durable then
+        if (segmentBytes[segment] > 0 && segmentBytes[segment] + recordSize > segmentSize && !syncing) {
+            if (fdatasync(fd) != 0)
+                throw RuntimeException(10073, "file: " + segmentName(segment) + " - sync returned: " + strerror(errno));
+            close(fd);
+            fd = -1;
+            synced = appended;
+            openSegment(segment + 1);
+        }
+
+        std::string record(HEADER_SIZE, '\0');
+        auto* header = reinterpret_cast<uint8_t*>(record.data());
+        header[4] = static_cast<uint8_t>(type);
+        Ctx::write32Little(header + 8, name.length());
+        Ctx::write64Little(header + 12, content.length());
+        Ctx::write64Little(header + 20, scn.getData());
+        record.append(name);
+        record.append(content);
+        Ctx::write32Little(reinterpret_cast<uint8_t*>(record.data()), crc32(reinterpret_cast<const uint8_t*>(record.data()) + 4, recordSize - 4));
+
+        uint64_t done = 0;
+        while (done < recordSize) {
+            const int64_t bytes = ::write(fd, record.data() + done, recordSize - done);
+            if (bytes <= 0)
+                throw RuntimeException(10007, "file: " + segmentName(segment) + " - " + std::to_string(done) + " bytes written instead of " +
+                                       std::to_string(recordSize) + ", code returned: " + strerror(errno));
+            done += bytes;
+        }
+
+        const uint64_t offset = segmentBytes[segment];
+        segmentBytes[segment] += recordSize;
+        retire(name);
+        if (type == RECORD::WRITE) {
+            entries.insert_or_assign(name, Entry{segment, offset + HEADER_SIZE + name.length(), content.length(), recordSize, scn});
+            segmentLiveBytes[segment] += recordSize;
+        }
+        ++appended;
+    }
+
+    void StateLog::sync(std::unique_lock<std::mutex>& lck) {
+        const uint64_t target = appended;
+        while (synced < target) {
+            if (syncing) {
+                condSync.wait(lck);
+                continue;
+            }
+
+            // Other writers append within the sync window and share one fdatasync
+            syncing = true;
+            if (syncMs > 0)
+                condSync.wait_for(lck, std::chrono::milliseconds(syncMs));
+
+            const uint64_t syncTarget = appended;
+            const int syncFd = fd;
+            lck.unlock();
+            const int ret = fdatasync(syncFd);
+            const int err = errno;
+            lck.lock();
+            syncing = false;
+            if (ret == 0 && synced < syncTarget)
+                synced = syncTarget;
+            condSync.notify_all();
+
+            if (ret != 0)
+                throw RuntimeException(10073, "file: " + segmentName(segment) + " - sync returned: " + strerror(err));
+        }
+    }
+
+    void StateLog::list(std::set<std::string>& namesList) const {
+        std::unique_lock const lck(mtx);
+        for (const auto& [name, _]: entries)
+            namesList.insert(name);
+    }
+
+    bool StateLog::read(const std::string& name, uint64_t maxSize, std::string& in) {
+        std::unique_lock lck(mtx);
+        const auto it = entries.find(name);
+        if (it == entries.end()) {
+            ctx->warning(10003, "file: " + name + " - get metadata returned: not found in " + path + "/" + prefix + "-*" + SUFFIX_LOG);
+            return false;
+        }
+
+        const Entry entry = it->second;
+        const std::string fileName(segmentName(entry.segment));
+        if (entry.length > maxSize || entry.length == 0)
+            throw RuntimeException(10004, "file: " + fileName + " - wrong size: " + std::to_string(entry.length));
+
+        // The segment may be removed by compaction once the lock is released, an open file stays readable
+        const int segFd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (segFd == -1)
+            throw RuntimeException(10001, "file: " + fileName + " - open for read returned: " + strerror(errno));
+        lck.unlock();
+
+        in.resize(entry.length);
+        uint64_t done = 0;
+        while (done < entry.length) {
+            const int64_t bytes = pread(segFd, in.data() + done, entry.length - done, static_cast<off_t>(entry.offset + done));
+            if (bytes <= 0) {
+                close(segFd);
+                throw RuntimeException(10001, "file: " + fileName + " - read returned: " + strerror(errno));
+            }
+            done += bytes;
+        }
+        close(segFd);
+        return true;
+    }
+
+    void StateLog::write(const std::string& name, Scn scn, const std::ostringstream& out) {
+        const std::string content(out.str());
+        std::unique_lock lck(mtx);
+        append(RECORD::WRITE, name, scn, content);
+        sync(lck);
+    }
+
+    void StateLog::drop(const std::string& name) {
+        std::unique_lock lck(mtx);
+        if (entries.find(name) == entries.end())
+            throw RuntimeException(10010, "file: " + name + " - delete returned: not found in " + path + "/" + prefix + "-*" + SUFFIX_LOG);
+
+        // A lost drop record only leaves an old checkpoint behind, it is made durable with the next sync
+        append(RECORD::DROP, name, Scn::none(), {});
+    }
+
+    void StateLog::compact() {
+        std::unique_lock lck(mtx);
+
+        // Only the oldest segment is compacted, no older record could then reappear when a later drop record is removed
+        while (segmentBytes.size() > 1 && segmentBytes.begin()->first != segment) {
+            const uint64_t oldest = segmentBytes.begin()->first;
+            if (segmentLiveBytes[oldest] * 2 > segmentBytes[oldest])
+                break;
+
+            const std::string fileName(segmentName(oldest));
+            std::vector<std::pair<std::string, Entry>> moved;
+            for (const auto& [name, entry]: entries) {
+                if (entry.segment == oldest)
+                    moved.emplace_back(name, entry);
+            }
+
+            if (!moved.empty()) {
+                const int segFd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+                if (segFd == -1)
+                    throw RuntimeException(10001, "file: " + fileName + " - open for read returned: " + strerror(errno));
+
+                std::string content;
+                for (const auto& [name, entry]: moved) {
+                    content.resize(entry.length);
+                    if (pread(segFd, content.data(), entry.length, static_cast<off_t>(entry.offset)) != static_cast<int64_t>(entry.length)) {
+                        close(segFd);
+                        throw RuntimeException(10001, "file: " + fileName + " - read returned: " + strerror(errno));
+                    }
+                    append(RECORD::WRITE, name, entry.scn, content);
+                }
+                close(segFd);
+
+                // The copies must be durable before the segment is removed
+                sync(lck);
+            }
+
+            if (unlikely(ctx->isTraceSet(Ctx::TRACE::CHECKPOINT)))
+                ctx->logTrace(Ctx::TRACE::CHECKPOINT, "compacted segment: " + fileName + " moved records: " + std::to_string(moved.size()));
+
+            if (unlink(fileName.c_str()) != 0)
+                throw RuntimeException(10010, "file: " + fileName + " - delete returned: " + strerror(errno));
+            segmentBytes.erase(oldest);
+            segmentLiveBytes.erase(oldest);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/* Header for StateLog class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef STATE_LOG_H_
+#define STATE_LOG_H_
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+
+#include "State.h"
+
+namespace OpenLogReplicator {
+    // Stores all objects as records appended to a log of segment files <prefix>-<segment>.log, all numbers are little endian:
+    // - record header: crc32 (4) of the rest of the record, type (1), reserved (3), name length (4), content length (8), scn (8)
+    // - name and content
+    // The last record of an object name wins, a drop record removes the name. Writes are made durable by a fdatasync shared by all
+    // writes issued within the sync window, recovery reads every segment up to the last valid record.
+    class StateLog final : public State {
+    protected:
+        static constexpr const char* SUFFIX_LOG{".log"};
+        static constexpr uint64_t HEADER_SIZE{28};
+
+        enum class RECORD : unsigned char {
+            WRITE = 1,
+            DROP = 2
+        };
+
+        class Entry final {
+        public:
+            uint64_t segment;
+            uint64_t offset;
+            uint64_t length;
+            uint64_t recordSize;
+            Scn scn;
+        };
+
+        std::string path;
+        std::string prefix;
+        uint64_t segmentSize;
+        uint64_t syncMs;
+
+        mutable std::mutex mtx;
+        std::condition_variable condSync;
+        std::map<std::string, Entry> entries;
+        // Bytes used by segments and bytes of records which are still current
+        std::map<uint64_t, uint64_t> segmentBytes;
+        std::map<uint64_t, uint64_t> segmentLiveBytes;
+        uint64_t segment{0};
+        int fd{-1};
+        uint64_t appended{0};
+        uint64_t synced{0};
+        bool syncing{false};
+
+        [[nodiscard]] std::string segmentName(uint64_t seg) const;
+        [[nodiscard]] static uint32_t crc32(const uint8_t* data, uint64_t length);
+        void recover();
+        void recoverSegment(uint64_t seg);
+        void openSegment(uint64_t seg);
+        void syncDirectory() const;
+        void retire(const std::string& name);
+        void append(RECORD type, const std::string& name, Scn scn, std::string_view content);
+        void sync(std::unique_lock<std::mutex>& lck);
+
+    public:
+        StateLog(Ctx* newCtx, std::string newPath, std::string newPrefix, uint64_t newSegmentSize, uint64_t newSyncMs);
+        ~StateLog() override;
+        StateLog(const StateLog&) = delete;
+        StateLog& operator=(const StateLog&) = delete;
+
+        void list(std::set<std::string>& namesList) const override;
+        [[nodiscard]] bool read(const std::string& name, uint64_t maxSize, std::string& in) override;
+        void write(const std::string& name, Scn scn, const std::ostringstream& out) override;
+        void drop(const std::string& name) override;
+        void compact() override;
+    };
+}
+
+#endif
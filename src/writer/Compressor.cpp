@@ -0,0 +1,356 @@
+/* Pool of threads compressing writer output
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include "../common/Clock.h"
+#include "../common/exception/RuntimeException.h"
+#include "Compressor.h"
+
+#ifdef LINK_LIBRARY_LZ4
+#include <lz4frame.h>
+#endif /* LINK_LIBRARY_LZ4 */
+
+#ifdef LINK_LIBRARY_ZSTD
+#include <zstd.h>
+#endif /* LINK_LIBRARY_ZSTD */
+
+namespace OpenLogReplicator {
+    void Compressor::Frame::clear() {
+        parts.clear();
+        messages.clear();
+        size = 0;
+        outputSize = 0;
+        compressUs = 0;
+        busy = false;
+        done = false;
+        error.clear();
+    }
+
+    Compressor::Worker::Worker(Ctx* newCtx, std::string newAlias, Compressor* newCompressor):
+            Thread(newCtx, std::move(newAlias)),
+            compressor(newCompressor) {
+        switch (compressor->type) {
+#ifdef LINK_LIBRARY_LZ4
+            case TYPE::LZ4: {
+                LZ4F_cctx* lz4Cctx = nullptr;
+                if (LZ4F_isError(LZ4F_createCompressionContext(&lz4Cctx, LZ4F_VERSION)))
+                    throw RuntimeException(10016, "couldn't allocate memory for: LZ4 compression context");
+                cctx = lz4Cctx;
+                break;
+            }
+#endif /* LINK_LIBRARY_LZ4 */
+#ifdef LINK_LIBRARY_ZSTD
+            case TYPE::ZSTD:
+                cctx = ZSTD_createCCtx();
+                if (cctx == nullptr)
+                    throw RuntimeException(10016, "couldn't allocate memory for: zstd compression context");
+                break;
+#endif /* LINK_LIBRARY_ZSTD */
+            default:
+                break;
+        }
+    }
+
+    Compressor::Worker::~Worker() {
+        if (cctx == nullptr)
+            return;
+
+        switch (compressor->type) {
+#ifdef LINK_LIBRARY_LZ4
+            case TYPE::LZ4:
+                LZ4F_freeCompressionContext(static_cast<LZ4F_cctx*>(cctx));
+                break;
+#endif /* LINK_LIBRARY_LZ4 */
+#ifdef LINK_LIBRARY_ZSTD
+            case TYPE::ZSTD:
+                ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(cctx));
+                break;
+#endif /* LINK_LIBRARY_ZSTD */
+            default:
+                break;
+        }
+        cctx = nullptr;
+    }
+
+    void Compressor::Worker::wakeUp() {
+        std::unique_lock const lck(compressor->mtx);
+        compressor->condWork.notify_all();
+    }
+
+    void Compressor::Worker::run() {
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "compressor (" + ss.str() + ") start");
+        }
+
+        while (true) {
+            Frame* frame = compressor->getWork(this);
+            if (frame == nullptr)
+                break;
+
+            const time_ut start = ctx->clock->getTimeUt();
+            compress(frame);
+            frame->compressUs = ctx->clock->getTimeUt() - start;
+            compressor->setDone(this, frame);
+        }
+
+        if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
+            std::ostringstream ss;
+            ss << std::this_thread::get_id();
+            ctx->logTrace(Ctx::TRACE::THREADS, "compressor (" + ss.str() + ") stop");
+        }
+    }
+
+    void Compressor::Worker::compress(Frame* frame) {
+        switch (compressor->type) {
+#ifdef LINK_LIBRARY_LZ4
+            case TYPE::LZ4: {
+                auto* lz4Cctx = static_cast<LZ4F_cctx*>(cctx);
+                LZ4F_preferences_t preferences{};
+                preferences.compressionLevel = compressor->level;
+                preferences.frameInfo.contentSize = frame->size;
+
+                // Every update may flush the data buffered by the previous one
+                uint64_t bound = LZ4F_HEADER_SIZE_MAX + LZ4F_compressBound(0, &preferences);
+                for (const iovec& part: frame->parts)
+                    bound += LZ4F_compressBound(part.iov_len, &preferences);
+                if (frame->output.size() < bound)
+                    frame->output.resize(bound);
+
+                uint8_t* out = frame->output.data();
+                size_t ret = LZ4F_compressBegin(lz4Cctx, out, bound, &preferences);
+                uint64_t pos = 0;
+                for (const iovec& part: frame->parts) {
+                    if (LZ4F_isError(ret))
+                        break;
+                    pos += ret;
+                    ret = LZ4F_compressUpdate(lz4Cctx, out + pos, bound - pos, part.iov_base, part.iov_len, nullptr);
+                }
+                if (!LZ4F_isError(ret)) {
+                    pos += ret;
+                    ret = LZ4F_compressEnd(lz4Cctx, out + pos, bound - pos, nullptr);
+                }
+                if (LZ4F_isError(ret)) {
+                    frame->error = LZ4F_getErrorName(ret);
+                    return;
+                }
+                frame->outputSize = pos + ret;
+                return;
+            }
+#endif /* LINK_LIBRARY_LZ4 */
+#ifdef LINK_LIBRARY_ZSTD
+            case TYPE::ZSTD: {
+                auto* zstdCctx = static_cast<ZSTD_CCtx*>(cctx);
+                ZSTD_CCtx_reset(zstdCctx, ZSTD_reset_session_only);
+                ZSTD_CCtx_setParameter(zstdCctx, ZSTD_c_compressionLevel, compressor->level);
+                ZSTD_CCtx_setParameter(zstdCctx, ZSTD_c_checksumFlag, 1);
+                ZSTD_CCtx_setPledgedSrcSize(zstdCctx, frame->size);
+
+                const uint64_t bound = ZSTD_compressBound(frame->size);
+                if (frame->output.size() < bound)
+                    frame->output.resize(bound);
+
+                ZSTD_outBuffer out{frame->output.data(), bound, 0};
+                for (const iovec& part: frame->parts) {
+                    ZSTD_inBuffer in{part.iov_base, part.iov_len, 0};
+                    while (in.pos < in.size) {
+                        const size_t ret = ZSTD_compressStream2(zstdCctx, &out, &in, ZSTD_e_continue);
+                        if (ZSTD_isError(ret)) {
+                            frame->error = ZSTD_getErrorName(ret);
+                            return;
+                        }
+                    }
+                }
+
+                ZSTD_inBuffer in{nullptr, 0, 0};
+                size_t ret;
+                do {
+                    ret = ZSTD_compressStream2(zstdCctx, &out, &in, ZSTD_e_end);
+                    if (ZSTD_isError(ret)) {
+                        frame->error = ZSTD_getErrorName(ret);
+                        return;
+                    }
+                } while (ret > 0);
+                frame->outputSize = out.pos;
+                return;
+            }
+#endif /* LINK_LIBRARY_ZSTD */
+            default:
+                frame->error = "compression not compiled";
+        }
+    }
+
+    Compressor::Compressor(Ctx* newCtx, TYPE newType, int newLevel, uint64_t newFrameSize):
+            ctx(newCtx),
+            type(newType),
+            level(newLevel),
+            frameSize(newFrameSize) {}
+
+    Compressor::~Compressor() {
+        {
+            std::unique_lock const lck(mtx);
+            stop = true;
+            condWork.notify_all();
+        }
+
+        for (Worker* worker: workers) {
+            ctx->finishThread(worker);
+            delete worker;
+        }
+        workers.clear();
+
+        delete current;
+        current = nullptr;
+        for (const Frame* frame: frames)
+            delete frame;
+        frames.clear();
+        for (const Frame* frame: framesFree)
+            delete frame;
+        framesFree.clear();
+    }
+
+    void Compressor::start(const std::string& alias, uint threads) {
+        for (uint i = 0; i < threads; ++i) {
+            auto* worker = new Worker(ctx, alias + "-compressor-" + std::to_string(i), this);
+            workers.push_back(worker);
+            ctx->spawnThread(worker);
+        }
+    }
+
+    Compressor::Frame* Compressor::getWork(Thread* t) {
+        Frame* work = nullptr;
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::COMPRESSOR_FRAME);
+        {
+            std::unique_lock lck(mtx);
+            while (work == nullptr && !stop && !ctx->hardShutdown) {
+                for (Frame* frame: frames) {
+                    if (!frame->busy) {
+                        frame->busy = true;
+                        work = frame;
+                        break;
+                    }
+                }
+                if (work != nullptr)
+                    break;
+
+                t->contextSet(Thread::CONTEXT::SLEEP, Thread::REASON::COMPRESSOR_NO_WORK);
+                condWork.wait_for(lck, std::chrono::milliseconds(100));
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+        return work;
+    }
+
+    void Compressor::setDone(Thread* t, Frame* frame) {
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::COMPRESSOR_FRAME);
+        {
+            std::unique_lock const lck(mtx);
+            frame->done = true;
+            condDone.notify_all();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    void Compressor::add(Thread* t, const uint8_t* data, uint64_t size) {
+        if (current == nullptr) {
+            t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::COMPRESSOR_FRAME);
+            {
+                std::unique_lock const lck(mtx);
+                if (!framesFree.empty()) {
+                    current = framesFree.back();
+                    framesFree.pop_back();
+                }
+            }
+            t->contextSet(Thread::CONTEXT::CPU);
+            if (current == nullptr)
+                current = new Frame();
+        }
+
+        current->parts.push_back({const_cast<uint8_t*>(data), size});
+        current->size += size;
+    }
+
+    void Compressor::addMessage(Thread* t, BuilderMsg* msg) {
+        // A frame holds whole messages, the messages are confirmed after the frame is written
+        current->messages.push_back(msg);
+        if (current->size >= frameSize)
+            queue(t);
+    }
+
+    void Compressor::queue(Thread* t) {
+        if (current == nullptr)
+            return;
+
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::COMPRESSOR_FRAME);
+        {
+            std::unique_lock const lck(mtx);
+            frames.push_back(current);
+            condWork.notify_one();
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+        current = nullptr;
+    }
+
+    Compressor::Frame* Compressor::next(Thread* t, bool wait) {
+        Frame* frame = nullptr;
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::COMPRESSOR_FRAME);
+        {
+            std::unique_lock lck(mtx);
+            while (!frames.empty() && !ctx->hardShutdown) {
+                if (frames.front()->done) {
+                    frame = frames.front();
+                    frames.pop_front();
+                    break;
+                }
+                if (!wait)
+                    break;
+
+                t->contextSet(Thread::CONTEXT::WAIT, Thread::REASON::COMPRESSOR_WAIT);
+                condDone.wait_for(lck, std::chrono::milliseconds(100));
+            }
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+        return frame;
+    }
+
+    void Compressor::release(Thread* t, Frame* frame) {
+        frame->clear();
+        t->contextSet(Thread::CONTEXT::MUTEX, Thread::REASON::COMPRESSOR_FRAME);
+        {
+            std::unique_lock const lck(mtx);
+            framesFree.push_back(frame);
+        }
+        t->contextSet(Thread::CONTEXT::CPU);
+    }
+
+    const char* Compressor::getName(TYPE type) {
+        switch (type) {
+            case TYPE::LZ4:
+                return "lz4";
+            case TYPE::ZSTD:
+                return "zstd";
+            default:
+                return "none";
+        }
+    }
+}
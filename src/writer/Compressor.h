@@ -0,0 +1,114 @@
+/* Header for Compressor class
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#ifndef COMPRESSOR_H_
+#define COMPRESSOR_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <sys/uio.h>
+#include <vector>
+
+#include "../common/Thread.h"
+
+namespace OpenLogReplicator {
+    struct BuilderMsg;
+
+    // Compresses writer output in independent zstd or LZ4 frames on a pool of worker threads. Every frame decompresses alone, so output
+    // files can be read from any frame start and compressed files can be concatenated. The data is read from the builder buffers, which
+    // stay allocated until the messages of the frame are confirmed.
+    class Compressor final {
+    public:
+        enum class TYPE : unsigned char {
+            NONE,
+            LZ4,
+            ZSTD
+        };
+
+        class Frame final {
+        public:
+            std::vector<iovec> parts;
+            std::vector<BuilderMsg*> messages;
+            uint64_t size{0};
+            std::vector<uint8_t> output;
+            uint64_t outputSize{0};
+            time_ut compressUs{0};
+            bool busy{false};
+            bool done{false};
+            std::string error;
+
+            void clear();
+        };
+
+    protected:
+        class Worker final : public Thread {
+        protected:
+            Compressor* compressor;
+            void* cctx{nullptr};
+
+            void run() override;
+            void compress(Frame* frame);
+
+        public:
+            Worker(Ctx* newCtx, std::string newAlias, Compressor* newCompressor);
+            ~Worker() override;
+
+            void wakeUp() override;
+
+            std::string getName() const override {
+                return {"Compressor: " + alias};
+            }
+        };
+
+        Ctx* ctx;
+        TYPE type;
+        int level;
+        uint64_t frameSize;
+        std::vector<Worker*> workers;
+        std::mutex mtx;
+        std::condition_variable condWork;
+        std::condition_variable condDone;
+        // Frame filled by the writer, queued frames in output order
+        Frame* current{nullptr};
+        std::deque<Frame*> frames;
+        std::vector<Frame*> framesFree;
+        bool stop{false};
+
+        [[nodiscard]] Frame* getWork(Thread* t);
+        void setDone(Thread* t, Frame* frame);
+
+    public:
+        Compressor(Ctx* newCtx, TYPE newType, int newLevel, uint64_t newFrameSize);
+        ~Compressor();
+        Compressor(const Compressor&) = delete;
+        Compressor& operator=(const Compressor&) = delete;
+
+        void start(const std::string& alias, uint threads);
+        void add(Thread* t, const uint8_t* data, uint64_t size);
+        void addMessage(Thread* t, BuilderMsg* msg);
+        void queue(Thread* t);
+        [[nodiscard]] Frame* next(Thread* t, bool wait);
+        void release(Thread* t, Frame* frame);
+
+        [[nodiscard]] static const char* getName(TYPE type);
+    };
+}
+
+#endif
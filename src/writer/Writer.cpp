@@ -37,26 +37,55 @@ namespace OpenLogReplicator {
             database(std::move(newDatabase)),
             builder(newBuilder),
             metadata(newMetadata),
-            checkpointTime(time(nullptr)) {
+            writerNum(newBuilder->registerWriter()),
+            checkpointTime(time(nullptr)),
+            checkpointName(database + "-chkpt") {
         ctx->writerThread = this;
     }
 
     Writer::~Writer() {
         delete[] queue;
         queue = nullptr;
+
+        delete[] messages;
+        messages = nullptr;
+
+        delete[] messagesFree;
+        messagesFree = nullptr;
     }
 
     void Writer::initialize() {
         if (queue != nullptr)
             return;
         queue = new BuilderMsg*[ctx->queueSize];
+        messages = new BuilderMsg[ctx->queueSize];
+        messagesFree = new uint64_t[ctx->queueSize];
+        for (uint64_t i = 0; i < ctx->queueSize; ++i)
+            messagesFree[i] = ctx->queueSize - 1 - i;
+        messagesFreeSize = ctx->queueSize;
     }
 
-    void Writer::createMessage(BuilderMsg* msg) {
+    BuilderMsg* Writer::createMessage(const BuilderMsg* msg) {
         ++sentMessages;
 
-        queue[currentQueueSize++] = msg;
+        BuilderMsg* copy = messages + messagesFree[--messagesFreeSize];
+        copy->ptr = nullptr;
+        copy->id = msg->id;
+        copy->queueId = msg->queueId;
+        copy->size = msg->size.load();
+        copy->scn = msg->scn;
+        copy->lwnScn = msg->lwnScn;
+        copy->lwnIdx = msg->lwnIdx;
+        copy->data = msg->data;
+        copy->sequence = msg->sequence;
+        copy->obj = msg->obj;
+        copy->tagSize = msg->tagSize;
+        copy->flags = msg->flags;
+        copy->readTime = msg->readTime;
+
+        queue[currentQueueSize++] = copy;
         hwmQueueSize = std::max(currentQueueSize, hwmQueueSize);
+        return copy;
     }
 
     void Writer::sortQueue() {
@@ -97,6 +126,7 @@ namespace OpenLogReplicator {
             BuilderMsg* msg = queue[i];
             if (msg->isFlagSet(BuilderMsg::OUTPUT_BUFFER::ALLOCATED))
                 delete[] msg->data;
+            messagesFree[messagesFreeSize++] = msg - messages;
         }
         currentQueueSize = 0;
 
@@ -131,6 +161,7 @@ namespace OpenLogReplicator {
         {
             while (currentQueueSize > 0 && queue[0]->isFlagSet(BuilderMsg::OUTPUT_BUFFER::CONFIRMED)) {
                 maxId = queue[0]->queueId;
+                messagesFree[messagesFreeSize++] = queue[0] - messages;
                 if (confirmedScn == Scn::none() || msg->lwnScn > confirmedScn) {
                     confirmedScn = msg->lwnScn;
                     confirmedIdx = msg->lwnIdx;
@@ -160,10 +191,50 @@ namespace OpenLogReplicator {
             }
         }
 
-        builder->releaseBuffers(this, maxId);
+        builder->releaseBuffers(this, writerNum, maxId);
         contextSet(CONTEXT::CPU);
     }
 
+    bool Writer::isNewData(Scn scn, typeIdx idx) const {
+        if (clientScn == Scn::none())
+            return true;
+
+        if (clientScn < scn)
+            return true;
+
+        if (clientScn == scn && clientIdx < idx)
+            return true;
+
+        return false;
+    }
+
+    bool Writer::checkLag() {
+        if (maxLagMb == 0 || !builder->isWriterLagging(this, writerNum, maxLagMb / Ctx::MEMORY_CHUNK_SIZE_MB))
+            return false;
+
+        ctx->warning(60039, "writer " + alias + " is more than " + std::to_string(maxLagMb) + " MB behind, detaching from the output buffers");
+
+        // Messages already sent must be confirmed before the buffers are released
+        while (currentQueueSize > 0 && !ctx->hardShutdown) {
+            pollQueue();
+            flush();
+            if (currentQueueSize == 0)
+                break;
+            contextSet(CONTEXT::SLEEP);
+            ctx->usleepInt(ctx->pollIntervalUs);
+            contextSet(CONTEXT::CPU);
+        }
+        if (currentQueueSize > 0)
+            return true;
+
+        writeCheckpoint(true);
+        builder->detachWriter(this, writerNum);
+        detached = true;
+        ctx->info(0, "writer " + alias + " detached, restart to continue from checkpoint scn: " + checkpointScn.toString() + ", idx: " +
+                  std::to_string(checkpointIdx));
+        return true;
+    }
+
     void Writer::run() {
         if (unlikely(ctx->isTraceSet(Ctx::TRACE::THREADS))) {
             std::ostringstream ss;
@@ -176,6 +247,7 @@ namespace OpenLogReplicator {
         try {
             // Before anything, read the latest checkpoint
             readCheckpoint();
+            metadata->waitForWriters(this, checkpointScn, checkpointIdx);
             builderQueue = builder->firstBuilderQueue;
             oldSize = 0;
             currentQueueSize = 0;
@@ -191,7 +263,7 @@ namespace OpenLogReplicator {
                     streaming = false;
                 }
 
-                if (ctx->softShutdown && ctx->replicatorFinished)
+                if (detached || (ctx->softShutdown && ctx->replicatorFinished))
                     break;
             }
         } catch (DataException& ex) {
@@ -244,6 +316,8 @@ namespace OpenLogReplicator {
                     if (builderQueue->confirmedSize == oldSize) {
                         builderQueue = builderQueue->next;
                         oldSize = 0;
+                        if (checkLag())
+                            return;
                     }
 
                 // Found something
@@ -278,6 +352,8 @@ namespace OpenLogReplicator {
                     ctx->usleepInt(ctx->pollIntervalUs);
                     contextSet(CONTEXT::CPU);
                     pollQueue();
+                    if (checkLag())
+                        return;
                 }
 
                 writeCheckpoint(redo);
@@ -289,57 +365,71 @@ namespace OpenLogReplicator {
 
                 // Message in one part - sent directly from buffer
                 if (oldSize + size8 <= Builder::OUTPUT_BUFFER_DATA_SIZE) {
-                    createMessage(msg);
+                    msg = createMessage(msg);
                     if (msg->isFlagSet(BuilderMsg::OUTPUT_BUFFER::REDO))
                         redo = true;
                     // Send the message to the client in one part
                     if ((msg->isFlagSet(BuilderMsg::OUTPUT_BUFFER::CHECKPOINT) && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_CHECKPOINT)) ||
-                        !metadata->isNewData(msg->lwnScn, msg->lwnIdx))
+                        !isNewData(msg->lwnScn, msg->lwnIdx))
                         confirmMessage(msg);
                     else {
                         const uint64_t msgSize = msg->size;
+                        const time_ut readTime = msg->readTime;
                         sendMessage(msg);
                         if (ctx->metrics != nullptr) {
                             ctx->metrics->emitBytesSent(msgSize);
                             ctx->metrics->emitMessagesSent(1);
+                            if (readTime != 0)
+                                ctx->metrics->emitRedoLatencyUs(ctx->clock->getTimeUt() - readTime);
                         }
                     }
                     oldSize += size8;
                 } else {
-                    // The message is split to many parts - merge and copy
-                    msg->data = new uint8_t[msg->size];
-                    if (unlikely(msg->data == nullptr))
-                        throw RuntimeException(10016, "couldn't allocate " + std::to_string(msg->size) +
-                                               " bytes memory for: temporary buffer for JSON message");
-                    msg->setFlag(BuilderMsg::OUTPUT_BUFFER::ALLOCATED);
+                    // The message is split to many parts - merge and copy, unless the writer reads the parts from the buffers
+                    msg = createMessage(msg);
+                    if (gatherParts) {
+                        msg->ptr = builderQueue;
+                        msg->data = builderQueue->data + oldSize;
+                        msg->setFlag(BuilderMsg::OUTPUT_BUFFER::SPLIT);
+                    } else {
+                        msg->data = new uint8_t[msg->size];
+                        if (unlikely(msg->data == nullptr))
+                            throw RuntimeException(10016, "couldn't allocate " + std::to_string(msg->size) +
+                                                   " bytes memory for: temporary buffer for JSON message");
+                        msg->setFlag(BuilderMsg::OUTPUT_BUFFER::ALLOCATED);
+                    }
 
                     uint64_t copied = 0;
                     while (msg->size > copied) {
                         uint64_t toCopy = msg->size - copied;
                         if (toCopy > newSize - oldSize) {
                             toCopy = newSize - oldSize;
-                            memcpy(msg->data + copied, builderQueue->data + oldSize, toCopy);
+                            if (!gatherParts)
+                                memcpy(msg->data + copied, builderQueue->data + oldSize, toCopy);
                             builderQueue = builderQueue->next;
                             newSize = Builder::OUTPUT_BUFFER_DATA_SIZE;
                             oldSize = 0;
                         } else {
-                            memcpy(msg->data + copied, builderQueue->data + oldSize, toCopy);
+                            if (!gatherParts)
+                                memcpy(msg->data + copied, builderQueue->data + oldSize, toCopy);
                             oldSize += (toCopy + 7) & 0xFFFFFFFFFFFFFFF8;
                         }
                         copied += toCopy;
                     }
 
-                    createMessage(msg);
                     // Send only new messages to the client
                     if ((msg->isFlagSet(BuilderMsg::OUTPUT_BUFFER::CHECKPOINT) && !ctx->isFlagSet(Ctx::REDO_FLAGS::SHOW_CHECKPOINT)) ||
-                        !metadata->isNewData(msg->lwnScn, msg->lwnIdx))
+                        !isNewData(msg->lwnScn, msg->lwnIdx))
                         confirmMessage(msg);
                     else {
                         const uint64_t msgSize = msg->size;
+                        const time_ut readTime = msg->readTime;
                         sendMessage(msg);
                         if (ctx->metrics != nullptr) {
                             ctx->metrics->emitBytesSent(msgSize);
                             ctx->metrics->emitMessagesSent(1);
+                            if (readTime != 0)
+                                ctx->metrics->emitRedoLatencyUs(ctx->clock->getTimeUt() - readTime);
                         }
                     }
                     break;
@@ -383,7 +473,6 @@ namespace OpenLogReplicator {
                 ctx->logTrace(Ctx::TRACE::CHECKPOINT, "writer confirmed scn: " + confirmedScn.toString() + " idx: " +
                               std::to_string(confirmedIdx) + " checkpoint scn: " + checkpointScn.toString() + " idx: " + std::to_string(checkpointIdx));
         }
-        const std::string name(database + "-chkpt");
         std::ostringstream ss;
         ss << R"({"database":")" << database
                 << R"(","scn":)" << std::dec << confirmedScn.toString()
@@ -391,7 +480,7 @@ namespace OpenLogReplicator {
                 << R"(,"resetlogs":)" << std::dec << metadata->resetlogs
                 << R"(,"activation":)" << std::dec << metadata->activation << "}";
 
-        if (metadata->stateWrite(name, confirmedScn, ss)) {
+        if (metadata->stateWrite(checkpointName, confirmedScn, ss)) {
             checkpointScn = confirmedScn;
             checkpointIdx = confirmedIdx;
             checkpointTime = now;
@@ -399,7 +488,7 @@ namespace OpenLogReplicator {
     }
 
     void Writer::readCheckpoint() {
-        const std::string name(database + "-chkpt");
+        const std::string& name = checkpointName;
 
         // Checkpoint is present - read it
         std::string checkpoint;
@@ -429,22 +518,17 @@ namespace OpenLogReplicator {
         metadata->setResetlogs(Ctx::getJsonFieldU32(name, document, "resetlogs"));
         metadata->setActivation(Ctx::getJsonFieldU32(name, document, "activation"));
 
-        // Started earlier - continue work and ignore default startup parameters
+        // Started earlier - continue work, the replication starts after all writers read own checkpoints
         checkpointScn = Ctx::getJsonFieldU64(name, document, "scn");
-        metadata->clientScn = checkpointScn;
+        clientScn = checkpointScn;
         if (document.HasMember("idx"))
             checkpointIdx = Ctx::getJsonFieldU64(name, document, "idx");
         else
             checkpointIdx = 0;
-        metadata->clientIdx = checkpointIdx;
-        metadata->startScn = checkpointScn;
-        metadata->startSequence = Seq::none();
-        metadata->startTime.clear();
-        metadata->startTimeRel = 0;
+        clientIdx = checkpointIdx;
 
         ctx->info(0, "checkpoint - all confirmed till scn: " + checkpointScn.toString() + ", idx: " +
                   std::to_string(checkpointIdx));
-        metadata->setStatusReplicating(this);
     }
 
     void Writer::wakeUp() {
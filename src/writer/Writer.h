@@ -36,6 +36,7 @@ namespace OpenLogReplicator {
         std::string database;
         Builder* builder;
         Metadata* metadata;
+        uint writerNum;
         // Information about local checkpoint
         BuilderQueue* builderQueue{nullptr};
         Scn checkpointScn{Scn::none()};
@@ -47,14 +48,24 @@ namespace OpenLogReplicator {
         uint64_t hwmQueueSize{0};
         bool streaming{false};
         bool redo{false};
+        bool detached{false};
+        // Messages split between output buffers are sent without merging, the parts are read from the builder buffers
+        bool gatherParts{false};
 
         std::mutex mtx;
         // scn,idx confirmed by client
         Scn confirmedScn{Scn::none()};
         typeIdx confirmedIdx{0};
+        // scn,idx of the first message not yet received by the client
+        Scn clientScn{Scn::none()};
+        typeIdx clientIdx{0};
         BuilderMsg** queue{nullptr};
+        // Own copies of the message headers, the output buffers can be shared with other writers
+        BuilderMsg* messages{nullptr};
+        uint64_t* messagesFree{nullptr};
+        uint64_t messagesFreeSize{0};
 
-        void createMessage(BuilderMsg* msg);
+        BuilderMsg* createMessage(const BuilderMsg* msg);
         virtual void sendMessage(BuilderMsg* msg) = 0;
         virtual std::string getType() const = 0;
         virtual void pollQueue() = 0;
@@ -64,8 +75,13 @@ namespace OpenLogReplicator {
         void readCheckpoint();
         void sortQueue();
         void resetMessageQueue();
+        [[nodiscard]] bool isNewData(Scn scn, typeIdx idx) const;
+        [[nodiscard]] bool checkLag();
 
     public:
+        std::string checkpointName;
+        uint64_t maxLagMb{0};
+
         Writer(Ctx* newCtx, std::string newAlias, std::string newDatabase, Builder* newBuilder, Metadata* newMetadata);
         ~Writer() override;
 
@@ -21,41 +21,56 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #define _FILE_OFFSET_BITS 64
 
 #include <algorithm>
+#include <climits>
 #include <cstring>
 #include <dirent.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include "../builder/Builder.h"
 #include "../common/exception/ConfigurationException.h"
 #include "../common/exception/RuntimeException.h"
+#include "../common/metrics/Metrics.h"
 #include "../metadata/Metadata.h"
 #include "WriterFile.h"
 
 namespace OpenLogReplicator {
     WriterFile::WriterFile(Ctx* newCtx, std::string newAlias, std::string newDatabase, Builder* newBuilder, Metadata* newMetadata,
                            std::string newOutput, std::string newFileTimestampFormat, uint64_t newMaxFileSize, uint64_t newNewLine, uint64_t newAppend,
-                           uint newWriteBufferFlushSize):
+                           uint newWriteBufferFlushSize, Compressor::TYPE newCompressionType, int newCompressionLevel,
+                           uint64_t newCompressionFrameSize, uint newCompressionThreads):
             Writer(newCtx, std::move(newAlias), std::move(newDatabase), newBuilder, newMetadata),
             output(std::move(newOutput)),
             fileTimestampFormat(std::move(newFileTimestampFormat)),
             maxFileSize(newMaxFileSize),
             newLine(newNewLine),
             append(newAppend),
-            writeBufferFlushSize(newWriteBufferFlushSize) {}
+            writeBufferFlushSize(newWriteBufferFlushSize),
+            compressionType(newCompressionType),
+            compressionLevel(newCompressionLevel),
+            compressionFrameSize(newCompressionFrameSize),
+            compressionThreads(newCompressionThreads) {}
 
     WriterFile::~WriterFile() {
+        delete compressor;
+        compressor = nullptr;
         closeFile();
-        if (buffer == nullptr)
-            return;
-        ctx->freeMemoryChunk(this, Ctx::MEMORY::WRITER, buffer);
-        buffer = nullptr;
     }
 
     void WriterFile::initialize() {
         Writer::initialize();
-        buffer = ctx->getMemoryChunk(this, Ctx::MEMORY::WRITER);
+        gatherParts = true;
+        iov.reserve(IOV_MAX);
+
+        if (compressionType != Compressor::TYPE::NONE) {
+            compressor = new Compressor(ctx, compressionType, compressionLevel, compressionFrameSize);
+            compressor->start(alias, compressionThreads);
+            ctx->info(0, "output is compressed with " + std::string(Compressor::getName(compressionType)) + ", level: " +
+                      std::to_string(compressionLevel) + ", frame size: " + std::to_string(compressionFrameSize) + ", threads: " +
+                      std::to_string(compressionThreads));
+        }
 
         if (newLine == 1) {
             newLineMsg = reinterpret_cast<const uint8_t*>("\n");
@@ -300,17 +315,41 @@ namespace OpenLogReplicator {
     }
 
     void WriterFile::sendMessage(BuilderMsg* msg) {
-        checkFile(msg->scn, msg->sequence, msg->size + newLine);
-
-        bufferedWrite(msg->data + msg->tagSize, msg->size - msg->tagSize);
-        fileSize += msg->size - msg->tagSize;
-
-        if (newLine > 0) {
-            bufferedWrite(newLineMsg, newLine);
-            fileSize += newLine;
+        // Compressed output rotates by the size of the frames already written
+        checkFile(msg->scn, msg->sequence, compressor == nullptr ? msg->size + newLine : 0);
+
+        if (msg->isFlagSet(BuilderMsg::OUTPUT_BUFFER::SPLIT)) {
+            // The first part ends with the first buffer, the next parts fill whole buffers
+            const auto* partQueue = reinterpret_cast<const BuilderQueue*>(msg->ptr);
+            uint64_t partStart = msg->data - partQueue->data;
+            uint64_t partSize = partQueue->confirmedSize - partStart;
+            uint64_t skip = msg->tagSize;
+            uint64_t left = msg->size;
+            while (left > 0) {
+                partSize = std::min(partSize, left);
+                if (skip < partSize)
+                    gather(partQueue->data + partStart + skip, partSize - skip);
+                skip = skip > partSize ? skip - partSize : 0;
+                left -= partSize;
+                partQueue = partQueue->next;
+                partStart = 0;
+                partSize = Builder::OUTPUT_BUFFER_DATA_SIZE;
+            }
+        } else
+            gather(msg->data + msg->tagSize, msg->size - msg->tagSize);
+        if (newLine > 0)
+            gather(newLineMsg, newLine);
+
+        if (compressor != nullptr) {
+            compressor->addMessage(this, msg);
+            writeFrames(false);
+            return;
         }
 
-        confirmMessage(msg);
+        fileSize += msg->size - msg->tagSize + newLine;
+        pending.push_back(msg);
+        if (pendingSize > writeBufferFlushSize)
+            flush();
     }
 
     std::string WriterFile::getType() const {
@@ -323,39 +362,92 @@ namespace OpenLogReplicator {
         if (metadata->status == Metadata::STATUS::READY)
             metadata->setStatusStarting(this);
 
-        flush();
+        // Written before the writer waits: no more messages available or the queue is full
+        if (currentQueueSize >= ctx->queueSize || builderQueue == nullptr ||
+            (builderQueue->confirmedSize == oldSize && builderQueue->next == nullptr))
+            flush();
     }
 
     void WriterFile::flush() {
-        if (bufferFill == 0)
+        if (compressor != nullptr) {
+            compressor->queue(this);
+            writeFrames(true);
             return;
+        }
 
-        unbufferedWrite(buffer, bufferFill);
-        bufferFill = 0;
-    }
+        if (pending.empty())
+            return;
 
-    void WriterFile::unbufferedWrite(const uint8_t* data, uint64_t size) {
-        contextSet(CONTEXT::OS, REASON::OS);
-        const int64_t bytesWritten = write(outputDes, data, size);
-        contextSet(CONTEXT::CPU);
-        if (bytesWritten <= 0 || static_cast<uint64_t>(bytesWritten) != size)
-            throw RuntimeException(10007, "file: " + fullFileName + " - " + std::to_string(bytesWritten) + " bytes written instead of " +
-                                   std::to_string(size) + ", code returned: " + strerror(errno));
+        gatheredWrite();
+        for (BuilderMsg* msg: pending)
+            confirmMessage(msg);
+        pending.clear();
     }
 
-    void WriterFile::bufferedWrite(const uint8_t* data, uint64_t size) {
-        if (bufferFill + size > Ctx::MEMORY_CHUNK_SIZE)
-            flush();
+    void WriterFile::gather(const uint8_t* data, uint64_t size) {
+        if (size == 0)
+            return;
 
-        if (size > Ctx::MEMORY_CHUNK_SIZE) {
-            unbufferedWrite(data, size);
+        if (compressor != nullptr) {
+            compressor->add(this, data, size);
             return;
         }
 
-        memcpy(buffer + bufferFill, data, size);
-        bufferFill += size;
+        iov.push_back({const_cast<uint8_t*>(data), size});
+        pendingSize += size;
+    }
 
-        if (bufferFill > writeBufferFlushSize)
-            flush();
+    void WriterFile::gatheredWrite() {
+        iovec* vec = iov.data();
+        uint64_t vecLeft = iov.size();
+        uint64_t left = pendingSize;
+
+        while (vecLeft > 0) {
+            contextSet(CONTEXT::OS, REASON::OS);
+            int64_t bytesWritten = writev(outputDes, vec, static_cast<int>(std::min<uint64_t>(vecLeft, IOV_MAX)));
+            contextSet(CONTEXT::CPU);
+            if (bytesWritten <= 0)
+                throw RuntimeException(10007, "file: " + fullFileName + " - " + std::to_string(bytesWritten) + " bytes written instead of " +
+                                       std::to_string(left) + ", code returned: " + strerror(errno));
+            left -= bytesWritten;
+
+            // A short write continues from the middle of a part
+            while (vecLeft > 0 && static_cast<uint64_t>(bytesWritten) >= vec->iov_len) {
+                bytesWritten -= static_cast<int64_t>(vec->iov_len);
+                ++vec;
+                --vecLeft;
+            }
+            if (bytesWritten > 0) {
+                vec->iov_base = static_cast<uint8_t*>(vec->iov_base) + bytesWritten;
+                vec->iov_len -= bytesWritten;
+            }
+        }
+
+        iov.clear();
+        pendingSize = 0;
+    }
+
+    void WriterFile::writeFrames(bool wait) {
+        Compressor::Frame* frame;
+        while ((frame = compressor->next(this, wait)) != nullptr) {
+            if (unlikely(!frame->error.empty()))
+                throw RuntimeException(10077, "file: " + fullFileName + " - " + Compressor::getName(compressionType) + " compression failed: " +
+                                       frame->error);
+
+            iov.push_back({frame->output.data(), frame->outputSize});
+            pendingSize = frame->outputSize;
+            gatheredWrite();
+            fileSize += frame->outputSize;
+
+            if (ctx->metrics != nullptr) {
+                ctx->metrics->emitCompressionBytesIn(frame->size);
+                ctx->metrics->emitCompressionBytesOut(frame->outputSize);
+                ctx->metrics->emitCompressionTimeUs(frame->compressUs);
+            }
+
+            for (BuilderMsg* msg: frame->messages)
+                confirmMessage(msg);
+            compressor->release(this, frame);
+        }
     }
 }
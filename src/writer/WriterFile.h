@@ -20,6 +20,10 @@ along with OpenLogReplicator; see the file LICENSE;  If not see
 #ifndef WRITER_FILE_H_
 #define WRITER_FILE_H_
 
+#include <sys/uio.h>
+#include <vector>
+
+#include "Compressor.h"
 #include "Writer.h"
 
 namespace OpenLogReplicator {
@@ -51,21 +55,31 @@ namespace OpenLogReplicator {
         Seq lastSequence{Seq::none()};
         const uint8_t* newLineMsg{nullptr};
         bool warningDisplayed{false};
-        uint8_t* buffer{nullptr};
-        uint bufferFill{0};
+        // Parts of the messages waiting for one gathered write, read directly from the builder buffers; the messages are confirmed after
+        // the write, so the buffers stay allocated till then
+        std::vector<iovec> iov;
+        std::vector<BuilderMsg*> pending;
+        uint64_t pendingSize{0};
         uint writeBufferFlushSize;
+        Compressor::TYPE compressionType;
+        int compressionLevel;
+        uint64_t compressionFrameSize;
+        uint compressionThreads;
+        Compressor* compressor{nullptr};
 
         void closeFile();
         void checkFile(Scn scn, Seq sequence, uint64_t size);
         void sendMessage(BuilderMsg* msg) override;
         std::string getType() const override;
         void pollQueue() override;
-        void unbufferedWrite(const uint8_t* data, uint64_t size);
-        void bufferedWrite(const uint8_t* data, uint64_t size);
+        void gather(const uint8_t* data, uint64_t size);
+        void gatheredWrite();
+        void writeFrames(bool wait);
 
     public:
         WriterFile(Ctx* newCtx, std::string newAlias, std::string newDatabase, Builder* newBuilder, Metadata* newMetadata, std::string newOutput,
-                   std::string newFileTimestampFormat, uint64_t newMaxFileSize, uint64_t newNewLine, uint64_t newAppend, uint newWiteBufferFlushSize);
+                   std::string newFileTimestampFormat, uint64_t newMaxFileSize, uint64_t newNewLine, uint64_t newAppend, uint newWiteBufferFlushSize,
+                   Compressor::TYPE newCompressionType, int newCompressionLevel, uint64_t newCompressionFrameSize, uint newCompressionThreads);
         ~WriterFile() override;
 
         void initialize() override;
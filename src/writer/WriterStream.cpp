@@ -189,6 +189,8 @@ namespace OpenLogReplicator {
             paramIdx = ", idx: " + std::to_string(metadata->clientIdx);
         }
         ctx->info(0, "client requested scn: " + metadata->clientScn.toString() + paramIdx);
+        clientScn = metadata->clientScn;
+        clientIdx = metadata->clientIdx;
 
         resetMessageQueue();
         response.set_code(pb::ResponseCode::REPLICATE);
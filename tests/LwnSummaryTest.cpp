@@ -0,0 +1,114 @@
+/* Test of LWN summaries written with a checkpoint while the parser keeps running
+   Copyright (C) 2018-2026 Adam Leszczynski (aleszczynski@bersler.com)
+
+This file is part of OpenLogReplicator.
+
+OpenLogReplicator is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License as published
+by the Free Software Foundation; either version 3, or (at your option)
+any later version.
+
+OpenLogReplicator is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with OpenLogReplicator; see the file LICENSE;  If not see
+<http://www.gnu.org/licenses/>.  */
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "../src/metadata/LwnSummary.h"
+
+using OpenLogReplicator::LwnSummary;
+using OpenLogReplicator::Scn;
+using OpenLogReplicator::Seq;
+
+namespace {
+    constexpr typeResetlogs RESETLOGS{1234};
+    constexpr XidMap XID_OPEN{0x0005000A00000069};
+    constexpr XidMap XID_COMMITTED{0x0003001200000420};
+    uint64_t failed = 0;
+
+    void check(bool condition, const char* message) {
+        if (!condition) {
+            std::cerr << "FAILED: " << message << '\n';
+            ++failed;
+        }
+    }
+
+    LwnSummary::Entry lwn(uint64_t scn, typeBlk block, const std::vector<XidMap>& xids) {
+        LwnSummary::Entry entry{Scn(scn), Seq(100), block, {}};
+        for (const XidMap xidMap: xids)
+            LwnSummary::add(entry.bloom, xidMap);
+        return entry;
+    }
+}
+
+int main() {
+    LwnSummary writer;
+    writer.add(lwn(1000, 2, {XID_COMMITTED}));
+    writer.add(lwn(1001, 10, {XID_OPEN}));
+    writer.add(lwn(1002, 20, {}));
+    writer.add(lwn(1003, 30, {XID_COMMITTED, XID_OPEN}));
+
+    // The parser reaches the checkpoint with one open transaction, the open set is taken at that point
+    const Scn checkpointScn(1003);
+    std::vector<XidMap> openXids{XID_OPEN};
+
+    // The parser keeps running before the checkpoint is written, the open set must not change
+    writer.add(lwn(1004, 40, {XID_COMMITTED}));
+    writer.add(lwn(1005, 50, {}));
+
+    std::ostringstream ss;
+    writer.serialize(RESETLOGS, checkpointScn, &openXids, ss);
+    const std::string data = ss.str();
+
+    // Restart from the checkpoint
+    LwnSummary reader;
+    check(reader.deserialize(RESETLOGS, checkpointScn, data), "summary is valid");
+    reader.activate();
+    check(reader.isActive(), "summary is active");
+    check(reader.getScn() == checkpointScn, "summary scn is the checkpoint scn");
+    check(reader.getOpenXids().size() == 1 && reader.getOpenXids().count(XID_OPEN) == 1, "open transaction is restored");
+
+    check(reader.skip(Scn(1000), Seq(100), 2), "LWN with no open transaction is skipped");
+    check(reader.skip(Scn(1002), Seq(100), 20), "empty LWN is skipped");
+    check(!reader.skip(Scn(1001), Seq(100), 10), "LWN with the open transaction is parsed");
+    check(!reader.skip(Scn(1003), Seq(100), 30), "LWN with the open and another transaction is parsed");
+    check(!reader.skip(Scn(999), Seq(100), 1), "unknown LWN is parsed");
+
+    // Summary of another checkpoint has no open set
+    LwnSummary other;
+    check(other.deserialize(RESETLOGS, Scn(1005), data), "summary is valid for another checkpoint");
+    other.activate();
+    check(!other.isActive(), "summary of another checkpoint is not active");
+
+    // Summary written without the open set is never active
+    LwnSummary noOpen;
+    noOpen.add(lwn(1006, 60, {}));
+    std::ostringstream ssNoOpen;
+    noOpen.serialize(RESETLOGS, Scn(1006), nullptr, ssNoOpen);
+    LwnSummary noOpenReader;
+    check(noOpenReader.deserialize(RESETLOGS, Scn(1006), ssNoOpen.str()), "summary without open set is valid");
+    noOpenReader.activate();
+    check(!noOpenReader.isActive(), "summary without open set is not active");
+
+    // Summary of another incarnation is ignored
+    LwnSummary resetlogs;
+    check(resetlogs.deserialize(RESETLOGS + 1, checkpointScn, data), "summary of another incarnation is valid");
+    resetlogs.activate();
+    check(!resetlogs.isActive(), "summary of another incarnation is not active");
+
+    check(!reader.deserialize(RESETLOGS, checkpointScn, data.substr(0, 16)), "truncated summary is rejected");
+
+    if (failed != 0) {
+        std::cerr << failed << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "OK\n";
+    return 0;
+}